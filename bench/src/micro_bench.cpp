@@ -0,0 +1,476 @@
+// Hot-path micro-benchmarks with a baseline comparison mode for CI
+//
+// Usage: Project_microbench [--samples N] [--filter text] [--output file.json]
+//                           [--baseline file.json] [--threshold 0.15]
+//
+// Every benchmark is timed over several samples and reported as the median time per
+// operation. With --baseline, medians are compared against a file written earlier with
+// --output; the exit code is 2 if any benchmark got slower by more than the threshold.
+// Headless like Project_bench: no window or GL context is created.
+
+#include <project/debris_system.hpp>
+#include <project/ecs_components.hpp>
+#include <project/ecs_systems.hpp>
+#include <project/physics_world.hpp>
+#include <project/scene.hpp>
+#include <project/scene_manager.hpp>
+#include <project/scene_strategy.hpp>
+#include <project/transform_pool.hpp>
+#include <btBulletDynamicsCommon.h>
+#include <entt/entt.hpp>
+#include <raymath.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr std::uint32_t kSeed = 1234;
+constexpr float kHalfExtent = 0.5F;
+constexpr int kRegressionExitCode = 2;
+
+// Written by every benchmark so the compiler cannot drop the measured work
+volatile float benchmarkSink = 0.0F;
+
+/// Benchmark settings from the command line
+struct MicroOptions {
+    int samples{15};
+    std::string filter;
+    std::string outputPath;
+    std::string baselinePath;
+    double threshold{0.15};  // Allowed slowdown against the baseline (0.15 = 15%)
+};
+
+/// A prepared benchmark: runSample() performs `operations` operations and returns the
+/// nanoseconds they took (setup inside a sample is not timed)
+struct MicroCase {
+    size_t operations{1};
+    std::function<double()> runSample;
+};
+
+/// A named benchmark; the fixture is only built when the benchmark is selected
+struct MicroBenchmark {
+    std::string name;
+    std::function<MicroCase()> prepare;
+};
+
+/// Results for one benchmark, in nanoseconds per operation
+struct MicroResult {
+    std::string name;
+    size_t operations{0};
+    double median{0.0};
+    double min{0.0};
+    double mean{0.0};
+};
+
+double elapsedNs(Clock::time_point start) {
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+/// Transforms with random poses, as physics leaves them
+std::vector<project::Transform> makeTransforms(size_t count) {
+    std::mt19937 random(kSeed);
+    std::uniform_real_distribution<float> position(-100.0F, 100.0F);
+    std::uniform_real_distribution<float> angle(-PI, PI);
+
+    std::vector<project::Transform> transforms(count);
+    for (project::Transform& transform : transforms) {
+        transform.position = Vector3{position(random), position(random), position(random)};
+        transform.rotation = QuaternionFromEuler(angle(random), angle(random), angle(random));
+    }
+    return transforms;
+}
+
+MicroCase benchmarkGetMatrix() {
+    constexpr size_t kCount = 4096;
+    auto transforms = std::make_shared<std::vector<project::Transform>>(makeTransforms(kCount));
+    return {kCount, [transforms] {
+        float sum = 0.0F;
+        const auto start = Clock::now();
+        for (const project::Transform& transform : *transforms) {
+            sum += transform.getMatrix().m12;
+        }
+        const double ns = elapsedNs(start);
+        benchmarkSink = sum;
+        return ns;
+    }};
+}
+
+/// What RenderSystem::draw runs per frame: blend and compose the matrices of every entity
+/// (replaced the per-entity quaternion to axis-angle conversion)
+MicroCase benchmarkBuildMatrices(size_t count) {
+    auto pool = std::make_shared<project::TransformPool>();
+    const std::vector<project::Transform> transforms = makeTransforms(count);
+    pool->reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        project::PreviousTransform previous{transforms[i].position, transforms[i].rotation};
+        previous.position.y -= 0.1F;
+        pool->push(static_cast<entt::entity>(i), transforms[i], previous);
+    }
+
+    return {count, [pool] {
+        const auto start = Clock::now();
+        pool->buildMatrices(0.5F);
+        const double ns = elapsedNs(start);
+        benchmarkSink = pool->getMatrices().back().m12;
+        return ns;
+    }};
+}
+
+/// PhysicsSystem::syncTransforms with every body reported as moved
+MicroCase benchmarkSyncTransforms(size_t count) {
+    struct SyncFixture {
+        entt::registry registry;
+        project::PhysicsWorld world{registry};
+        std::vector<entt::entity> entities;
+        float offset{0.0F};
+    };
+
+    auto fixture = std::make_shared<SyncFixture>();
+    fixture->world.initialize();
+    const std::vector<project::ShapeHandle> shapes{
+        fixture->world.getShapeCache().acquireBox(Vector3{kHalfExtent, kHalfExtent, kHalfExtent})
+    };
+    std::vector<project::BodySpawn> spawns(count);
+    for (size_t i = 0; i < count; ++i) {
+        spawns[i].position = Vector3{static_cast<float>(i % 100) * 2.0F, 10.0F, static_cast<float>(i / 100) * 2.0F};
+        spawns[i].mass = 1.0F;
+    }
+    fixture->world.createBodies(spawns, shapes, fixture->entities);
+
+    return {count, [fixture] {
+        // Report every body the way Bullet does during a step (not timed)
+        fixture->offset += 0.01F;
+        for (const entt::entity entity : fixture->entities) {
+            const auto& body = fixture->registry.get<project::PhysicsBody>(entity);
+            btTransform transform = body.rigidBody->getWorldTransform();
+            const btVector3 origin = transform.getOrigin();
+            transform.setOrigin(btVector3(origin.getX(), origin.getY() + fixture->offset, origin.getZ()));
+            body.motionState->setWorldTransform(transform);
+        }
+
+        project::PhysicsSyncState& sync = fixture->world.getSyncState();
+        const auto start = Clock::now();
+        sync.beginFrame();
+        project::PhysicsSystem::syncTransforms(fixture->registry, sync);
+        const double ns = elapsedNs(start);
+        benchmarkSink = fixture->registry.get<project::Transform>(fixture->entities.back()).position.y;
+        return ns;
+    }};
+}
+
+/// PhysicsWorld::createBody, the body half of BulletPhysicsScene::createPhysicsEntity
+MicroCase benchmarkCreateBody(size_t count) {
+    return {count, [count] {
+        entt::registry registry;
+        project::PhysicsWorld world(registry);
+        world.initialize();
+        project::ShapeHandle shape = world.getShapeCache().acquireBox(Vector3{kHalfExtent, kHalfExtent, kHalfExtent});
+
+        const auto start = Clock::now();
+        for (size_t i = 0; i < count; ++i) {
+            const Vector3 position{static_cast<float>(i % 100) * 2.0F, 10.0F, static_cast<float>(i / 100) * 2.0F};
+            static_cast<void>(world.createBody(position, shape, 1.0F));
+        }
+        const double ns = elapsedNs(start);
+
+        world.shutdown();
+        return ns;
+    }};
+}
+
+/// DebrisSystem::update for one fixed step, plus composing the draw matrices
+MicroCase benchmarkDebris(size_t count) {
+    struct DebrisFixture {
+        project::DebrisSystem debris;
+        std::vector<project::DebrisDrawBatch> batches;
+    };
+
+    auto fixture = std::make_shared<DebrisFixture>();
+    for (int type = 0; type < 4; ++type) {
+        const float size = 0.1F * static_cast<float>(type + 1);
+        static_cast<void>(fixture->debris.addType(nullptr, BoundingBox{Vector3{-size, -size, -size}, Vector3{size, size, size}}));
+    }
+    fixture->debris.getSettings().lifetime = std::numeric_limits<float>::max();
+    fixture->debris.spawnBurst(Vector3{0.0F, 1.0F, 0.0F}, count, 8.0F);
+
+    return {count, [fixture] {
+        const auto start = Clock::now();
+        fixture->debris.update(1.0F / 60.0F);
+        fixture->debris.buildDrawBatches(fixture->batches);
+        const double ns = elapsedNs(start);
+        benchmarkSink = fixture->batches.front().matrices.front().m13;
+        return ns;
+    }};
+}
+
+/// Hashed lookups through the scene's name index (one name among count interned ones)
+MicroCase benchmarkFindObjectByName(size_t count) {
+    constexpr size_t kLookups = 256;
+    auto scene = std::make_shared<project::Scene>();
+    for (size_t i = 0; i < count; ++i) {
+        static_cast<void>(scene->addObject(nullptr, Vector3Zero(), 1.0F, "object-" + std::to_string(i)));
+    }
+    const std::string name = "object-" + std::to_string(count - 1);
+
+    return {kLookups, [scene, name] {
+        size_t found = 0;
+        const auto start = Clock::now();
+        for (size_t i = 0; i < kLookups; ++i) {
+            found += (scene->findObjectByName(name) != nullptr) ? 1 : 0;
+        }
+        const double ns = elapsedNs(start);
+        benchmarkSink = static_cast<float>(found);
+        return ns;
+    }};
+}
+
+/// Scene with nothing to load, so switching measures the manager alone
+class EmptyScene : public project::SceneStrategy {
+public:
+    [[nodiscard]] const char* getName() const override { return "Empty"; }
+    void draw() const override {}
+};
+
+/// SceneManager::switchToScene there and back, with the outgoing scene kept warm
+/// (not switchToNextScene, which logs every switch and would time the iostream writes)
+MicroCase benchmarkSceneSwitch() {
+    constexpr size_t kRoundTrips = 1024;
+    auto sceneManager = std::make_shared<project::SceneManager>();
+    sceneManager->registerScene(std::make_unique<EmptyScene>());
+    sceneManager->registerScene(std::make_unique<EmptyScene>());
+    sceneManager->setResidencyPolicy(project::SceneResidencyPolicy{1, false, 0});
+
+    return {kRoundTrips, [sceneManager] {
+        const auto start = Clock::now();
+        for (size_t i = 0; i < kRoundTrips; ++i) {
+            sceneManager->switchToScene(1);
+            sceneManager->switchToScene(0);
+        }
+        const double ns = elapsedNs(start);
+        benchmarkSink = static_cast<float>(sceneManager->getCurrentSceneIndex());
+        return ns;
+    }};
+}
+
+std::vector<MicroBenchmark> makeBenchmarks(const MicroOptions& options) {
+    std::vector<MicroBenchmark> benchmarks{
+        {"transform/get_matrix", benchmarkGetMatrix},
+        {"render/build_matrices/1000", [] { return benchmarkBuildMatrices(1000); }},
+        {"render/build_matrices/10000", [] { return benchmarkBuildMatrices(10000); }},
+        {"render/build_matrices/100000", [] { return benchmarkBuildMatrices(100000); }},
+        {"physics/sync_transforms/1000", [] { return benchmarkSyncTransforms(1000); }},
+        {"physics/sync_transforms/10000", [] { return benchmarkSyncTransforms(10000); }},
+        {"physics/sync_transforms/100000", [] { return benchmarkSyncTransforms(100000); }},
+        {"physics/create_body/1000", [] { return benchmarkCreateBody(1000); }},
+        {"physics/create_body/10000", [] { return benchmarkCreateBody(10000); }},
+        {"debris/update/10000", [] { return benchmarkDebris(10000); }},
+        {"debris/update/100000", [] { return benchmarkDebris(100000); }},
+        {"scene/find_object_by_name/100", [] { return benchmarkFindObjectByName(100); }},
+        {"scene/find_object_by_name/1000", [] { return benchmarkFindObjectByName(1000); }},
+        {"scene/find_object_by_name/10000", [] { return benchmarkFindObjectByName(10000); }},
+        {"scene_manager/switch_round_trip", benchmarkSceneSwitch},
+    };
+
+    if (!options.filter.empty()) {
+        std::erase_if(benchmarks, [&options](const MicroBenchmark& benchmark) {
+            return benchmark.name.find(options.filter) == std::string::npos;
+        });
+    }
+    return benchmarks;
+}
+
+MicroResult runBenchmark(const MicroBenchmark& benchmark, int samples) {
+    const MicroCase microCase = benchmark.prepare();
+
+    // One untimed run warms caches and grows any storage the benchmark reuses
+    static_cast<void>(microCase.runSample());
+
+    std::vector<double> nsPerOperation;
+    nsPerOperation.reserve(static_cast<size_t>(samples));
+    for (int i = 0; i < samples; ++i) {
+        nsPerOperation.push_back(microCase.runSample() / static_cast<double>(microCase.operations));
+    }
+    std::ranges::sort(nsPerOperation);
+
+    MicroResult result;
+    result.name = benchmark.name;
+    result.operations = microCase.operations;
+    result.median = nsPerOperation[nsPerOperation.size() / 2];
+    result.min = nsPerOperation.front();
+    double total = 0.0;
+    for (const double value : nsPerOperation) {
+        total += value;
+    }
+    result.mean = total / static_cast<double>(nsPerOperation.size());
+    return result;
+}
+
+void writeJson(std::ostream& out, const MicroOptions& options, const std::vector<MicroResult>& results) {
+    out << "{\n";
+    out << "  \"benchmark\": \"micro\",\n";
+    out << "  \"samples\": " << options.samples << ",\n";
+    out << "  \"results\": [\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const MicroResult& result = results[i];
+        out << "    {\"name\": \"" << result.name << "\", \"operations\": " << result.operations
+            << ", \"ns_per_op\": " << result.median << ", \"min_ns_per_op\": " << result.min
+            << ", \"mean_ns_per_op\": " << result.mean << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n";
+    out << "}\n";
+}
+
+/// Read the median of every benchmark from a file written by writeJson
+/// Just enough scanning for that format: each "name" is followed by its "ns_per_op"
+bool readBaseline(const std::string& path, std::unordered_map<std::string, double>& baseline) {
+    std::ifstream file(path);
+    if (!file) {
+        return false;
+    }
+    const std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    constexpr std::string_view kNameKey = "\"name\": \"";
+    constexpr std::string_view kValueKey = "\"ns_per_op\": ";
+    for (size_t position = text.find(kNameKey); position != std::string::npos; position = text.find(kNameKey, position)) {
+        const size_t nameStart = position + kNameKey.size();
+        const size_t nameEnd = text.find('"', nameStart);
+        const size_t valueStart = text.find(kValueKey, nameEnd);
+        if (nameEnd == std::string::npos || valueStart == std::string::npos) {
+            break;
+        }
+        try {
+            baseline[text.substr(nameStart, nameEnd - nameStart)] = std::stod(text.substr(valueStart + kValueKey.size()));
+        } catch (const std::exception&) {
+            return false;
+        }
+        position = valueStart;
+    }
+    return true;
+}
+
+/// Compare medians against the baseline and print a line per benchmark
+/// @return Number of benchmarks slower than the threshold allows
+size_t compareWithBaseline(const std::vector<MicroResult>& results, const std::unordered_map<std::string, double>& baseline, double threshold) {
+    size_t regressions = 0;
+    for (const MicroResult& result : results) {
+        const auto baselineIt = baseline.find(result.name);
+        if (baselineIt == baseline.end() || baselineIt->second <= 0.0) {
+            std::cerr << "  new        " << result.name << ": " << result.median << " ns/op\n";
+            continue;
+        }
+
+        const double change = (result.median / baselineIt->second) - 1.0;
+        const bool regressed = change > threshold;
+        regressions += regressed ? 1 : 0;
+        std::cerr << (regressed ? "  REGRESSED  " : "  ok         ") << result.name << ": " << result.median
+                  << " ns/op (baseline " << baselineIt->second << ", " << (change >= 0.0 ? "+" : "")
+                  << change * 100.0 << "%)\n";
+    }
+    return regressions;
+}
+
+void printUsage() {
+    std::cerr << "Usage: Project_microbench [--samples N] [--filter text] [--output file.json]\n"
+                 "                          [--baseline file.json] [--threshold 0.15]\n";
+}
+
+/// Parse the command line
+/// @return False on invalid arguments
+bool parseOptions(int argc, char** argv, MicroOptions& options) {
+    const std::vector<std::string_view> args(argv + 1, argv + argc);
+    for (size_t i = 0; i < args.size(); ++i) {
+        const std::string_view arg = args[i];
+        if (arg == "--help" || arg == "-h") {
+            return false;
+        }
+        if (i + 1 >= args.size()) {
+            std::cerr << "Missing value for " << arg << std::endl;
+            return false;
+        }
+
+        const std::string_view value = args[++i];
+        try {
+            if (arg == "--samples") {
+                options.samples = std::stoi(std::string(value));
+            } else if (arg == "--filter") {
+                options.filter = value;
+            } else if (arg == "--output") {
+                options.outputPath = value;
+            } else if (arg == "--baseline") {
+                options.baselinePath = value;
+            } else if (arg == "--threshold") {
+                options.threshold = std::stod(std::string(value));
+            } else {
+                std::cerr << "Unknown argument: " << arg << std::endl;
+                return false;
+            }
+        } catch (const std::exception&) {
+            std::cerr << "Invalid value for " << arg << ": " << value << std::endl;
+            return false;
+        }
+    }
+    return options.samples > 0 && options.threshold >= 0.0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    MicroOptions options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage();
+        return 1;
+    }
+
+    std::unordered_map<std::string, double> baseline;
+    if (!options.baselinePath.empty() && !readBaseline(options.baselinePath, baseline)) {
+        std::cerr << "Failed to read baseline " << options.baselinePath << std::endl;
+        return 1;
+    }
+
+    std::vector<MicroResult> results;
+    for (const MicroBenchmark& benchmark : makeBenchmarks(options)) {
+        results.push_back(runBenchmark(benchmark, options.samples));
+        std::cerr << "  " << results.back().name << ": " << results.back().median << " ns/op (min " << results.back().min << ")" << std::endl;
+    }
+
+    if (options.outputPath.empty()) {
+        writeJson(std::cout, options, results);
+    } else {
+        std::ofstream file(options.outputPath);
+        if (!file) {
+            std::cerr << "Failed to open " << options.outputPath << std::endl;
+            return 1;
+        }
+        writeJson(file, options, results);
+        std::cout << "Wrote " << results.size() << " benchmarks to " << options.outputPath << std::endl;
+    }
+
+    if (options.baselinePath.empty()) {
+        return 0;
+    }
+    std::cerr << "Against " << options.baselinePath << " (threshold " << options.threshold * 100.0 << "%):\n";
+    const size_t regressions = compareWithBaseline(results, baseline, options.threshold);
+    if (regressions > 0) {
+        std::cerr << regressions << " benchmark(s) regressed" << std::endl;
+        return kRegressionExitCode;
+    }
+    return 0;
+}
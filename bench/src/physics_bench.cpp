@@ -0,0 +1,391 @@
+// Headless physics benchmark: scripted scenes stepped at a fixed rate, results as JSON
+//
+// Usage: Project_bench [--steps N] [--bodies 100,1000,...] [--shapes boxes,mixed]
+//                      [--layouts scatter,stacks] [--backend st|mt] [--output file.json]
+//
+// No window or GL context is created, so it runs on CI machines and over SSH.
+
+#include <project/bullet_allocator.hpp>
+#include <project/ecs_components.hpp>
+#include <project/ecs_systems.hpp>
+#include <project/physics_world.hpp>
+#include <btBulletDynamicsCommon.h>
+#include <entt/entt.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <initializer_list>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr float kFixedStep = 1.0F / 60.0F;
+constexpr float kBodyMass = 1.0F;
+constexpr float kHalfExtent = 0.5F;
+constexpr int kStackHeight = 10;
+constexpr std::uint32_t kSeed = 1234;
+
+/// Benchmark settings from the command line
+struct BenchOptions {
+    int steps{600};
+    std::vector<size_t> bodyCounts{100, 1000, 10000, 50000};
+    std::vector<std::string> shapeMixes{"boxes", "mixed"};
+    std::vector<std::string> layouts{"scatter", "stacks"};
+    project::PhysicsBackend backend{project::PhysicsBackend::SingleThreaded};
+    std::string outputPath;
+};
+
+/// Percentile summary of a series of timings (milliseconds)
+struct TimingSummary {
+    double mean{0.0};
+    double p50{0.0};
+    double p90{0.0};
+    double p99{0.0};
+    double max{0.0};
+};
+
+/// Results for one scenario
+struct ScenarioResult {
+    std::string shapes;
+    std::string layout;
+    size_t bodies{0};
+    double setupMs{0.0};
+    TimingSummary stepMs;
+    TimingSummary syncMs;
+    double meanMovedBodies{0.0};
+    size_t bulletPeakBytes{0};
+    size_t bulletReservedBytes{0};
+    size_t bodyPoolBytes{0};
+    size_t maxRssBytes{0};
+};
+
+/// Summarize timings with nearest-rank percentiles
+/// @param samples Timings in milliseconds (sorted in place)
+TimingSummary summarize(std::vector<double>& samples) {
+    TimingSummary summary;
+    if (samples.empty()) {
+        return summary;
+    }
+
+    std::ranges::sort(samples);
+    const auto percentile = [&samples](double fraction) {
+        const auto rank = static_cast<size_t>(std::ceil(fraction * static_cast<double>(samples.size())));
+        return samples[std::clamp<size_t>(rank, 1, samples.size()) - 1];
+    };
+
+    summary.mean = std::accumulate(samples.begin(), samples.end(), 0.0) / static_cast<double>(samples.size());
+    summary.p50 = percentile(0.50);
+    summary.p90 = percentile(0.90);
+    summary.p99 = percentile(0.99);
+    summary.max = samples.back();
+    return summary;
+}
+
+/// Get the process-wide resident set high-water mark in bytes (0 if unsupported)
+size_t getMaxRssBytes() {
+#if defined(__APPLE__)
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return static_cast<size_t>(usage.ru_maxrss);  // Bytes on macOS
+#elif defined(__unix__)
+    constexpr size_t kBytesPerKilobyte = 1024;
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return static_cast<size_t>(usage.ru_maxrss) * kBytesPerKilobyte;  // Kilobytes on Linux
+#else
+    return 0;
+#endif
+}
+
+/// Get the shapes of a shape mix; body i uses shapes[i % shapes.size()]
+std::vector<project::ShapeHandle> acquireShapes(project::ShapeCache& shapeCache, std::string_view shapes) {
+    std::vector<project::ShapeHandle> handles{shapeCache.acquireBox(Vector3{kHalfExtent, kHalfExtent, kHalfExtent})};
+    if (shapes == "mixed") {
+        constexpr float kCapsuleRadius = 0.3F;
+        constexpr float kCapsuleHeight = 0.4F;
+        handles.push_back(shapeCache.acquireSphere(kHalfExtent));
+        handles.push_back(shapeCache.acquireCapsule(kCapsuleRadius, kCapsuleHeight));
+    }
+    return handles;
+}
+
+/// Spawn the ground and every dynamic body of a scenario
+void buildScenario(project::PhysicsWorld& world, const ScenarioResult& scenario) {
+    project::ShapeCache& shapeCache = world.getShapeCache();
+    const size_t count = scenario.bodies;
+    const std::vector<project::ShapeHandle> shapes = acquireShapes(shapeCache, scenario.shapes);
+    const auto shapeIndex = [&shapes](size_t i) { return static_cast<std::uint32_t>(i % shapes.size()); };
+
+    std::vector<project::BodySpawn> spawns(count);
+    std::vector<entt::entity> entities;
+
+    if (scenario.layout == "stacks") {
+        // Columns of kStackHeight bodies resting on each other on a square grid
+        constexpr float kColumnSpacing = 2.0F;
+        constexpr float kLevelGap = 0.01F;
+        const size_t columns = (count + kStackHeight - 1) / kStackHeight;
+        const auto gridSize = static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(columns))));
+        const float fieldHalfExtent = static_cast<float>(gridSize) * kColumnSpacing * 0.5F;
+
+        world.createBody(Vector3{0.0F, -kHalfExtent, 0.0F},
+                         shapeCache.acquireBox(Vector3{fieldHalfExtent + kColumnSpacing, kHalfExtent, fieldHalfExtent + kColumnSpacing}),
+                         0.0F);
+
+        for (size_t i = 0; i < count; ++i) {
+            const size_t column = i / kStackHeight;
+            const size_t level = i % kStackHeight;
+            spawns[i].position = Vector3{
+                (static_cast<float>(column % gridSize) * kColumnSpacing) - fieldHalfExtent,
+                kHalfExtent + (static_cast<float>(level) * ((2.0F * kHalfExtent) + kLevelGap)),
+                (static_cast<float>(column / gridSize) * kColumnSpacing) - fieldHalfExtent
+            };
+            spawns[i].shapeIndex = shapeIndex(i);
+            spawns[i].mass = kBodyMass;
+        }
+        world.createBodies(spawns, shapes, entities);
+        return;
+    }
+
+    // Scatter: bodies dropped from random positions in a cube sized to keep density constant
+    constexpr float kScatterSpacing = 1.5F;
+    constexpr float kDropHeight = 2.0F;
+    const float side = std::cbrt(static_cast<float>(count)) * kScatterSpacing;
+    const float fieldHalfExtent = side * 0.5F;
+
+    world.createBody(Vector3{0.0F, -kHalfExtent, 0.0F},
+                     shapeCache.acquireBox(Vector3{fieldHalfExtent * 2.0F, kHalfExtent, fieldHalfExtent * 2.0F}),
+                     0.0F);
+
+    std::mt19937 random(kSeed);
+    std::uniform_real_distribution<float> horizontal(-fieldHalfExtent, fieldHalfExtent);
+    std::uniform_real_distribution<float> vertical(kDropHeight, kDropHeight + side);
+    for (size_t i = 0; i < count; ++i) {
+        spawns[i].position = Vector3{horizontal(random), vertical(random), horizontal(random)};
+        spawns[i].shapeIndex = shapeIndex(i);
+        spawns[i].mass = kBodyMass;
+    }
+    world.createBodies(spawns, shapes, entities);
+}
+
+/// Build, step and tear down one scenario
+ScenarioResult runScenario(const BenchOptions& options, std::string shapes, std::string layout, size_t bodies) {
+    ScenarioResult result;
+    result.shapes = std::move(shapes);
+    result.layout = std::move(layout);
+    result.bodies = bodies;
+
+    entt::registry registry;
+    project::PhysicsWorld world(registry);
+    world.setPhysicsBackend(options.backend);
+
+    project::BulletAllocator::resetPeak();
+
+    const auto setupStart = Clock::now();
+    world.initialize();
+    buildScenario(world, result);
+    result.setupMs = std::chrono::duration<double, std::milli>(Clock::now() - setupStart).count();
+
+    btDiscreteDynamicsWorld* dynamicsWorld = world.getDynamicsWorld();
+    project::PhysicsSyncState& sync = world.getSyncState();
+
+    std::vector<double> stepSamples;
+    std::vector<double> syncSamples;
+    stepSamples.reserve(static_cast<size_t>(options.steps));
+    syncSamples.reserve(static_cast<size_t>(options.steps));
+    size_t movedTotal = 0;
+
+    for (int step = 0; step < options.steps; ++step) {
+        const auto stepStart = Clock::now();
+        dynamicsWorld->stepSimulation(kFixedStep, 1, kFixedStep);
+        const auto syncStart = Clock::now();
+        sync.beginFrame();
+        project::PhysicsSystem::syncTransforms(registry, sync);
+        const auto syncEnd = Clock::now();
+
+        stepSamples.push_back(std::chrono::duration<double, std::milli>(syncStart - stepStart).count());
+        syncSamples.push_back(std::chrono::duration<double, std::milli>(syncEnd - syncStart).count());
+        movedTotal += sync.movedThisFrame.size();
+    }
+
+    result.stepMs = summarize(stepSamples);
+    result.syncMs = summarize(syncSamples);
+    result.meanMovedBodies = (options.steps > 0) ? static_cast<double>(movedTotal) / options.steps : 0.0;
+
+    const project::BulletAllocator::Stats allocatorStats = project::BulletAllocator::getStats();
+    result.bulletPeakBytes = allocatorStats.peakBytesInUse;
+    result.bulletReservedBytes = allocatorStats.reservedBytes;
+    result.bodyPoolBytes = world.getPooledBytes();
+    result.maxRssBytes = getMaxRssBytes();
+
+    world.shutdown();
+    return result;
+}
+
+void writeTiming(std::ostream& out, std::string_view name, const TimingSummary& timing) {
+    out << "      \"" << name << "\": {\"mean\": " << timing.mean << ", \"p50\": " << timing.p50
+        << ", \"p90\": " << timing.p90 << ", \"p99\": " << timing.p99 << ", \"max\": " << timing.max << "}";
+}
+
+void writeJson(std::ostream& out, const BenchOptions& options, project::PhysicsBackend backend,
+               const std::vector<ScenarioResult>& results) {
+    out << "{\n";
+    out << "  \"benchmark\": \"physics\",\n";
+    out << "  \"backend\": \"" << (backend == project::PhysicsBackend::MultiThreaded ? "multithreaded" : "single-threaded") << "\",\n";
+    out << "  \"steps\": " << options.steps << ",\n";
+    out << "  \"fixed_step_s\": " << kFixedStep << ",\n";
+    out << "  \"scenarios\": [\n";
+
+    for (size_t i = 0; i < results.size(); ++i) {
+        const ScenarioResult& result = results[i];
+        out << "    {\n";
+        out << "      \"name\": \"" << result.shapes << '/' << result.layout << '/' << result.bodies << "\",\n";
+        out << "      \"shapes\": \"" << result.shapes << "\",\n";
+        out << "      \"layout\": \"" << result.layout << "\",\n";
+        out << "      \"bodies\": " << result.bodies << ",\n";
+        out << "      \"setup_ms\": " << result.setupMs << ",\n";
+        writeTiming(out, "step_ms", result.stepMs);
+        out << ",\n";
+        writeTiming(out, "sync_ms", result.syncMs);
+        out << ",\n";
+        out << "      \"mean_moved_bodies\": " << result.meanMovedBodies << ",\n";
+        out << "      \"bullet_peak_bytes\": " << result.bulletPeakBytes << ",\n";
+        out << "      \"bullet_reserved_bytes\": " << result.bulletReservedBytes << ",\n";
+        out << "      \"body_pool_bytes\": " << result.bodyPoolBytes << ",\n";
+        out << "      \"max_rss_bytes\": " << result.maxRssBytes << "\n";
+        out << "    }" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+
+    out << "  ]\n";
+    out << "}\n";
+}
+
+/// Split a comma-separated argument
+std::vector<std::string> splitList(std::string_view list) {
+    std::vector<std::string> items;
+    std::stringstream stream{std::string(list)};
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        if (!item.empty()) {
+            items.push_back(item);
+        }
+    }
+    return items;
+}
+
+void printUsage() {
+    std::cerr << "Usage: Project_bench [--steps N] [--bodies 100,1000,10000,50000] [--shapes boxes,mixed]\n"
+                 "                     [--layouts scatter,stacks] [--backend st|mt] [--output file.json]\n";
+}
+
+/// Parse the command line
+/// @return False on invalid arguments
+bool parseOptions(int argc, char** argv, BenchOptions& options) {
+    const std::vector<std::string_view> args(argv + 1, argv + argc);
+    for (size_t i = 0; i < args.size(); ++i) {
+        const std::string_view arg = args[i];
+        if (arg == "--help" || arg == "-h") {
+            return false;
+        }
+        if (i + 1 >= args.size()) {
+            std::cerr << "Missing value for " << arg << std::endl;
+            return false;
+        }
+
+        const std::string_view value = args[++i];
+        try {
+            if (arg == "--steps") {
+                options.steps = std::stoi(std::string(value));
+            } else if (arg == "--bodies") {
+                options.bodyCounts.clear();
+                for (const std::string& count : splitList(value)) {
+                    options.bodyCounts.push_back(static_cast<size_t>(std::stoul(count)));
+                }
+            } else if (arg == "--shapes") {
+                options.shapeMixes = splitList(value);
+            } else if (arg == "--layouts") {
+                options.layouts = splitList(value);
+            } else if (arg == "--backend") {
+                if (value != "st" && value != "mt") {
+                    std::cerr << "Unknown backend: " << value << std::endl;
+                    return false;
+                }
+                options.backend = (value == "mt") ? project::PhysicsBackend::MultiThreaded
+                                                  : project::PhysicsBackend::SingleThreaded;
+            } else if (arg == "--output") {
+                options.outputPath = value;
+            } else {
+                std::cerr << "Unknown argument: " << arg << std::endl;
+                return false;
+            }
+        } catch (const std::exception&) {
+            std::cerr << "Invalid value for " << arg << ": " << value << std::endl;
+            return false;
+        }
+    }
+
+    const auto isKnown = [](const std::vector<std::string>& values, std::initializer_list<std::string_view> known) {
+        return std::ranges::all_of(values, [known](const std::string& value) {
+            return std::ranges::find(known, value) != known.end();
+        });
+    };
+    if (!isKnown(options.shapeMixes, {"boxes", "mixed"}) || !isKnown(options.layouts, {"scatter", "stacks"})) {
+        std::cerr << "Shapes must be boxes/mixed and layouts scatter/stacks" << std::endl;
+        return false;
+    }
+    return options.steps > 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    BenchOptions options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage();
+        return 1;
+    }
+
+    if (options.backend == project::PhysicsBackend::MultiThreaded && !project::PhysicsThreading::isAvailable()) {
+        std::cerr << "Multithreaded backend not compiled in, using single-threaded" << std::endl;
+        options.backend = project::PhysicsBackend::SingleThreaded;
+    }
+
+    std::vector<ScenarioResult> results;
+    for (const size_t bodies : options.bodyCounts) {
+        for (const std::string& layout : options.layouts) {
+            for (const std::string& shapes : options.shapeMixes) {
+                std::cerr << "Running " << shapes << '/' << layout << '/' << bodies << " for " << options.steps << " steps..." << std::endl;
+                results.push_back(runScenario(options, shapes, layout, bodies));
+                std::cerr << "  step p50 " << results.back().stepMs.p50 << " ms, p99 " << results.back().stepMs.p99 << " ms" << std::endl;
+            }
+        }
+    }
+
+    if (options.outputPath.empty()) {
+        writeJson(std::cout, options, options.backend, results);
+        return 0;
+    }
+
+    std::ofstream file(options.outputPath);
+    if (!file) {
+        std::cerr << "Failed to open " << options.outputPath << std::endl;
+        return 1;
+    }
+    writeJson(file, options, options.backend, results);
+    std::cout << "Wrote " << results.size() << " scenarios to " << options.outputPath << std::endl;
+    return 0;
+}
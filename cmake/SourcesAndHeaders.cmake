@@ -1,12 +1,37 @@
 set(sources
     src/tmp.cpp
+    src/asset_cache.cpp
+    src/async_asset_loader.cpp
+    src/baked_model.cpp
+    src/bullet_allocator.cpp
     src/scene.cpp
     src/scene_manager.cpp
     src/tree_scene.cpp
     src/geometric_scene.cpp
     src/bullet_physics_scene.cpp
+    src/debris_system.cpp
+    src/debug_draw.cpp
+    src/entity_name_index.cpp
     src/imgui_manager.cpp
+    src/imgui_raylib_platform.cpp
+    src/frustum.cpp
     src/gui_controls.cpp
+    src/headless_server.cpp
+    src/headless_world.cpp
+    src/instanced_renderer.cpp
+    src/lod.cpp
+    src/memory_tracker.cpp
+    src/physics_snapshot.cpp
+    src/physics_threading.cpp
+    src/physics_world.cpp
+    src/profiler.cpp
+    src/shape_cache.cpp
+    src/simulation_thread.cpp
+    src/spatial_query.cpp
+    src/static_batch.cpp
+    src/system_scheduler.cpp
+    src/task_pool.cpp
+    src/transform_pool.cpp
 )
 
 set(exe_sources
@@ -16,16 +41,70 @@ set(exe_sources
 
 set(headers
     include/project/tmp.hpp
+    include/project/asset_cache.hpp
+    include/project/async_asset_loader.hpp
+    include/project/baked_model.hpp
+    include/project/bullet_allocator.hpp
     include/project/scene.hpp
     include/project/scene_strategy.hpp
     include/project/scene_manager.hpp
     include/project/tree_scene.hpp
     include/project/geometric_scene.hpp
     include/project/bullet_physics_scene.hpp
+    include/project/debris_system.hpp
+    include/project/debug_draw.hpp
+    include/project/entity_name_index.hpp
     include/project/imgui_manager.hpp
+    include/project/imgui_raylib_platform.hpp
+    include/project/frustum.hpp
     include/project/gui_controls.hpp
+    include/project/headless_server.hpp
+    include/project/headless_world.hpp
+    include/project/instanced_renderer.hpp
+    include/project/lod.hpp
+    include/project/memory_tracker.hpp
+    include/project/object_pool.hpp
+    include/project/physics_snapshot.hpp
+    include/project/physics_threading.hpp
+    include/project/physics_world.hpp
+    include/project/profiler.hpp
+    include/project/render_snapshot.hpp
+    include/project/scene_layout.hpp
+    include/project/shape_cache.hpp
+    include/project/simd_lanes.hpp
+    include/project/simulation_thread.hpp
+    include/project/spatial_query.hpp
+    include/project/static_batch.hpp
+    include/project/string_hash.hpp
+    include/project/system_scheduler.hpp
+    include/project/task_pool.hpp
+    include/project/transform_pool.hpp
 )
 
 set(test_sources
   src/tmp_test.cpp
+  src/object_pool_test.cpp
+  src/headless_server_test.cpp
+  src/scene_test.cpp
+  src/entity_name_index_test.cpp
+  src/physics_snapshot_test.cpp
+  src/task_pool_test.cpp
+  src/system_scheduler_test.cpp
+  src/hierarchy_system_test.cpp
+)
+
+set(bench_sources
+  src/physics_bench.cpp
+)
+
+set(micro_bench_sources
+  src/micro_bench.cpp
+)
+
+set(tool_sources
+  src/asset_baker.cpp
+)
+
+set(server_sources
+  src/sim_server.cpp
 )
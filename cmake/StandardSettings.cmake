@@ -32,6 +32,30 @@ option(${PROJECT_NAME}_USE_GOOGLE_MOCK "Use the GoogleMock project for extending
 
 option(${PROJECT_NAME}_USE_CATCH2 "Use the Catch2 project for creating unit tests." OFF)
 
+#
+# Physics
+#
+
+option(${PROJECT_NAME}_ENABLE_BULLET_MULTITHREADING "Enable the multithreaded Bullet backend (requires Bullet built with BT_THREADSAFE=ON)." OFF)
+
+#
+# Benchmarks
+#
+
+option(${PROJECT_NAME}_ENABLE_BENCHMARKS "Build the headless physics benchmark (from the `bench` subfolder)." ON)
+
+#
+# Tools
+#
+
+option(${PROJECT_NAME}_ENABLE_TOOLS "Build the offline asset baker (from the `tools` subfolder)." ON)
+
+#
+# Profiling
+#
+
+option(${PROJECT_NAME}_ENABLE_PROFILER "Enable the in-game frame profiler (PROJECT_PROFILE_* macros compile to nothing when OFF)." ON)
+
 #
 # Static analyzers
 #
@@ -0,0 +1,222 @@
+#pragma once
+
+#include <raylib.h>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace project {
+
+class AsyncAssetLoader;
+class BakedModel;
+struct LodModel;
+struct LodSettings;
+struct PreparedModel;
+
+/// Shared, reference-counted handle to a GPU-resident model
+/// The model is unloaded when the last handle (including the cache's own) is released
+using ModelHandle = std::shared_ptr<const Model>;
+
+/// Shared, reference-counted handle to a GPU-resident texture
+using TextureHandle = std::shared_ptr<const Texture2D>;
+
+/// Shared handle to a model's level-of-detail chain (see lod.hpp)
+using LodHandle = std::shared_ptr<const LodModel>;
+
+/// Progress of an asynchronous model request (see AssetCache::requestModel)
+class ModelRequest {
+public:
+    enum class Status {
+        Pending,  // Being read/decoded on a worker or waiting for its GPU upload
+        Ready,    // getModel() holds the loaded model
+        Failed    // Missing or invalid file
+    };
+
+    explicit ModelRequest(std::string path) : path(std::move(path)) {}
+
+    [[nodiscard]] Status getStatus() const noexcept { return status; }
+    [[nodiscard]] bool isDone() const noexcept { return status != Status::Pending; }
+    [[nodiscard]] const ModelHandle& getModel() const noexcept { return model; }
+    [[nodiscard]] const std::string& getPath() const noexcept { return path; }
+
+private:
+    friend class AssetCache;
+
+    std::string path;
+    Status status{Status::Pending};
+    ModelHandle model;
+};
+
+/// Shared handle to a request; requesters poll it, the cache completes it on the GL thread
+using ModelRequestHandle = std::shared_ptr<const ModelRequest>;
+
+/// Caches models and textures so that every entity and scene using the same asset
+/// shares a single GPU copy instead of loading its own
+///
+/// File assets are keyed by path and by a hash of their contents, so two paths pointing
+/// at identical files also share one upload. Generated assets (e.g. GenMeshCube) are keyed
+/// by a caller-provided string.
+///
+/// Models whose base color is a single external image (the kit packs' Textures/colormap.png)
+/// all bind one cached Texture2D for it, whichever path loaded them, so the atlas is uploaded
+/// once and their draws can be grouped by texture.
+///
+/// The cache keeps its own reference to every asset; call releaseUnused() to unload assets
+/// that nothing else references anymore (e.g. after a scene switch).
+class AssetCache {
+public:
+    AssetCache();
+    ~AssetCache();
+
+    // Rule of Five: disable copy, allow move
+    AssetCache(const AssetCache&) = delete;
+    AssetCache& operator=(const AssetCache&) = delete;
+    AssetCache(AssetCache&&) noexcept;
+    AssetCache& operator=(AssetCache&&) noexcept;
+
+    /// Get a shared model loaded from disk (loads it on first use)
+    /// @param path Path to the model file
+    /// @return Handle to the model, or nullptr if the file is missing or fails to load
+    [[nodiscard]] ModelHandle acquireModel(const std::string& path);
+
+    /// Start loading a model in the background
+    /// The file is read and its texture atlas decoded on worker threads; the GPU upload
+    /// happens in processPendingUploads(). Cached models complete immediately.
+    /// @param path Path to the model file
+    /// @return Request to poll; concurrent requests for the same path share one load
+    [[nodiscard]] ModelRequestHandle requestModel(const std::string& path);
+
+    /// Upload models prepared by the workers, within a time budget (call once per frame on the GL thread)
+    /// At least one model is uploaded per call so loading always makes progress
+    /// @param budgetMs Time allowed for uploads this frame, in milliseconds
+    /// @return Number of requests completed
+    size_t processPendingUploads(double budgetMs);
+
+    /// Get the number of model requests still pending
+    [[nodiscard]] size_t getPendingRequestCount() const noexcept { return pendingRequests.size(); }
+
+    /// Get a shared model created in code (creates it on first use)
+    /// @param key Unique identifier for the generated model, e.g. "generated:cube:1.0"
+    /// @param factory Creates the model; only called on a cache miss
+    /// @return Handle to the model, or nullptr if the factory produced an invalid model
+    [[nodiscard]] ModelHandle acquireGeneratedModel(const std::string& key, const std::function<Model()>& factory);
+
+    /// Get a shared texture loaded from disk (loads it on first use)
+    /// @param path Path to the image file
+    /// @return Handle to the texture, or nullptr if the file is missing or fails to load
+    [[nodiscard]] TextureHandle acquireTexture(const std::string& path);
+
+    /// Get the model-space bounding box of a model
+    /// Computed once when the model is loaded; GetModelBoundingBox walks every vertex
+    /// @param model Model handle (from this cache or elsewhere)
+    /// @return Bounding box (computed on the spot for models this cache doesn't hold)
+    [[nodiscard]] BoundingBox getModelBounds(const ModelHandle& model) const;
+
+    /// Get the convex hull baked for a model (see BakedModel)
+    /// @param model Model handle from this cache
+    /// @return Hull points in model space, empty if the model was not loaded from a baked file
+    [[nodiscard]] std::span<const Vector3> getBakedHull(const ModelHandle& model) const;
+
+    /// Get the level-of-detail chain of a model (builds it on first use)
+    /// Building renders the impostor, so call this outside BeginMode3D()
+    /// @param model Model handle from this cache (level 0 of the chain)
+    /// @param settings Levels to build; only used on a cache miss
+    /// @return Handle to the chain, or nullptr if model is nullptr
+    [[nodiscard]] LodHandle acquireLodModel(const ModelHandle& model, const LodSettings& settings);
+
+    /// Unload every asset that is only referenced by the cache itself
+    /// @return Number of assets released
+    size_t releaseUnused();
+
+    /// Drop all cache references (assets still in use stay alive until their last handle goes away)
+    void clear();
+
+    /// Get the number of cached models
+    [[nodiscard]] size_t getModelCount() const noexcept { return modelsByHash.size(); }
+
+    /// Get the number of cached textures
+    [[nodiscard]] size_t getTextureCount() const noexcept { return texturesByHash.size(); }
+
+    /// Hash a byte buffer the way file contents are keyed (FNV-1a)
+    [[nodiscard]] static std::uint64_t hashBytes(const unsigned char* data, size_t size);
+
+    /// Estimate the memory a loaded model holds: mesh buffers (CPU copy plus GPU upload)
+    /// and albedo textures as RGBA8
+    /// @param model Loaded model
+    /// @return Approximate size in bytes
+    [[nodiscard]] static size_t estimateModelBytes(const Model& model);
+
+    /// Approximate memory held by the cached assets
+    struct MemoryUsage {
+        size_t cpuBytes{0};  // Mesh arrays raylib keeps in RAM
+        size_t gpuBytes{0};  // Uploaded mesh buffers and textures (RGBA8)
+    };
+
+    /// Estimate the memory of every cached model, level-of-detail chain and texture
+    /// Assets shared between entries (atlases, models in several chains) are counted once
+    [[nodiscard]] MemoryUsage getMemoryUsage() const;
+
+private:
+    /// Hash the file at path (FNV-1a over its bytes); falls back to the path if unreadable
+    [[nodiscard]] static std::uint64_t hashFileContents(const std::string& path);
+
+    /// Hash a string key for generated assets
+    [[nodiscard]] static std::uint64_t hashKey(const std::string& key);
+
+    /// Take ownership of a loaded model
+    /// @param sharedTextures Cached textures the materials bind; kept alive by the model and
+    ///        detached before it is unloaded
+    [[nodiscard]] static ModelHandle wrapModel(Model model, std::vector<TextureHandle> sharedTextures = {});
+
+    /// Cache a new model under its hash, along with its bounds
+    void storeModel(std::uint64_t hash, const ModelHandle& handle);
+
+    /// GPU half of an asynchronous load: LoadModel from the prepared bytes, then upload the atlas
+    [[nodiscard]] ModelHandle uploadPreparedModel(PreparedModel& prepared);
+
+    /// Upload a baked model and cache it with its precomputed bounds
+    /// @param atlas Shared albedo texture (nullptr to load textures from disk)
+    /// @param atlasPath Resolved path the atlas was loaded from
+    [[nodiscard]] ModelHandle uploadBakedModel(
+        const std::shared_ptr<const BakedModel>& baked,
+        std::uint64_t hash,
+        const TextureHandle& atlas,
+        const std::string& atlasPath
+    );
+
+    /// Get the cached texture of an atlas image, uploading the decoded image on a miss
+    /// @param path Resolved path of the image
+    /// @param contentHash Hash of the image file (same key as acquireTexture)
+    /// @param image Decoded pixels to upload on a miss
+    /// @return Handle to the texture, or nullptr if the upload failed
+    [[nodiscard]] TextureHandle acquireAtlasTexture(const std::string& path, std::uint64_t contentHash, const Image& image);
+    [[nodiscard]] static TextureHandle wrapTexture(Texture2D texture);
+
+    // Path -> content hash, so repeated lookups by path don't touch the disk
+    std::unordered_map<std::string, std::uint64_t> modelHashByPath;
+    std::unordered_map<std::string, std::uint64_t> textureHashByPath;
+
+    // Content hash -> shared asset
+    std::unordered_map<std::uint64_t, ModelHandle> modelsByHash;
+    std::unordered_map<std::uint64_t, TextureHandle> texturesByHash;
+
+    // Model-space bounds of every cached model (entries leave with their model)
+    std::unordered_map<const Model*, BoundingBox> modelBounds;
+
+    // Level-of-detail chains by level 0; each chain holds its source model
+    std::unordered_map<const Model*, LodHandle> lodModels;
+
+    // Baked files behind models loaded from them (their meshes point into the mapping)
+    std::unordered_map<const Model*, std::shared_ptr<const BakedModel>> bakedModels;
+
+    // Background loading; the workers start with the first requestModel()
+    std::unique_ptr<AsyncAssetLoader> loader;
+    std::unordered_map<std::string, std::shared_ptr<ModelRequest>> pendingRequests;
+};
+
+} // namespace project
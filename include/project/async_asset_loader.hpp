@@ -0,0 +1,122 @@
+#pragma once
+
+#include <project/baked_model.hpp>
+#include <raylib.h>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace project {
+
+/// CPU-side result of preparing a model on a worker thread, ready for GPU upload
+/// Owns the decoded atlas image (freed on destruction unless uploaded and released first)
+struct PreparedModel {
+    std::string path;
+    bool found{false};                    // False if the file is missing or unreadable
+    std::uint64_t contentHash{0};         // Same hash AssetCache uses to dedupe identical files
+    std::vector<unsigned char> fileData;  // Raw model file, served to LoadModel from memory (empty if baked)
+    std::shared_ptr<const BakedModel> baked;  // Up-to-date baked version of the file, if there is one
+    std::string atlasPath;                // Normalized path of the decoded base-color image (empty if none)
+    Image atlas{};                        // Decoded atlas (data == nullptr if not decoded)
+    std::uint64_t atlasHash{0};           // Hash of the atlas file, so its texture is shared by content
+
+    PreparedModel() = default;
+    ~PreparedModel() {
+        if (atlas.data != nullptr) {
+            UnloadImage(atlas);
+        }
+    }
+
+    // Rule of Five: disable copy, allow move (the atlas pixels have a single owner)
+    PreparedModel(const PreparedModel&) = delete;
+    PreparedModel& operator=(const PreparedModel&) = delete;
+
+    PreparedModel(PreparedModel&& other) noexcept
+        : path(std::move(other.path))
+        , found(other.found)
+        , contentHash(other.contentHash)
+        , fileData(std::move(other.fileData))
+        , baked(std::move(other.baked))
+        , atlasPath(std::move(other.atlasPath))
+        , atlas(other.atlas)
+        , atlasHash(other.atlasHash) {
+        other.atlas = Image{};
+    }
+
+    PreparedModel& operator=(PreparedModel&& other) noexcept {
+        if (this != &other) {
+            if (atlas.data != nullptr) {
+                UnloadImage(atlas);
+            }
+            path = std::move(other.path);
+            found = other.found;
+            contentHash = other.contentHash;
+            fileData = std::move(other.fileData);
+            baked = std::move(other.baked);
+            atlasPath = std::move(other.atlasPath);
+            atlas = other.atlas;
+            atlasHash = other.atlasHash;
+            other.atlas = Image{};
+        }
+        return *this;
+    }
+};
+
+/// Worker pool that reads, hashes and decodes model files off the main thread
+///
+/// raylib's LoadModel parses and uploads in one call and GL is only usable on the main
+/// thread, so the split is: workers read the file, hash it and decode its external
+/// base-color atlas (the Textures/*.png referenced by the glb); the main thread then runs
+/// LoadModel against the in-memory bytes and uploads the pre-decoded atlas. When a baked
+/// file matching the source exists, workers map it instead and the main thread skips the
+/// glTF parse entirely. See AssetCache::requestModel for the GL-thread half.
+class AsyncAssetLoader {
+public:
+    /// @param workerCount Number of worker threads (at least one)
+    explicit AsyncAssetLoader(unsigned int workerCount = getDefaultWorkerCount());
+    ~AsyncAssetLoader();
+
+    // Rule of Five: disable copy and move (workers reference the loader)
+    AsyncAssetLoader(const AsyncAssetLoader&) = delete;
+    AsyncAssetLoader& operator=(const AsyncAssetLoader&) = delete;
+    AsyncAssetLoader(AsyncAssetLoader&&) = delete;
+    AsyncAssetLoader& operator=(AsyncAssetLoader&&) = delete;
+
+    /// Queue a model file for preparation
+    /// @param path Path to the model file (.glb or .gltf)
+    void enqueueModel(const std::string& path);
+
+    /// Take the next prepared model, if any (main thread)
+    [[nodiscard]] std::optional<PreparedModel> popPrepared();
+
+    /// Get the number of models queued or being prepared (not yet popped)
+    [[nodiscard]] size_t getInFlightCount() const;
+
+    /// Get the default worker count: a couple of threads, leaving cores for physics
+    [[nodiscard]] static unsigned int getDefaultWorkerCount() noexcept;
+
+    /// Read, hash and decode one model synchronously (what each worker runs per job)
+    /// @param path Path to the model file
+    [[nodiscard]] static PreparedModel prepareModel(const std::string& path);
+
+private:
+    mutable std::mutex mutex;
+    std::condition_variable_any workAvailable;
+    std::deque<std::string> queue;
+    std::deque<PreparedModel> prepared;
+    size_t inFlight{0};
+
+    // Declared last so workers stop before the queues they use are destroyed
+    std::vector<std::jthread> workers;
+
+    void workerLoop(std::stop_token stopToken);
+};
+
+} // namespace project
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <raylib.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace project {
+
+/// Read-only view of a whole file, memory-mapped where the platform allows it
+/// Falls back to reading the file into memory on platforms without mmap
+class MappedFile {
+public:
+    /// Map a file
+    /// @param path Path to the file
+    /// @return The mapping, or nullptr if the file is missing, empty or cannot be mapped
+    [[nodiscard]] static std::unique_ptr<MappedFile> open(const std::string& path);
+
+    ~MappedFile();
+
+    // Rule of Five: disable copy and move (baked meshes point into the mapping)
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&&) = delete;
+    MappedFile& operator=(MappedFile&&) = delete;
+
+    [[nodiscard]] const unsigned char* data() const noexcept { return bytes; }
+    [[nodiscard]] size_t size() const noexcept { return byteCount; }
+
+private:
+    MappedFile() = default;
+
+    unsigned char* bytes{nullptr};
+    size_t byteCount{0};
+    std::vector<unsigned char> fallback;  // Owns the bytes when the file could not be mapped
+};
+
+/// On-disk layout of a baked model (little-endian, every offset from the start of the file)
+///
+/// Mesh attributes are stored exactly as raylib's Mesh arrays hold them, so the runtime
+/// points the Mesh at the mapped bytes and UploadMesh streams them to the GPU with no parse
+/// or copy. Arrays start on kAlignment boundaries.
+namespace baked {
+    constexpr std::uint32_t kMagic = 0x4B424C52;  // "RLBK"
+    constexpr std::uint32_t kVersion = 1;
+    constexpr size_t kAlignment = 16;
+
+    /// Mesh attribute streams, in the order of MeshRecord::attributeOffsets
+    enum Attribute : std::uint32_t {
+        Vertices,    // float x3
+        Texcoords,   // float x2
+        Texcoords2,  // float x2
+        Normals,     // float x3
+        Tangents,    // float x4
+        Colors,      // unsigned char x4
+        AttributeCount
+    };
+
+    struct FileHeader {
+        std::uint32_t magic{kMagic};
+        std::uint32_t version{kVersion};
+        std::uint64_t sourceHash{0};      // AssetCache::hashBytes of the source file; stale bakes are ignored
+        std::uint32_t meshCount{0};
+        std::uint32_t materialCount{0};   // Including raylib's default material 0
+        std::uint32_t hullPointCount{0};
+        std::uint32_t stringBytes{0};
+        Matrix transform{};
+        BoundingBox bounds{};             // Model-space AABB, as GetModelBoundingBox returns it
+        std::uint64_t meshTableOffset{0};
+        std::uint64_t materialTableOffset{0};
+        std::uint64_t hullOffset{0};      // Vector3 x hullPointCount, simplified convex hull
+        std::uint64_t stringOffset{0};
+    };
+
+    struct MeshRecord {
+        std::uint32_t vertexCount{0};
+        std::uint32_t triangleCount{0};
+        std::uint32_t materialIndex{0};
+        std::uint32_t reserved{0};
+        std::uint64_t attributeOffsets[AttributeCount]{};  // 0 if the mesh has no such stream
+        std::uint64_t indicesOffset{0};                    // unsigned short x triangleCount * 3, 0 if unindexed
+    };
+
+    struct MaterialRecord {
+        Color albedoColor{WHITE};
+        std::uint32_t albedoPathOffset{0};  // Into the string table
+        std::uint32_t albedoPathLength{0};  // 0 if untextured; path is relative to the baked file
+    };
+
+    static_assert(std::is_trivially_copyable_v<FileHeader>);
+    static_assert(std::is_trivially_copyable_v<MeshRecord>);
+    static_assert(std::is_trivially_copyable_v<MaterialRecord>);
+} // namespace baked
+
+/// A baked model file mapped into memory: GPU-ready mesh streams, precomputed bounds,
+/// collision hull points and albedo texture references
+///
+/// Produced offline by the asset baker (tools/) next to the source file (see getBakedPath);
+/// AssetCache prefers it over the glTF loader when its source hash matches.
+class BakedModel {
+public:
+    /// Map and validate a baked file
+    /// @param path Path to the baked file
+    /// @return The baked model, or nullptr if missing, truncated or of another version
+    [[nodiscard]] static std::shared_ptr<const BakedModel> open(const std::string& path);
+
+    /// Get the path the baker writes for a source model (the source path plus ".bake")
+    [[nodiscard]] static std::string getBakedPath(const std::string& sourcePath);
+
+    /// Write a baked file for a loaded model
+    /// @param path Output path
+    /// @param model Loaded model with CPU-side mesh data (skinned models are rejected)
+    /// @param sourceHash AssetCache::hashBytes of the source file
+    /// @param albedoPaths Albedo texture path per material, relative to the output file (empty: untextured)
+    /// @param hullPoints Simplified convex hull in model space (may be empty)
+    /// @return False if the model cannot be baked or the file cannot be written
+    [[nodiscard]] static bool write(
+        const std::string& path,
+        const Model& model,
+        std::uint64_t sourceHash,
+        const std::vector<std::string>& albedoPaths,
+        std::span<const Vector3> hullPoints
+    );
+
+    /// Build and upload a raylib Model whose CPU arrays point into the mapping (GL thread)
+    /// The model must be released with releaseModel() while this BakedModel is alive
+    /// @param sharedAlbedo Already uploaded texture for materials referencing sharedAlbedoPath
+    ///        (not owned: detach it before releaseModel())
+    /// @param sharedAlbedoPath Resolved path sharedAlbedo was loaded from
+    [[nodiscard]] Model createModel(const Texture2D* sharedAlbedo = nullptr, const std::string& sharedAlbedoPath = {}) const;
+
+    /// Unload a model from createModel() without freeing the mapped arrays
+    static void releaseModel(Model& model);
+
+    [[nodiscard]] std::uint64_t getSourceHash() const noexcept { return header.sourceHash; }
+    [[nodiscard]] BoundingBox getBounds() const noexcept { return header.bounds; }
+    [[nodiscard]] std::span<const Vector3> getHullPoints() const noexcept { return hullPoints; }
+    [[nodiscard]] size_t getMaterialCount() const noexcept { return header.materialCount; }
+
+    /// Get the resolved albedo texture path of a material (empty if untextured)
+    [[nodiscard]] std::string getAlbedoPath(size_t materialIndex) const;
+
+private:
+    BakedModel() = default;
+
+    std::unique_ptr<MappedFile> file;
+    std::string directory;  // Albedo paths are relative to it
+    baked::FileHeader header{};
+    std::span<const baked::MeshRecord> meshes;
+    std::span<const baked::MaterialRecord> materials;
+    std::span<const Vector3> hullPoints;
+    const char* strings{nullptr};
+};
+
+} // namespace project
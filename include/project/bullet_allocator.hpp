@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+
+namespace project {
+
+/// Process-wide size-class allocator behind Bullet's btAlignedAlloc
+///
+/// Bullet allocates collision shapes, rigid bodies, broadphase proxies, contact manifolds and
+/// every btAlignedObjectArray through btAlignedAlloc. Routing it to size-class free lists
+/// (carved from 64 KiB slabs) turns those small, bursty allocations into free-list pops
+/// instead of malloc calls. Large requests still go to malloc.
+///
+/// Bullet keeps a single global hook, so this is a static facade rather than an object.
+/// The allocator is thread-safe (one lock per size class) for the multithreaded world.
+class BulletAllocator {
+public:
+    BulletAllocator() = delete;
+
+    /// Allocation statistics
+    struct Stats {
+        size_t bytesInUse{0};        // Bytes handed out to Bullet (requested sizes)
+        size_t peakBytesInUse{0};    // High-water mark of bytesInUse since install() or resetPeak()
+        size_t liveAllocations{0};   // Allocations not yet freed
+        size_t reservedBytes{0};     // Slab memory held by the size classes
+        size_t largeAllocations{0};  // Live allocations served by malloc directly
+        size_t totalAllocations{0};  // Allocations made since install() (for allocation rates)
+    };
+
+    /// Install the allocator with btAlignedAllocSetCustom
+    /// Idempotent. Must run before Bullet allocates anything, since blocks allocated by the
+    /// default allocator cannot be freed by this one.
+    static void install();
+
+    /// Check if install() has run
+    [[nodiscard]] static bool isInstalled() noexcept;
+
+    /// Get a snapshot of the allocation statistics
+    [[nodiscard]] static Stats getStats() noexcept;
+
+    /// Restart the high-water mark from the current usage
+    static void resetPeak() noexcept;
+};
+
+} // namespace project
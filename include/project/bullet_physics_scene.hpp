@@ -3,73 +3,308 @@
 #include <project/scene_strategy.hpp>
 #include <project/ecs_components.hpp>
 #include <project/ecs_systems.hpp>
+#include <project/entity_name_index.hpp>
+#include <project/asset_cache.hpp>
+#include <project/debris_system.hpp>
+#include <project/debug_draw.hpp>
+#include <project/instanced_renderer.hpp>
+#include <project/physics_threading.hpp>
+#include <project/physics_world.hpp>
+#include <project/render_snapshot.hpp>
+#include <project/shape_cache.hpp>
+#include <project/static_batch.hpp>
+#include <project/system_scheduler.hpp>
+#include <project/task_pool.hpp>
 #include <entt/entt.hpp>
 #include <raylib.h>
-
-// Forward declarations for Bullet Physics
-class btDiscreteDynamicsWorld;
-class btCollisionDispatcher;
-class btDbvtBroadphase;
-class btSequentialImpulseConstraintSolver;
-class btDefaultCollisionConfiguration;
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
 
 namespace project {
 
+/// One entity for BulletPhysicsScene::spawnEntities
+struct EntitySpawn {
+    BodySpawn body;
+    std::int32_t modelIndex{-1};  // Into the models span passed alongside (-1 for no Renderable)
+    Color color{WHITE};
+};
+
 /// Scene demonstrating Bullet Physics integration with raylib using ECS
 /// Features falling boxes, a ground plane, and real-time physics simulation
 class BulletPhysicsScene : public SceneStrategy {
 public:
-    BulletPhysicsScene();
+    /// @param assetCache Cache used to share models between entities and scenes (must outlive the scene)
+    explicit BulletPhysicsScene(AssetCache& assetCache);
     ~BulletPhysicsScene() override;
     
-    // Rule of Five: disable copy, allow move
+    // Rule of Five: disable copy and move (the physics world points into the registry)
     BulletPhysicsScene(const BulletPhysicsScene&) = delete;
     BulletPhysicsScene& operator=(const BulletPhysicsScene&) = delete;
-    BulletPhysicsScene(BulletPhysicsScene&&) noexcept = default;
-    BulletPhysicsScene& operator=(BulletPhysicsScene&&) noexcept = default;
+    BulletPhysicsScene(BulletPhysicsScene&&) = delete;
+    BulletPhysicsScene& operator=(BulletPhysicsScene&&) = delete;
     
     void update() override;
     void draw() const override;
     [[nodiscard]] const char* getName() const override { return "Bullet Physics Scene (ECS)"; }
     void initialize() override;
     void cleanup() override;
+    void preload() override;
+    [[nodiscard]] size_t getMemoryEstimate() const override;
+    void reportMemory(MemoryTracker& tracker) override;
+    [[nodiscard]] bool supportsPipelining() const override { return true; }
+    void updateMainThread() override;
+    void simulate(float deltaTime) override;
+    void publishFrame() override;
+    
+    /// Get the fixed-step configuration (editable at runtime, e.g. from the GUI)
+    [[nodiscard]] PhysicsStepConfig& getStepConfig() noexcept { return physicsWorld.getStepConfig(); }
+    
+    /// Get the fixed-step statistics from the last update
+    [[nodiscard]] const PhysicsStepState& getStepState() const noexcept { return physicsWorld.getStepState(); }
+    
+    /// Get the entities whose transforms physics changed during the last update
+    /// Sleeping and static bodies are never listed, so consumers can skip them as well
+    [[nodiscard]] const std::vector<entt::entity>& getMovedEntities() const noexcept { return physicsWorld.getMovedEntities(); }
+    
+    /// Remember the current body and transform state (replaces any saved state)
+    void saveState() { physicsWorld.captureSnapshot(savedState); }
+    
+    /// Return bodies and transforms to the saved state without rebuilding the world
+    /// @return False if no state was saved since the scene was initialized
+    bool restoreState();
+    
+    /// Get the saved state (empty if none)
+    [[nodiscard]] const PhysicsSnapshot& getSavedState() const noexcept { return savedState; }
+    
+    /// Create many physics entities at once (bodies through PhysicsWorld::createBodies)
+    /// @param spawns Entity descriptors
+    /// @param shapes Shapes referenced by BodySpawn::shapeIndex
+    /// @param models Models referenced by EntitySpawn::modelIndex
+    /// @param entities Receives the created entities in descriptor order, entt::null for spawns
+    ///                 PhysicsWorld::createBodies skipped (nullptr if not needed)
+    void spawnEntities(
+        std::span<const EntitySpawn> spawns,
+        std::span<const ShapeHandle> shapes,
+        std::span<const ModelHandle> models,
+        std::vector<entt::entity>* entities = nullptr
+    );
+    
+    /// Drop layers of boxes over the ground (for stress testing with thousands of bodies)
+    /// @param count Number of boxes
+    void spawnBoxes(size_t count);
+    
+    /// Get the number of rigid bodies in the scene
+    [[nodiscard]] size_t getBodyCount() const noexcept { return physicsWorld.getBodyCount(); }
+    
+    /// Get raycasts, overlaps and nearest-entity queries over the scene's bodies
+    [[nodiscard]] SpatialQuery getSpatialQuery() const noexcept { return physicsWorld.getSpatialQuery(); }
+    
+    /// Get the dynamics world backend the scene builds
+    [[nodiscard]] PhysicsBackend getPhysicsBackend() const noexcept { return physicsWorld.getPhysicsBackend(); }
+    
+    /// Select the dynamics world backend (rebuilds the world if the scene is running)
+    /// Falls back to single-threaded if multithreading is not compiled in
+    void setPhysicsBackend(PhysicsBackend backend);
+    
+    /// Get the task scheduler used by the multithreaded backend
+    [[nodiscard]] TaskSchedulerKind getTaskScheduler() const noexcept { return physicsWorld.getTaskScheduler(); }
+    
+    /// Select the task scheduler for the multithreaded backend (applied immediately if active)
+    /// @return False if the scheduler is not available in this build
+    bool setTaskScheduler(TaskSchedulerKind kind) { return physicsWorld.setTaskScheduler(kind); }
+    
+    /// Get the drawn/culled counts from the last draw
+    [[nodiscard]] const CullingStats& getCullingStats() const noexcept { return cullingStats; }
+    
+    /// Get the instanced draw counters from the last draw (entities and debris)
+    [[nodiscard]] const InstancingStats& getInstancingStats() const noexcept { return instancingStats; }
+    
+    /// Get the merged static geometry
+    [[nodiscard]] const StaticBatch& getStaticBatch() const noexcept { return staticBatch; }
+    
+    /// Throw debris pieces out from the car (or the origin before it loaded)
+    /// @param count Number of pieces
+    /// @param speed Initial speed of the fastest pieces
+    void spawnDebris(size_t count, float speed);
+    
+    /// Get the debris pieces (piece count, tuning)
+    [[nodiscard]] DebrisSystem& getDebris() noexcept { return debris; }
+    
+    /// Check if debris near the camera is turned into rigid bodies
+    [[nodiscard]] bool isDebrisPromotionEnabled() const noexcept { return debrisPromotionEnabled; }
+    
+    /// Enable or disable promoting debris near the camera to rigid bodies
+    void setDebrisPromotionEnabled(bool enabled) noexcept { debrisPromotionEnabled = enabled; }
+    
+    /// Get the number of debris pieces promoted to rigid bodies since initialize()
+    [[nodiscard]] size_t getPromotedDebrisCount() const noexcept { return promotedDebrisCount; }
+    
+    /// Find a named entity, e.g. "character-a" or "car-sedan" (entt::null if none)
+    [[nodiscard]] entt::entity findEntityByName(std::string_view name) const { return entityNames.find(name); }
+    
+    /// Check if frustum culling is applied when drawing
+    [[nodiscard]] bool isFrustumCullingEnabled() const noexcept { return frustumCullingEnabled; }
+    
+    /// Enable or disable frustum culling (e.g. to compare costs from the debug panel)
+    void setFrustumCullingEnabled(bool enabled) noexcept { frustumCullingEnabled = enabled; }
+    
+    /// Get the systems run by update(), with the stages they were grouped into
+    [[nodiscard]] const SystemScheduler& getSystemScheduler() const noexcept { return systemScheduler; }
+    
+    /// Get the number of worker threads available to the systems
+    [[nodiscard]] size_t getSystemWorkerCount() const noexcept { return taskPool.getWorkerCount(); }
+    
+    /// Check if entities with a Lod chain switch levels by projected size
+    [[nodiscard]] bool isLodEnabled() const noexcept { return lodEnabled; }
+    
+    /// Enable or disable level-of-detail selection (disabled: always full detail)
+    void setLodEnabled(bool enabled) noexcept { lodEnabled = enabled; }
+    
+    /// Get the multiplier applied to projected sizes before picking a level
+    [[nodiscard]] float getLodBias() const noexcept { return lodBias; }
+    
+    /// Set the multiplier applied to projected sizes (> 1 keeps full detail further away)
+    void setLodBias(float bias) noexcept { lodBias = bias; }
+    
+    /// Get the debug visuals to draw (editable at runtime; everything is off by default)
+    [[nodiscard]] DebugDrawSettings& getDebugDrawSettings() noexcept { return debugDrawSettings; }
+    
+    /// Get the number of debug lines drawn by the last frame
+    [[nodiscard]] size_t getDebugLineCount() const noexcept {
+        return (drawFromSnapshot ? renderSnapshots[frontSnapshot].debugLines : debugLines).getLineCount();
+    }
 
 private:
     // ECS registry
     entt::registry registry;
     
-    // Bullet Physics world components
-    btDiscreteDynamicsWorld* dynamicsWorld{nullptr};
-    btCollisionDispatcher* dispatcher{nullptr};
-    btDbvtBroadphase* overlappingPairCache{nullptr};
-    btSequentialImpulseConstraintSolver* constraintSolver{nullptr};
-    btDefaultCollisionConfiguration* collisionConfiguration{nullptr};
+    // Bullet world, pooled bodies and shapes; declared after the registry so it is destroyed
+    // first and can still remove its PhysicsBody components
+    PhysicsWorld physicsWorld{registry};
+    
+    // Shared model storage (not owned)
+    AssetCache* assetCache{nullptr};
+    
+    // Per-frame systems and the threads they share; the pool outlives the scheduler's tasks
+    TaskPool taskPool;
+    SystemScheduler systemScheduler;
+    
+    // Per-frame draw batching; mutable because batches are rebuilt inside draw() const
+    mutable InstancedRenderer instancedRenderer;
+    
+    // Ground and other static renderables, merged; rebuilt when static entities come or go
+    StaticBatch staticBatch;
+    
+    // Name component lookup, kept in sync by the registry's Name signals
+    EntityNameIndex entityNames{registry};
+    
+    // Crash debris without bodies; integrated by the "Debris" system alongside physics
+    // Pieces near the camera are queued in pendingPromotions and become bodies on the main thread
+    DebrisSystem debris;
+    std::vector<DebrisDrawBatch> debrisBatches;  // Drawn when not pipelined (the snapshot has its own)
+    std::vector<ModelRequestHandle> debrisRequests;
+    std::vector<DebrisPromotion> pendingPromotions;
+    bool debrisPromotionEnabled{true};
+    size_t promotedDebrisCount{0};
+    Vector3 promotionCenter{0.0F, 0.0F, 0.0F};               // Camera position the simulation promotes around
+    mutable Vector3 drawnCameraPosition{0.0F, 0.0F, 0.0F};  // Recorded by draw(), read between frames
+    
+    // Debug overlays, collected after each step (into the snapshot when pipelined)
+    DebugDrawSettings debugDrawSettings;
+    BulletDebugDrawer bulletDebugDrawer;
+    DebugLines debugLines;                        // Drawn when not pipelined
+    mutable DebugLineRenderer debugLineRenderer;  // Mutable because its buffer is filled inside draw() const
+    
+    // Culling and draw counters; mutable because they are filled inside draw() const
+    mutable CullingStats cullingStats;
+    mutable InstancingStats instancingStats;
+    bool frustumCullingEnabled{true};
+    bool lodEnabled{true};
+    float lodBias{1.0F};
     
     bool isInitialized{false};
     
+    // Pipelined mode: simulate() captures into the back snapshot while draw() shows the front one
+    // frameDeltaTime is the time the current step simulates (read by the physics system)
+    std::array<RenderSnapshot, 2> renderSnapshots;
+    size_t frontSnapshot{0};
+    bool drawFromSnapshot{false};
+    float frameDeltaTime{0.0F};
+    
+    /// Entity creation waiting for a streamed model; the placeholder is drawn meanwhile
+    using SpawnFunction = void (BulletPhysicsScene::*)(ModelHandle);
+    struct PendingSpawn {
+        ModelRequestHandle request;
+        entt::entity placeholder{entt::null};
+        SpawnFunction spawn{nullptr};
+    };
+    std::vector<PendingSpawn> pendingSpawns;
+    
+    // State captured by saveState(); entity ids are only meaningful until cleanup()
+    PhysicsSnapshot savedState;
+    
+    // Requests started by preload(), held so the models stream in before initialize()
+    std::vector<ModelRequestHandle> preloadRequests;
+    
+    // Scratch storage reused by spawnEntities()
+    std::vector<BodySpawn> spawnBodies;
+    std::vector<entt::entity> spawnedEntities;
+    
     // Helper functions
-    void setupPhysicsWorld();
+    void registerSystems();
+    
+    /// Draw the front snapshot (pipelined mode; the registry may be mid-step)
+    void drawSnapshot() const;
     void createGroundPlane();
-    void createFallingBoxes();
     void createCharacter();
     void createCar();
-    void cleanupPhysicsWorld();
+    void spawnCharacter(ModelHandle characterModel);
+    void spawnCar(ModelHandle carModel);
+    
+    /// Put a box on the car's roof as a hierarchy child
+    /// @param roofY Top of the car model, relative to its origin
+    void attachRoofCargo(entt::entity carEntity, float roofY);
+    
+    /// Run spawn once the request is ready (immediately if the model is already cached)
+    /// @param request Model request from the AssetCache
+    /// @param groundPosition Where the placeholder stands until then
+    /// @param spawn Member function creating the real entity from the model
+    void spawnWhenLoaded(ModelRequestHandle request, const Vector3& groundPosition, SpawnFunction spawn);
+    
+    /// Replace placeholders whose requests completed
+    void processPendingSpawns();
+    
+    /// Register the debris models that finished streaming in
+    void processDebrisRequests();
+    
+    /// Collect the enabled debug visuals of the current state (clears lines first)
+    void collectDebugLines(DebugLines& lines);
+    
+    /// Queue the debris near the camera for promotion (bounded by the promoted total)
+    void collectDebrisPromotions();
+    
+    /// Create rigid bodies for the queued debris promotions
+    void spawnPromotedDebris();
+    
+    /// StaticMesh construct/destroy listener: the static batch has to be rebuilt
+    void onStaticMeshChanged(entt::registry& owner, entt::entity entity);
     
     /// Helper to create a physics entity with all necessary components
     /// @param position Initial position
-    /// @param collisionShape Bullet collision shape (ownership transferred)
+    /// @param collisionShape Shared collision shape from the world's ShapeCache
     /// @param mass Mass of the body (0 for static)
-    /// @param hasModel Whether a model is provided
-    /// @param model Raylib model (only used if hasModel is true)
+    /// @param model Shared model handle (nullptr for no Renderable)
     /// @param color Color for rendering
     /// @param isGround Whether this is a ground entity
     /// @return The created entity
     entt::entity createPhysicsEntity(
         const Vector3& position,
-        btCollisionShape* collisionShape,
+        ShapeHandle collisionShape,
         float mass,
-        bool hasModel,
-        const Model& model,
+        ModelHandle model,
         const Color& color,
         bool isGround
     );
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <project/asset_cache.hpp>
+#include <project/instanced_renderer.hpp>
+#include <raylib.h>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <vector>
+
+namespace project {
+
+/// Tuning for DebrisSystem
+struct DebrisSettings {
+    float gravity{9.81F};
+    float groundY{0.0F};      // Height of the ground plane pieces bounce on
+    float restitution{0.3F};  // Fraction of vertical speed kept per bounce
+    float friction{0.7F};     // Fraction of horizontal speed and spin kept per ground contact
+    float lifetime{10.0F};    // Seconds before a piece disappears
+};
+
+/// A debris piece handed over to the rigid body simulation
+struct DebrisPromotion {
+    std::uint32_t type{0};  // Index from DebrisSystem::addType
+    Vector3 position{0.0F, 0.0F, 0.0F};
+    Quaternion rotation{0.0F, 0.0F, 0.0F, 1.0F};
+    Vector3 velocity{0.0F, 0.0F, 0.0F};
+    Vector3 angularVelocity{0.0F, 0.0F, 0.0F};  // Radians per second
+};
+
+/// World matrices of every piece of one debris type, ready for instanced drawing
+struct DebrisDrawBatch {
+    ModelHandle model;
+    std::vector<Matrix> matrices;
+};
+
+/// Lightweight debris for crash effects: bolts, plates, tires and the like, without bodies
+///
+/// Pieces are kept per type in structure-of-arrays streams and integrated as simple
+/// ballistic motion with a bounce off a flat ground plane, four pieces at a time with SSE2
+/// or NEON (see simd_lanes.hpp). There is no collision between pieces. Motion advances in
+/// fixed steps, so the per-step spin of each piece is a constant quaternion.
+///
+/// Pieces can be promoted to real rigid bodies (promoteNear) where the player can touch
+/// them; the caller creates the bodies. Rendering goes through InstancedRenderer, one
+/// batch per type.
+///
+/// Not thread-safe; update() may run on any one thread at a time.
+class DebrisSystem {
+public:
+    /// Register a kind of piece
+    /// @param model Model drawn for the pieces
+    /// @param bounds Model-space bounds (the piece rests on the ground at its smallest half extent)
+    /// @return Type index for DebrisPromotion::type
+    std::uint32_t addType(ModelHandle model, const BoundingBox& bounds);
+
+    /// Get the number of registered types
+    [[nodiscard]] size_t getTypeCount() const noexcept { return groups.size(); }
+
+    /// Get the model of a type
+    [[nodiscard]] const ModelHandle& getTypeModel(std::uint32_t type) const { return groups[type].model; }
+
+    /// Get the model-space bounds of a type
+    [[nodiscard]] const BoundingBox& getTypeBounds(std::uint32_t type) const { return groups[type].bounds; }
+
+    /// Throw pieces out from a point, spread over every registered type
+    /// @param origin Where the pieces start
+    /// @param count Number of pieces
+    /// @param speed Initial speed (each piece gets 50-100% of it, mostly upwards)
+    void spawnBurst(const Vector3& origin, size_t count, float speed);
+
+    /// Advance every piece and drop the expired ones
+    /// @param deltaTime Seconds since the last update (run as fixed steps)
+    void update(float deltaTime);
+
+    /// Remove the pieces within a radius and report them for promotion to rigid bodies
+    /// @param center Usually the camera position
+    /// @param radius Distance within which pieces are promoted
+    /// @param maxCount Promote at most this many
+    /// @param promotions Receives the removed pieces (appended)
+    void promoteNear(const Vector3& center, float radius, size_t maxCount, std::vector<DebrisPromotion>& promotions);
+
+    /// Compose the world matrix of every piece, one batch per type
+    /// @param batches Filled in place; the storage is reused across calls
+    void buildDrawBatches(std::vector<DebrisDrawBatch>& batches) const;
+
+    /// Submit and flush the batches from buildDrawBatches (one draw per piece without instancing)
+    static void draw(std::span<const DebrisDrawBatch> batches, InstancedRenderer& renderer);
+
+    /// Remove every piece (types stay registered)
+    void clearPieces() noexcept;
+
+    /// Remove every piece and type
+    void clear() noexcept;
+
+    /// Get the number of live pieces
+    [[nodiscard]] size_t getPieceCount() const noexcept;
+
+    /// Get the bytes reserved by the piece streams (capacity, not just live pieces)
+    [[nodiscard]] size_t getReservedBytes() const noexcept;
+
+    /// Get the tuning (editable at runtime)
+    [[nodiscard]] DebrisSettings& getSettings() noexcept { return settings; }
+
+private:
+    enum Stream : size_t {
+        PositionX, PositionY, PositionZ,
+        VelocityX, VelocityY, VelocityZ,
+        RotationX, RotationY, RotationZ, RotationW,
+        SpinX, SpinY, SpinZ, SpinW,  // Rotation applied every step
+        Age,
+        StreamCount
+    };
+
+    struct Group {
+        ModelHandle model;
+        BoundingBox bounds{};
+        float radius{0.0F};  // Resting height of the origin above the ground
+        std::array<std::vector<float>, StreamCount> streams;
+
+        [[nodiscard]] size_t size() const noexcept { return streams[Age].size(); }
+
+        /// Remove piece index by moving the last piece into its place
+        void swapRemove(size_t index);
+    };
+
+    std::vector<Group> groups;
+    DebrisSettings settings;
+    std::mt19937 random{std::mt19937::default_seed};
+    float accumulator{0.0F};
+
+    void step(Group& group, float stepTime) const;
+};
+
+} // namespace project
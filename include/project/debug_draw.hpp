@@ -0,0 +1,131 @@
+#pragma once
+
+#include <btBulletDynamicsCommon.h>
+#include <raylib.h>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace project {
+
+/// Which debug visuals are collected (editable at runtime, e.g. from the GUI)
+/// With everything off nothing is collected, uploaded or drawn
+struct DebugDrawSettings {
+    bool bounds{false};           // Cached world bounds of the renderables (WorldBounds)
+    bool collisionShapes{false};  // Wireframes of Bullet's collision shapes
+    bool aabbs{false};            // Broadphase bounds of the collision objects
+    bool contacts{false};         // Contact points and their normals
+    bool markers{false};          // Entities without a model, and an empty scene's origin
+
+    [[nodiscard]] bool isAnyEnabled() const noexcept { return bounds || markers || usesBullet(); }
+
+    /// Check if Bullet's debug drawing has to run
+    [[nodiscard]] bool usesBullet() const noexcept { return collisionShapes || aabbs || contacts; }
+};
+
+/// One end of a debug line, laid out as the line shader reads it
+struct DebugVertex {
+    Vector3 position;
+    Color color;
+};
+
+/// Debug lines of one frame
+///
+/// Collected wherever the state they show is safe to read (the simulation thread in pipelined
+/// mode) and drawn by DebugLineRenderer. The storage is reused across frames.
+class DebugLines {
+public:
+    /// Remove every line (keeps the storage)
+    void clear() noexcept { vertices.clear(); }
+
+    /// Add a line segment
+    void addLine(const Vector3& from, const Vector3& to, Color color);
+
+    /// Add the twelve edges of a box
+    void addBox(const BoundingBox& box, Color color);
+
+    /// Add three axis-aligned lines crossing at a point
+    /// @param size Length of each line
+    void addCross(const Vector3& center, float size, Color color);
+
+    /// Get both ends of every line, in order
+    [[nodiscard]] std::span<const DebugVertex> getVertices() const noexcept { return vertices; }
+
+    /// Get the number of lines
+    [[nodiscard]] size_t getLineCount() const noexcept { return vertices.size() / 2; }
+
+    [[nodiscard]] bool empty() const noexcept { return vertices.empty(); }
+
+private:
+    std::vector<DebugVertex> vertices;
+};
+
+/// Bullet debug drawer that appends the world's wireframes, AABBs and contacts to DebugLines
+class BulletDebugDrawer final : public btIDebugDraw {
+public:
+    /// Run the world's debug drawing for the enabled categories
+    /// The drawer is attached to the world only for the duration of the call
+    /// @param world World to draw (must not be stepping)
+    /// @param settings Categories to draw (only the Bullet ones are used)
+    /// @param lines Receives the lines (appended)
+    void collect(btCollisionWorld& world, const DebugDrawSettings& settings, DebugLines& lines);
+
+    void drawLine(const btVector3& from, const btVector3& to, const btVector3& color) override;
+    void drawContactPoint(
+        const btVector3& pointOnB,
+        const btVector3& normalOnB,
+        btScalar distance,
+        int lifeTime,
+        const btVector3& color
+    ) override;
+    void reportErrorWarning(const char* warningString) override;
+    void draw3dText(const btVector3& location, const char* textString) override;
+    void setDebugMode(int debugMode) override { mode = debugMode; }
+    [[nodiscard]] int getDebugMode() const override { return mode; }
+
+private:
+    DebugLines* target{nullptr};
+    int mode{DBG_NoDebug};
+};
+
+/// Draws DebugLines in a single call from one dynamic vertex buffer
+///
+/// The buffer grows to the largest frame seen and is re-filled every draw. Where the line
+/// shader or glDrawArrays is not available (web builds), lines go through rlgl's batch instead.
+/// GL thread only.
+class DebugLineRenderer {
+public:
+    DebugLineRenderer() = default;
+    ~DebugLineRenderer();
+
+    // Rule of Five: disable copy and move (owns GPU buffers)
+    DebugLineRenderer(const DebugLineRenderer&) = delete;
+    DebugLineRenderer& operator=(const DebugLineRenderer&) = delete;
+    DebugLineRenderer(DebugLineRenderer&&) = delete;
+    DebugLineRenderer& operator=(DebugLineRenderer&&) = delete;
+
+    /// Draw the lines with the current camera (call inside BeginMode3D)
+    /// Does no GL work at all when lines is empty
+    void draw(const DebugLines& lines);
+
+    /// Release the shader and buffers (created again on the next draw)
+    void unload();
+
+private:
+    Shader shader{};
+    unsigned int vertexArray{0};
+    unsigned int vertexBuffer{0};
+    size_t bufferCapacity{0};  // In vertices
+    bool initialized{false};
+    bool supported{false};     // Shader and entry points available; otherwise rlgl's batch is used
+
+    void initialize();
+
+    /// Make the vertex buffer hold at least vertexCount vertices
+    /// @return False if vertex arrays are not supported (supported is cleared)
+    bool reserve(size_t vertexCount);
+
+    static void drawImmediate(std::span<const DebugVertex> vertices);
+};
+
+} // namespace project
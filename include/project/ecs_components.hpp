@@ -1,11 +1,16 @@
 #pragma once
 
+#include <project/asset_cache.hpp>
+#include <project/object_pool.hpp>
+#include <project/shape_cache.hpp>
 #include <entt/entt.hpp>
 #include <raylib.h>
 #include <raymath.h>
 #include <btBulletDynamicsCommon.h>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace project {
 
@@ -16,10 +21,100 @@ struct Transform {
     Vector3 scale{1.0F, 1.0F, 1.0F};
     
     /// Get transformation matrix
+    /// Same result as MatrixScale * QuaternionToMatrix * MatrixTranslate, written out
+    /// directly instead of as two full 4x4 products (TransformPool vectorizes the same terms)
     [[nodiscard]] Matrix getMatrix() const {
-        return MatrixScale(scale.x, scale.y, scale.z) *
-               QuaternionToMatrix(rotation) *
-               MatrixTranslate(position.x, position.y, position.z);
+        const float xx = rotation.x * rotation.x;
+        const float yy = rotation.y * rotation.y;
+        const float zz = rotation.z * rotation.z;
+        const float xy = rotation.x * rotation.y;
+        const float xz = rotation.x * rotation.z;
+        const float yz = rotation.y * rotation.z;
+        const float wx = rotation.w * rotation.x;
+        const float wy = rotation.w * rotation.y;
+        const float wz = rotation.w * rotation.z;
+        
+        // Fields in raylib order: m0, m4, m8, m12, m1, ... (columns are scaled basis vectors)
+        return Matrix{
+            (1.0F - 2.0F * (yy + zz)) * scale.x, 2.0F * (xy - wz) * scale.y, 2.0F * (xz + wy) * scale.z, position.x,
+            2.0F * (xy + wz) * scale.x, (1.0F - 2.0F * (xx + zz)) * scale.y, 2.0F * (yz - wx) * scale.z, position.y,
+            2.0F * (xz - wy) * scale.x, 2.0F * (yz + wx) * scale.y, (1.0F - 2.0F * (xx + yy)) * scale.z, position.z,
+            0.0F, 0.0F, 0.0F, 1.0F
+        };
+    }
+};
+
+/// Previous transform component: physics state before the latest fixed step
+/// Rendering blends from this to Transform so motion stays smooth when the
+/// simulation rate differs from the frame rate
+struct PreviousTransform {
+    Vector3 position{0.0F, 0.0F, 0.0F};
+    Quaternion rotation{0.0F, 0.0F, 0.0F, 1.0F};
+};
+
+/// Entities whose rigid bodies Bullet moved during the current step
+/// Filled by EntityMotionState and drained by PhysicsSystem after every step
+struct MovedBodyList {
+    std::vector<entt::entity> entities;
+};
+
+/// Motion state that reports its entity to a MovedBodyList whenever Bullet moves the body
+/// Bullet only calls setWorldTransform for active dynamic bodies, so static and sleeping
+/// bodies never show up in the list. Callbacks come from the stepping thread in both the
+/// single- and multithreaded worlds (synchronizeMotionStates runs serially).
+class EntityMotionState : public btDefaultMotionState {
+public:
+    /// Create a motion state for an entity
+    /// @param startTransform Initial world transform of the body
+    /// @param entity Entity owning the body
+    /// @param movedBodies List to report moves to (not owned, must outlive the body)
+    EntityMotionState(const btTransform& startTransform, entt::entity entity, MovedBodyList* movedBodies)
+        : btDefaultMotionState(startTransform)
+        , entity(entity)
+        , movedBodies(movedBodies) {}
+    
+    void setWorldTransform(const btTransform& centerOfMassWorldTrans) override {
+        btDefaultMotionState::setWorldTransform(centerOfMassWorldTrans);
+        if (!queued && movedBodies != nullptr) {
+            movedBodies->entities.push_back(entity);
+            queued = true;
+        }
+    }
+    
+    /// Get the entity owning the body
+    [[nodiscard]] entt::entity getEntity() const noexcept { return entity; }
+    
+    /// Allow the next setWorldTransform to report the entity again (called once it was synced)
+    void clearQueued() noexcept { queued = false; }
+    
+    /// Mark the body as synced during a frame
+    /// @return True the first time it is called for a given frame index
+    bool markMovedInFrame(std::uint64_t frameIndex) noexcept {
+        if (lastMovedFrame == frameIndex) {
+            return false;
+        }
+        lastMovedFrame = frameIndex;
+        return true;
+    }
+    
+private:
+    entt::entity entity{entt::null};
+    MovedBodyList* movedBodies{nullptr};
+    std::uint64_t lastMovedFrame{0};
+    bool queued{false};
+};
+
+/// Per-scene storage for rigid bodies and motion states
+/// Spawning reuses pooled slots; the scene releases all chunks at once on cleanup
+struct PhysicsBodyPool {
+    ObjectPool<btRigidBody> rigidBodies;
+    ObjectPool<EntityMotionState> motionStates;
+    
+    /// Free the pooled memory (only succeeds once every body has been destroyed)
+    bool releaseMemory() noexcept {
+        const bool bodiesReleased = rigidBodies.releaseMemory();
+        const bool statesReleased = motionStates.releaseMemory();
+        return bodiesReleased && statesReleased;
     }
 };
 
@@ -27,25 +122,32 @@ struct Transform {
 /// Manages the lifetime of Bullet Physics objects
 struct PhysicsBody {
     btRigidBody* rigidBody{nullptr};
-    btCollisionShape* collisionShape{nullptr};
-    btDefaultMotionState* motionState{nullptr};
+    ShapeHandle collisionShape;  // Shared with every body of the same shape (see ShapeCache)
+    EntityMotionState* motionState{nullptr};
+    PhysicsBodyPool* pool{nullptr};  // Owner of rigidBody and motionState (nullptr: allocated with new)
     float mass{0.0F};
     bool isStatic{false};
     
     /// Cleanup Bullet Physics objects
     void cleanup() {
         if (rigidBody != nullptr) {
-            delete rigidBody;
+            if (pool != nullptr) {
+                pool->rigidBodies.destroy(rigidBody);
+            } else {
+                delete rigidBody;
+            }
             rigidBody = nullptr;
         }
         if (motionState != nullptr) {
-            delete motionState;
+            if (pool != nullptr) {
+                pool->motionStates.destroy(motionState);
+            } else {
+                delete motionState;
+            }
             motionState = nullptr;
         }
-        if (collisionShape != nullptr) {
-            delete collisionShape;
-            collisionShape = nullptr;
-        }
+        // Released last: the rigid body references the shape until it is destroyed
+        collisionShape.reset();
     }
     
     ~PhysicsBody() {
@@ -57,12 +159,12 @@ struct PhysicsBody {
     PhysicsBody& operator=(const PhysicsBody&) = delete;
     PhysicsBody(PhysicsBody&& other) noexcept
         : rigidBody(other.rigidBody)
-        , collisionShape(other.collisionShape)
+        , collisionShape(std::move(other.collisionShape))
         , motionState(other.motionState)
+        , pool(other.pool)
         , mass(other.mass)
         , isStatic(other.isStatic) {
         other.rigidBody = nullptr;
-        other.collisionShape = nullptr;
         other.motionState = nullptr;
     }
     
@@ -70,12 +172,12 @@ struct PhysicsBody {
         if (this != &other) {
             cleanup();
             rigidBody = other.rigidBody;
-            collisionShape = other.collisionShape;
+            collisionShape = std::move(other.collisionShape);
             motionState = other.motionState;
+            pool = other.pool;
             mass = other.mass;
             isStatic = other.isStatic;
             other.rigidBody = nullptr;
-            other.collisionShape = nullptr;
             other.motionState = nullptr;
         }
         return *this;
@@ -85,50 +187,79 @@ struct PhysicsBody {
 };
 
 /// Renderable component: visual representation of an entity
+/// Holds a shared handle from the AssetCache, so destroying the entity only drops a reference
 struct Renderable {
-    Model model{};
+    ModelHandle model;
     Color color{WHITE};
     bool hasModel{false};
-    
-    /// Cleanup raylib model
-    void cleanup() {
-        if (hasModel) {
-            UnloadModel(model);
-            hasModel = false;
-        }
-    }
-    
-    ~Renderable() {
-        cleanup();
-    }
-    
-    // Rule of Five: disable copy, allow move
-    Renderable(const Renderable&) = delete;
-    Renderable& operator=(const Renderable&) = delete;
-    Renderable(Renderable&& other) noexcept
-        : model(other.model)
-        , color(other.color)
-        , hasModel(other.hasModel) {
-        other.hasModel = false;
-    }
-    
-    Renderable& operator=(Renderable&& other) noexcept {
-        if (this != &other) {
-            cleanup();
-            model = other.model;
-            color = other.color;
-            hasModel = other.hasModel;
-            other.hasModel = false;
-        }
-        return *this;
-    }
-    
-    Renderable() = default;
 };
 
+/// Level-of-detail chain of an entity's renderable (Renderable.model stays level 0)
+/// RenderSystem picks the level from the projected size whenever it draws the entity
+struct Lod {
+    LodHandle model;
+    mutable std::uint8_t level{0};  // Level drawn last frame, for hysteresis (updated while drawing)
+};
+
+/// Model-space bounding box of an entity's renderable, computed once when the model is loaded
+struct LocalBounds {
+    BoundingBox box{};
+};
+
+/// World-space bounding box used for culling; refreshed only when the transform changes
+/// Covers both the previous and current physics pose, so interpolated draws stay inside it
+struct WorldBounds {
+    BoundingBox box{};
+};
+
+/// Tag component: WorldBounds must be recomputed (new entities, transforms edited outside physics)
+struct BoundsDirty {};
+
+/// Parent link of a hierarchy child (managed by HierarchySystem::attach/detach)
+/// The child's Transform is derived from its parent's Transform and its LocalTransform
+struct Parent {
+    entt::entity entity{entt::null};
+    std::uint32_t depth{1};  // Distance from the root; Parent storage is kept sorted by it
+};
+
+/// Direct children of a hierarchy node (managed by HierarchySystem::attach/detach)
+struct Children {
+    std::vector<entt::entity> entities;
+};
+
+/// Pose of a hierarchy child relative to its parent
+/// The matrix is rebuilt only when the child itself is HierarchyDirty (attach or
+/// setLocalTransform), not every time its parent moves
+struct LocalTransform {
+    Transform transform;
+    Matrix matrix{MatrixIdentity()};  // transform.getMatrix()
+};
+
+/// World matrix of a hierarchy node, cached until the node or one of its ancestors moves
+/// For children, the local matrix times the parent's world matrix
+struct WorldMatrix {
+    Matrix matrix{MatrixIdentity()};
+};
+
+/// Pose of a hierarchy root when its subtree was last updated
+/// Compared every update, so moves by physics, snapshots or gameplay code all reach the children
+struct HierarchyRoot {
+    Transform transform;
+    PreviousTransform previous;
+};
+
+/// Tag component: the node's world pose (and that of its subtree) must be recomputed
+struct HierarchyDirty {};
+
 /// Ground tag component: marks an entity as ground/static surface
 struct Ground {};
 
+/// Tag component: the renderable never moves and is drawn from its scene's StaticBatch
+/// (merged, pre-transformed vertex buffers) instead of one draw per entity
+/// The scene listens for this tag being added or removed (destroyed entities included) and
+/// rebuilds its batch on the next update
+struct StaticMesh {};
+
 /// Name component: optional identifier for entities
 struct Name {
     std::string value;
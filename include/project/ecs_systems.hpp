@@ -1,47 +1,195 @@
 #pragma once
 
 #include <project/ecs_components.hpp>
+#include <project/frustum.hpp>
+#include <project/instanced_renderer.hpp>
+#include <project/lod.hpp>
+#include <project/profiler.hpp>
+#include <project/render_snapshot.hpp>
+#include <project/system_scheduler.hpp>
+#include <project/transform_pool.hpp>
 #include <entt/entt.hpp>
 #include <btBulletDynamicsCommon.h>
 #include <raymath.h>
+#include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <cstdint>
+#include <utility>
+#include <vector>
 
 namespace project {
 
-/// Physics system: synchronizes Bullet Physics transforms to Transform components
+/// Fixed-step configuration for PhysicsSystem::update
+struct PhysicsStepConfig {
+    float stepRate{60.0F};              // Simulation steps per second
+    int maxSubSteps{4};                 // Upper bound on steps taken in one frame
+    float maxSimulationBudgetMs{8.0F};  // Wall-clock budget per frame; time beyond it is dropped
+};
+
+/// Accumulator state carried between frames by PhysicsSystem::update
+struct PhysicsStepState {
+    float accumulator{0.0F};          // Simulated time owed, in seconds
+    float interpolationAlpha{1.0F};   // Blend factor from PreviousTransform to Transform
+    int stepsLastFrame{0};            // Fixed steps taken during the last update
+    float droppedTimeLastFrame{0.0F}; // Seconds discarded because of the step cap or budget
+};
+
+/// Dirty-set state for transform sync, carried between steps by PhysicsSystem::update
+/// Motion states report into movedBodies; only those entities are copied back to the ECS,
+/// so sleeping and static bodies cost nothing per step
+struct PhysicsSyncState {
+    MovedBodyList movedBodies;                 // Reported by EntityMotionState during the current step
+    std::vector<entt::entity> movedLastStep;   // Synced after the previous step
+    std::vector<entt::entity> movedThisFrame;  // Every entity synced during the last update (no duplicates)
+    std::uint64_t frameIndex{0};               // Incremented per update, used to dedupe movedThisFrame
+    
+    /// Start a new update: movedThisFrame collects the entities synced from now on
+    void beginFrame() {
+        ++frameIndex;
+        movedThisFrame.clear();
+    }
+    
+    /// Forget all tracked entities (e.g. when the world is rebuilt)
+    void reset() {
+        movedBodies.entities.clear();
+        movedLastStep.clear();
+        movedThisFrame.clear();
+    }
+};
+
+/// Entities per parallel chunk in the systems below; smaller lists stay on the calling thread
+inline constexpr size_t kSystemGrainSize = 512;
+
+/// Per-frame culling counters filled by RenderSystem
+struct CullingStats {
+    size_t drawn{0};   // Entities submitted (including those without bounds)
+    size_t culled{0};  // Entities skipped because their bounds were outside the frustum
+    
+    void reset() noexcept {
+        drawn = 0;
+        culled = 0;
+    }
+};
+
+/// Physics system: steps Bullet Physics at a fixed rate and synchronizes transforms
 class PhysicsSystem {
 public:
-    /// Update physics simulation and sync transforms
+    /// Advance the simulation by whole fixed steps and sync transforms
+    /// If the frame cannot catch up (step cap or time budget reached), the owed time is
+    /// dropped so the simulation slows down instead of stalling subsequent frames
     /// @param registry The ECS registry
     /// @param dynamicsWorld The Bullet Physics dynamics world
     /// @param deltaTime Time since last frame
-    static void update(entt::registry& registry, btDiscreteDynamicsWorld* dynamicsWorld, float deltaTime) {
-        if (dynamicsWorld == nullptr) {
+    /// @param config Step rate, substep cap and time budget
+    /// @param state Accumulator state (updated in place)
+    /// @param sync Dirty-set state; movedThisFrame lists the entities that moved this update
+    /// @param taskPool Threads for the transform sync (nullptr: calling thread only)
+    static void update(
+        entt::registry& registry,
+        btDiscreteDynamicsWorld* dynamicsWorld,
+        float deltaTime,
+        const PhysicsStepConfig& config,
+        PhysicsStepState& state,
+        PhysicsSyncState& sync,
+        TaskPool* taskPool = nullptr
+    ) {
+        PROJECT_PROFILE_SCOPE("PhysicsSystem::update");
+        
+        if (dynamicsWorld == nullptr || config.stepRate <= 0.0F) {
             return;
         }
         
-        // Step the physics simulation
-        constexpr float kFixedTimeStep = 1.0F / 60.0F;
-        constexpr int kMaxSubSteps = 10;
-        dynamicsWorld->stepSimulation(deltaTime, kMaxSubSteps);
+        sync.beginFrame();
         
-        // Sync Bullet Physics transforms to Transform components
-        auto view = registry.view<Transform, PhysicsBody>();
-        for (auto entity : view) {
-            auto& transform = view.get<Transform>(entity);
-            const auto& physicsBody = view.get<PhysicsBody>(entity);
+        // Clamp long hitches (debugger breaks, window drags) before they enter the accumulator
+        constexpr float kMaxFrameTime = 0.25F;
+        const float fixedTimeStep = 1.0F / config.stepRate;
+        state.accumulator += std::clamp(deltaTime, 0.0F, kMaxFrameTime);
+        state.stepsLastFrame = 0;
+        state.droppedTimeLastFrame = 0.0F;
+        
+        const auto budget = std::chrono::duration<float, std::milli>(config.maxSimulationBudgetMs);
+        const auto startTime = std::chrono::steady_clock::now();
+        
+        while (state.accumulator >= fixedTimeStep && state.stepsLastFrame < config.maxSubSteps) {
+            // Always take at least one step so the simulation never freezes entirely
+            if (state.stepsLastFrame > 0 && std::chrono::steady_clock::now() - startTime > budget) {
+                break;
+            }
             
-            if (physicsBody.rigidBody == nullptr) {
-                continue;
+            // maxSubSteps = 0 makes Bullet take exactly one step of the given size
+            {
+                PROJECT_PROFILE_SCOPE("btDynamicsWorld::stepSimulation");
+                dynamicsWorld->stepSimulation(fixedTimeStep, 0);
+            }
+            syncTransforms(registry, sync, taskPool);
+            
+            state.accumulator -= fixedTimeStep;
+            ++state.stepsLastFrame;
+        }
+        
+        // Degrade gracefully: drop whole steps we could not afford, keep the fractional remainder
+        if (state.accumulator >= fixedTimeStep) {
+            const float remainder = std::fmod(state.accumulator, fixedTimeStep);
+            state.droppedTimeLastFrame = state.accumulator - remainder;
+            state.accumulator = remainder;
+        }
+        
+        state.interpolationAlpha = state.accumulator / fixedTimeStep;
+    }
+    
+    /// Sync the bodies Bullet moved during the last step to their Transform components
+    /// Also shifts PreviousTransform forward, including for bodies that just stopped moving
+    /// (fell asleep), so they don't keep blending from a stale pose
+    /// @param registry The ECS registry
+    /// @param sync Dirty-set state filled by EntityMotionState during the step
+    /// @param taskPool Threads to split the per-body copies over (nullptr: calling thread only)
+    static void syncTransforms(entt::registry& registry, PhysicsSyncState& sync, TaskPool* taskPool = nullptr) {
+        PROJECT_PROFILE_SCOPE("PhysicsSystem::syncTransforms");
+        
+        // Storage is looked up once up front; the per-body work below may run on several
+        // threads and only touches the components of its own entity
+        auto& transforms = registry.storage<Transform>();
+        auto& previousTransforms = registry.storage<PreviousTransform>();
+        auto& physicsBodies = registry.storage<PhysicsBody>();
+        
+        // Bodies that moved last step: previous = current. Those moving again are
+        // overwritten below with the same value, those that stopped now rest in place
+        parallelForEntities(sync.movedLastStep, taskPool, kSystemGrainSize, [&](entt::entity entity) {
+            if (previousTransforms.contains(entity) && transforms.contains(entity)) {
+                auto& previous = previousTransforms.get(entity);
+                const auto& transform = transforms.get(entity);
+                previous.position = transform.position;
+                previous.rotation = transform.rotation;
+            }
+        });
+        
+        // Bookkeeping stays serial: it appends to the shared moved list
+        auto& movedBodies = sync.movedBodies.entities;
+        std::erase_if(movedBodies, [&](entt::entity entity) {
+            if (!transforms.contains(entity) || !physicsBodies.contains(entity) || physicsBodies.get(entity).motionState == nullptr) {
+                return true;
+            }
+            EntityMotionState& motionState = *physicsBodies.get(entity).motionState;
+            motionState.clearQueued();
+            if (motionState.markMovedInFrame(sync.frameIndex)) {
+                sync.movedThisFrame.push_back(entity);
+            }
+            return false;
+        });
+        
+        parallelForEntities(movedBodies, taskPool, kSystemGrainSize, [&](entt::entity entity) {
+            auto& transform = transforms.get(entity);
+            if (previousTransforms.contains(entity)) {
+                auto& previous = previousTransforms.get(entity);
+                previous.position = transform.position;
+                previous.rotation = transform.rotation;
             }
             
             // Get transform from Bullet
             btTransform bulletTransform;
-            if (physicsBody.rigidBody->getMotionState() != nullptr) {
-                physicsBody.rigidBody->getMotionState()->getWorldTransform(bulletTransform);
-            } else {
-                bulletTransform = physicsBody.rigidBody->getWorldTransform();
-            }
+            physicsBodies.get(entity).motionState->getWorldTransform(bulletTransform);
             
             // Convert Bullet position to raylib
             const btVector3& origin = bulletTransform.getOrigin();
@@ -52,91 +200,686 @@ public:
             };
             
             // Convert Bullet quaternion to raylib (Bullet: w, x, y, z; raylib: x, y, z, w)
-            const btQuaternion& bulletQuat = bulletTransform.getRotation();
+            const btQuaternion bulletQuat = bulletTransform.getRotation();
             transform.rotation = Quaternion{
                 static_cast<float>(bulletQuat.x()),
                 static_cast<float>(bulletQuat.y()),
                 static_cast<float>(bulletQuat.z()),
                 static_cast<float>(bulletQuat.w())
             };
+        });
+        
+        // The list of this step becomes "last step"; swapping keeps both buffers allocated
+        std::swap(sync.movedLastStep, sync.movedBodies.entities);
+        sync.movedBodies.entities.clear();
+    }
+};
+
+/// Hierarchy system: derives the Transform of child entities from their parents
+///
+/// Children carry a Parent link and a LocalTransform; the root of each tree carries Children
+/// and HierarchyRoot. Only dirty subtrees are recomputed: a root is dirty when its pose
+/// changed since the last update, a child when its LocalTransform was set or its parent was
+/// recomputed. Parent storage is sorted by depth, so one pass in storage order reaches every
+/// parent before its children.
+///
+/// Poses are composed as position/rotation/scale, so the result stays a valid Transform for
+/// rendering, culling and interpolation. This is exact unless a non-uniformly scaled parent
+/// has rotated children (the shear is dropped; WorldMatrix keeps it). Children should not
+/// have dynamic rigid bodies, since physics and the hierarchy would both move them.
+class HierarchySystem {
+public:
+    /// Attach an entity to a parent (detaching it from its current parent first)
+    /// @param registry The ECS registry
+    /// @param child Entity to attach; gets a Transform if it has none
+    /// @param parent New parent (must have a Transform)
+    /// @param local Pose of the child relative to the parent
+    /// @return False if the link would make the entity its own ancestor (nothing changes)
+    static bool attach(entt::registry& registry, entt::entity child, entt::entity parent, const Transform& local) {
+        if (!registry.valid(child) || !registry.valid(parent) || !registry.all_of<Transform>(parent)) {
+            return false;
+        }
+        for (entt::entity node = parent; node != entt::null;) {
+            if (node == child) {
+                return false;
+            }
+            const auto* link = registry.try_get<Parent>(node);
+            node = (link != nullptr) ? link->entity : entt::null;
+        }
+        
+        detach(registry, child);
+        
+        const auto* parentLink = registry.try_get<Parent>(parent);
+        const std::uint32_t depth = (parentLink != nullptr) ? parentLink->depth + 1 : 1;
+        if (parentLink == nullptr && !registry.all_of<HierarchyRoot>(parent)) {
+            const Transform& parentTransform = registry.get<Transform>(parent);
+            auto& root = registry.emplace<HierarchyRoot>(parent);
+            root.transform = parentTransform;
+            if (const auto* previous = registry.try_get<PreviousTransform>(parent); previous != nullptr) {
+                root.previous = *previous;
+            }
+            registry.emplace_or_replace<WorldMatrix>(parent, parentTransform.getMatrix());
+        }
+        
+        registry.get_or_emplace<Children>(parent).entities.push_back(child);
+        registry.emplace<Parent>(child, parent, depth);
+        registry.emplace_or_replace<LocalTransform>(child, local);
+        registry.get_or_emplace<Transform>(child);
+        registry.get_or_emplace<WorldMatrix>(child);
+        
+        // Interpolated parents need interpolated children, or the parts drift apart between steps
+        if (registry.all_of<PreviousTransform>(parent)) {
+            registry.get_or_emplace<PreviousTransform>(child);
+        }
+        
+        // A former root brings its subtree along one level deeper
+        if (registry.remove<HierarchyRoot>(child) > 0) {
+            for (const auto grandchild : registry.get<Children>(child).entities) {
+                setDepth(registry, grandchild, depth + 1);
+            }
+        }
+        
+        registry.emplace_or_replace<HierarchyDirty>(child);
+        return true;
+    }
+    
+    /// Detach an entity from its parent; it keeps its current world pose
+    /// @param registry The ECS registry
+    /// @param child Entity to detach (ignored if it has no parent)
+    static void detach(entt::registry& registry, entt::entity child) {
+        const auto* link = registry.try_get<Parent>(child);
+        if (link == nullptr) {
+            return;
+        }
+        
+        const entt::entity parent = link->entity;
+        if (auto* siblings = registry.try_get<Children>(parent); siblings != nullptr) {
+            std::erase(siblings->entities, child);
+            if (siblings->entities.empty()) {
+                registry.remove<Children>(parent);
+                if (registry.remove<HierarchyRoot>(parent) > 0) {
+                    registry.remove<WorldMatrix>(parent);
+                }
+            }
+        }
+        
+        registry.remove<Parent, LocalTransform>(child);
+        if (!registry.all_of<PhysicsBody>(child)) {
+            registry.remove<PreviousTransform>(child);  // Only the hierarchy kept it up to date
+        }
+        
+        // With children of its own, the entity now roots a tree
+        if (const auto* children = registry.try_get<Children>(child); children != nullptr) {
+            for (const auto grandchild : children->entities) {
+                setDepth(registry, grandchild, 1);
+            }
+            auto& root = registry.emplace<HierarchyRoot>(child);
+            root.transform = registry.get<Transform>(child);
+            registry.emplace_or_replace<HierarchyDirty>(child);
+        } else {
+            registry.remove<WorldMatrix>(child);
+        }
+    }
+    
+    /// Change a child's pose relative to its parent (applied with its subtree on the next update)
+    /// @param registry The ECS registry
+    /// @param child Entity with a parent
+    /// @param local New pose relative to the parent
+    static void setLocalTransform(entt::registry& registry, entt::entity child, const Transform& local) {
+        if (auto* localTransform = registry.try_get<LocalTransform>(child); localTransform != nullptr) {
+            localTransform->transform = local;
+            registry.emplace_or_replace<HierarchyDirty>(child);
+        }
+    }
+    
+    /// Recompute the world poses of every dirty subtree
+    /// Run after physics and before BoundsSystem, so moved children get fresh bounds
+    /// @param registry The ECS registry
+    static void update(entt::registry& registry) {
+        PROJECT_PROFILE_SCOPE("HierarchySystem::update");
+        
+        // Whatever moved a root since the last update, its subtree follows
+        auto rootView = registry.view<HierarchyRoot, const Transform>();
+        for (auto entity : rootView) {
+            auto& root = rootView.get<HierarchyRoot>(entity);
+            const auto& transform = rootView.get<Transform>(entity);
+            const auto* previous = registry.try_get<PreviousTransform>(entity);
+            if (isSamePose(root.transform, transform) &&
+                (previous == nullptr || isSamePose(root.previous, *previous))) {
+                continue;
+            }
+            
+            root.transform = transform;
+            if (previous != nullptr) {
+                root.previous = *previous;
+            }
+            registry.get_or_emplace<WorldMatrix>(entity).matrix = transform.getMatrix();
+            registry.emplace_or_replace<HierarchyDirty>(entity);
+        }
+        
+        if (registry.storage<HierarchyDirty>().empty()) {
+            return;
+        }
+        
+        sortByDepth(registry);
+        
+        // A recomputed child is tagged too, which is how the change reaches its own children
+        // Until then, a child's own tag means its LocalTransform changed
+        for (auto entity : registry.view<const Parent>()) {
+            const entt::entity parent = registry.get<Parent>(entity).entity;
+            const bool localChanged = registry.all_of<HierarchyDirty>(entity);
+            if (localChanged || (registry.valid(parent) && registry.all_of<HierarchyDirty>(parent))) {
+                refresh(registry, entity, parent, localChanged);
+                registry.emplace_or_replace<HierarchyDirty>(entity);
+            }
+        }
+        
+        registry.clear<HierarchyDirty>();
+    }
+    
+    /// Compose a pose relative to a parent with the parent's world pose
+    /// @param parent World pose of the parent
+    /// @param local Pose relative to the parent
+    /// @return World pose
+    [[nodiscard]] static Transform compose(const Transform& parent, const Transform& local) {
+        Transform world;
+        world.position = Vector3Add(
+            parent.position,
+            Vector3RotateByQuaternion(Vector3Multiply(parent.scale, local.position), parent.rotation)
+        );
+        world.rotation = QuaternionMultiply(parent.rotation, local.rotation);
+        world.scale = Vector3Multiply(parent.scale, local.scale);
+        return world;
+    }
+
+private:
+    static void refresh(entt::registry& registry, entt::entity entity, entt::entity parent, bool localChanged) {
+        auto& localTransform = registry.get<LocalTransform>(entity);
+        if (localChanged) {
+            localTransform.matrix = localTransform.transform.getMatrix();
+        }
+        
+        // Children of a destroyed parent keep their last pose
+        const auto* parentTransform = registry.valid(parent) ? registry.try_get<Transform>(parent) : nullptr;
+        if (parentTransform == nullptr) {
+            return;
+        }
+        
+        const Transform& local = localTransform.transform;
+        Transform& transform = registry.get<Transform>(entity);
+        transform = compose(*parentTransform, local);
+        
+        // Parents are refreshed first, so their world matrix is current
+        const Matrix& parentMatrix = registry.get<WorldMatrix>(parent).matrix;
+        registry.get<WorldMatrix>(entity).matrix = MatrixMultiply(localTransform.matrix, parentMatrix);
+        
+        if (auto* previous = registry.try_get<PreviousTransform>(entity); previous != nullptr) {
+            Transform previousWorld = transform;
+            if (const auto* parentPrevious = registry.try_get<PreviousTransform>(parent); parentPrevious != nullptr) {
+                Transform parentPose = *parentTransform;
+                parentPose.position = parentPrevious->position;
+                parentPose.rotation = parentPrevious->rotation;
+                previousWorld = compose(parentPose, local);
+            }
+            previous->position = previousWorld.position;
+            previous->rotation = previousWorld.rotation;
+        }
+        
+        if (registry.all_of<LocalBounds>(entity)) {
+            registry.emplace_or_replace<BoundsDirty>(entity);
+        }
+    }
+    
+    static void setDepth(entt::registry& registry, entt::entity entity, std::uint32_t depth) {
+        registry.get<Parent>(entity).depth = depth;
+        if (const auto* children = registry.try_get<Children>(entity); children != nullptr) {
+            for (const auto child : children->entities) {
+                setDepth(registry, child, depth + 1);
+            }
         }
     }
+    
+    /// Restore depth order after attach/detach (a no-op scan when nothing changed)
+    static void sortByDepth(entt::registry& registry) {
+        std::uint32_t lastDepth = 0;
+        for (auto entity : registry.view<const Parent>()) {
+            const std::uint32_t depth = registry.get<Parent>(entity).depth;
+            if (depth < lastDepth) {
+                registry.sort<Parent>([](const Parent& lhs, const Parent& rhs) { return lhs.depth < rhs.depth; });
+                return;
+            }
+            lastDepth = depth;
+        }
+    }
+    
+    // Exact comparisons: any change at all has to reach the children
+    [[nodiscard]] static bool isSamePose(const Transform& lhs, const Transform& rhs) {
+        return isSame(lhs.position, rhs.position) && isSame(lhs.rotation, rhs.rotation) && isSame(lhs.scale, rhs.scale);
+    }
+    
+    [[nodiscard]] static bool isSamePose(const PreviousTransform& lhs, const PreviousTransform& rhs) {
+        return isSame(lhs.position, rhs.position) && isSame(lhs.rotation, rhs.rotation);
+    }
+    
+    [[nodiscard]] static bool isSame(const Vector3& lhs, const Vector3& rhs) {
+        return lhs.x == rhs.x && lhs.y == rhs.y && lhs.z == rhs.z;
+    }
+    
+    [[nodiscard]] static bool isSame(const Quaternion& lhs, const Quaternion& rhs) {
+        return lhs.x == rhs.x && lhs.y == rhs.y && lhs.z == rhs.z && lhs.w == rhs.w;
+    }
+};
+
+/// Bounds system: keeps WorldBounds in sync with LocalBounds and Transform
+/// World bounds are only recomputed for entities tagged BoundsDirty or moved by physics,
+/// so static and sleeping entities cost nothing per frame
+class BoundsSystem {
+public:
+    /// Refresh world bounds of dirty entities and of entities whose transforms changed
+    /// @param registry The ECS registry
+    /// @param movedEntities Entities moved by physics this update (PhysicsSyncState::movedThisFrame)
+    /// @param taskPool Threads to split the moved entities over (nullptr: calling thread only)
+    static void update(entt::registry& registry, const std::vector<entt::entity>& movedEntities, TaskPool* taskPool = nullptr) {
+        PROJECT_PROFILE_SCOPE("BoundsSystem::update");
+        
+        auto dirtyView = registry.view<const LocalBounds, const Transform, const BoundsDirty>();
+        for (auto entity : dirtyView) {
+            registry.emplace_or_replace<WorldBounds>(entity, computeWorldBounds(registry, entity));
+        }
+        registry.clear<BoundsDirty>();
+        
+        // Moved entities were drawn before, so they almost always have WorldBounds already;
+        // the rare ones without get it here, and the parallel pass only overwrites boxes
+        auto& worldBounds = registry.storage<WorldBounds>();
+        const auto& localBounds = registry.storage<LocalBounds>();
+        const auto& transforms = registry.storage<Transform>();
+        for (auto entity : movedEntities) {
+            if (!worldBounds.contains(entity) && localBounds.contains(entity) && transforms.contains(entity)) {
+                worldBounds.emplace(entity);
+            }
+        }
+        
+        parallelForEntities(movedEntities, taskPool, kSystemGrainSize, [&](entt::entity entity) {
+            if (worldBounds.contains(entity) && localBounds.contains(entity) && transforms.contains(entity)) {
+                worldBounds.get(entity).box = computeWorldBounds(registry, entity);
+            }
+        });
+    }
+    
+    /// Transform a box and return the axis-aligned box enclosing the result (Arvo's method)
+    /// @param box Local-space box
+    /// @param matrix Local-to-world matrix
+    /// @return World-space axis-aligned box
+    [[nodiscard]] static BoundingBox transformBounds(const BoundingBox& box, const Matrix& matrix) {
+        const Vector3 center = Vector3Scale(Vector3Add(box.min, box.max), 0.5F);
+        const Vector3 extent = Vector3Scale(Vector3Subtract(box.max, box.min), 0.5F);
+        
+        const Vector3 worldCenter = Vector3Transform(center, matrix);
+        const Vector3 worldExtent{
+            (std::fabs(matrix.m0) * extent.x) + (std::fabs(matrix.m4) * extent.y) + (std::fabs(matrix.m8) * extent.z),
+            (std::fabs(matrix.m1) * extent.x) + (std::fabs(matrix.m5) * extent.y) + (std::fabs(matrix.m9) * extent.z),
+            (std::fabs(matrix.m2) * extent.x) + (std::fabs(matrix.m6) * extent.y) + (std::fabs(matrix.m10) * extent.z)
+        };
+        
+        return BoundingBox{Vector3Subtract(worldCenter, worldExtent), Vector3Add(worldCenter, worldExtent)};
+    }
+
+private:
+    /// Compute the world box of an entity with LocalBounds and Transform (reads only, so it is
+    /// safe to call for different entities in parallel)
+    [[nodiscard]] static BoundingBox computeWorldBounds(const entt::registry& registry, entt::entity entity) {
+        const BoundingBox& localBox = registry.get<LocalBounds>(entity).box;
+        const Transform& transform = registry.get<Transform>(entity);
+        BoundingBox worldBox = transformBounds(localBox, transform.getMatrix());
+        
+        // Interpolated draws blend from the previous pose, so cover that one too
+        if (const auto* previous = registry.try_get<PreviousTransform>(entity); previous != nullptr) {
+            Transform previousTransform = transform;
+            previousTransform.position = previous->position;
+            previousTransform.rotation = previous->rotation;
+            const BoundingBox previousBox = transformBounds(localBox, previousTransform.getMatrix());
+            worldBox.min = Vector3Min(worldBox.min, previousBox.min);
+            worldBox.max = Vector3Max(worldBox.max, previousBox.max);
+        }
+        return worldBox;
+    }
 };
 
 /// Render system: draws entities with Renderable components
 class RenderSystem {
 public:
-    /// Draw all renderable entities
+    /// Draw all renderable entities except ground and StaticMesh entities (see StaticBatch)
+    /// Uses one instanced draw per (mesh, material, tint) group when an instanced renderer
+    /// is available, otherwise falls back to one draw per mesh per entity
     /// @param registry The ECS registry
-    static void draw(const entt::registry& registry) {
-        auto view = registry.view<const Transform, const Renderable>();
+    /// @param instancedRenderer Batching renderer (nullptr or unsupported: per-entity path)
+    /// @param interpolationAlpha Blend from PreviousTransform to Transform (1 = latest physics state)
+    /// @param frustum Camera frustum; entities whose WorldBounds lie outside it are skipped (nullptr: no culling)
+    /// @param stats Culling counters to accumulate into (optional)
+    /// @param lodView Camera used to pick the level of entities with a Lod (nullptr: always level 0)
+    static void draw(
+        const entt::registry& registry,
+        InstancedRenderer* instancedRenderer = nullptr,
+        float interpolationAlpha = 1.0F,
+        const Frustum* frustum = nullptr,
+        CullingStats* stats = nullptr,
+        const LodView* lodView = nullptr
+    ) {
+        PROJECT_PROFILE_SCOPE("RenderSystem::draw");
+        
+        if (instancedRenderer != nullptr && instancedRenderer->isInstancingSupported()) {
+            drawInstanced(registry, *instancedRenderer, interpolationAlpha, frustum, stats, lodView);
+            return;
+        }
+        
+        // Without a renderer there is nowhere to keep the staging storage between frames
+        TransformPool localPool;
+        TransformPool& transformPool = (instancedRenderer != nullptr) ? instancedRenderer->getTransformPool() : localPool;
+        gatherTransforms(registry, transformPool, interpolationAlpha, frustum, stats);
+        
+        const auto entities = transformPool.getEntities();
+        const auto matrices = transformPool.getMatrices();
+        for (size_t i = 0; i < entities.size(); ++i) {
+            const auto& renderable = registry.get<Renderable>(entities[i]);
+            const Model& model = selectModel(registry, entities[i], renderable, matrices[i], lodView);
+            const Vector3& scale = registry.get<Transform>(entities[i]).scale;
+            if (scale.x > 0.0F && scale.y > 0.0F && scale.z > 0.0F) {
+                drawModel(model, matrices[i], renderable.color);
+            } else {
+                // Fallback for an invalid scale: unit scale and no rotation, as DrawModel does
+                drawModel(model, MatrixTranslate(matrices[i].m12, matrices[i].m13, matrices[i].m14), renderable.color);
+            }
+        }
+    }
+    
+    /// Draw all renderable entities through the instanced renderer
+    /// @param registry The ECS registry
+    /// @param instancedRenderer Batching renderer with instancing support
+    /// @param interpolationAlpha Blend from PreviousTransform to Transform (1 = latest physics state)
+    /// @param frustum Camera frustum used for culling (nullptr: no culling)
+    /// @param stats Culling counters to accumulate into (optional)
+    /// @param lodView Camera used to pick the level of entities with a Lod (nullptr: always level 0)
+    static void drawInstanced(
+        const entt::registry& registry,
+        InstancedRenderer& instancedRenderer,
+        float interpolationAlpha = 1.0F,
+        const Frustum* frustum = nullptr,
+        CullingStats* stats = nullptr,
+        const LodView* lodView = nullptr
+    ) {
+        PROJECT_PROFILE_SCOPE("RenderSystem::drawInstanced");
+        
+        instancedRenderer.begin();
+        
+        TransformPool& transformPool = instancedRenderer.getTransformPool();
+        gatherTransforms(registry, transformPool, interpolationAlpha, frustum, stats);
+        
+        // The matrices go straight to the GPU; no axis-angle round trip. Every LOD level has
+        // its own meshes, so each level fills its own batches
+        const auto entities = transformPool.getEntities();
+        const auto matrices = transformPool.getMatrices();
+        for (size_t i = 0; i < entities.size(); ++i) {
+            const auto& renderable = registry.get<Renderable>(entities[i]);
+            instancedRenderer.submit(selectModel(registry, entities[i], renderable, matrices[i], lodView), matrices[i], renderable.color);
+        }
+        
+        instancedRenderer.flush();
+    }
+    
+    /// Collect the poses of the visible renderables and compose their world matrices
+    /// @param registry The ECS registry
+    /// @param transformPool Receives the visible entities and their matrices (cleared first)
+    /// @param interpolationAlpha Blend from PreviousTransform to Transform (1 = latest physics state)
+    /// @param frustum Camera frustum used for culling (nullptr: no culling)
+    /// @param stats Culling counters to accumulate into (optional)
+    static void gatherTransforms(
+        const entt::registry& registry,
+        TransformPool& transformPool,
+        float interpolationAlpha,
+        const Frustum* frustum,
+        CullingStats* stats
+    ) {
+        PROJECT_PROFILE_SCOPE("RenderSystem::gatherTransforms");
+        
+        transformPool.clear();
+        
+        auto view = registry.view<const Transform, const Renderable>(entt::exclude<Ground, StaticMesh>);
+        transformPool.reserve(view.size_hint());
+        const bool interpolate = interpolationAlpha < 1.0F;
         
         for (auto entity : view) {
-            const auto& transform = view.get<Transform>(entity);
             const auto& renderable = view.get<Renderable>(entity);
             
-            if (!renderable.hasModel) {
+            if (!renderable.hasModel || !passesCulling(registry, entity, frustum, stats)) {
                 continue;
             }
             
-            // Convert quaternion to axis-angle for DrawModelEx
-            // Handle identity quaternion (0, 0, 0, 1) case
-            Vector3 rotationAxis{0.0F, 1.0F, 0.0F};  // Default to Y-axis
-            float rotationAngle = 0.0F;
+            const auto& transform = view.get<Transform>(entity);
+            const auto* previous = interpolate ? registry.try_get<PreviousTransform>(entity) : nullptr;
+            if (previous != nullptr) {
+                transformPool.push(entity, transform, *previous);
+            } else {
+                transformPool.push(entity, transform);
+            }
+        }
+        
+        transformPool.buildMatrices(interpolationAlpha);
+    }
+    
+    /// Pick the model to draw for an entity: the level of its Lod chain for the view, or the
+    /// renderable's model when it has no chain
+    /// @param registry The ECS registry
+    /// @param entity Entity being drawn
+    /// @param renderable Renderable of the entity
+    /// @param matrix World matrix the entity is drawn with
+    /// @param lodView Camera used for the selection (nullptr: renderable's model)
+    [[nodiscard]] static const Model& selectModel(
+        const entt::registry& registry,
+        entt::entity entity,
+        const Renderable& renderable,
+        const Matrix& matrix,
+        const LodView* lodView
+    ) {
+        const auto* lod = (lodView != nullptr) ? registry.try_get<Lod>(entity) : nullptr;
+        if (lod == nullptr || lod->model == nullptr || lod->model->levels.empty()) {
+            return *renderable.model;
+        }
+        
+        return selectLevel(*lod->model, registry.get<Transform>(entity).scale, matrix, *lodView, lod->level);
+    }
+    
+    /// Pick the level of a Lod chain from its projected size
+    /// @param chain Level-of-detail chain (at least one level)
+    /// @param scale Scale the entity is drawn with
+    /// @param matrix World matrix the entity is drawn with
+    /// @param lodView Camera used for the selection
+    /// @param level Level drawn last frame; receives the level picked now
+    [[nodiscard]] static const Model& selectLevel(
+        const LodModel& chain,
+        const Vector3& scale,
+        const Matrix& matrix,
+        const LodView& lodView,
+        std::uint8_t& level
+    ) {
+        const float maxScale = std::max({std::fabs(scale.x), std::fabs(scale.y), std::fabs(scale.z)});
+        const float screenSize = lodView.getScreenSize(Vector3Transform(chain.center, matrix), chain.radius * maxScale);
+        level = static_cast<std::uint8_t>(chain.selectLevel(screenSize, level));
+        return *chain.levels[level];
+    }
+    
+    /// Copy what drawing needs out of the registry, for RenderSystem::drawSnapshot
+    /// StaticMesh entities are left out; their StaticBatch does not change during a step
+    /// Runs at the end of a simulation step, on the thread that ran it
+    /// @param registry The ECS registry
+    /// @param interpolationAlpha Blend from PreviousTransform to Transform the frame is drawn with
+    /// @param snapshot Receives the renderables (cleared first; capacity is kept)
+    static void captureSnapshot(const entt::registry& registry, float interpolationAlpha, RenderSnapshot& snapshot) {
+        PROJECT_PROFILE_SCOPE("RenderSystem::captureSnapshot");
+        
+        snapshot.items.clear();
+        snapshot.interpolationAlpha = interpolationAlpha;
+        
+        auto view = registry.view<const Transform, const Renderable>(entt::exclude<StaticMesh>);
+        snapshot.items.reserve(view.size_hint());
+        
+        for (auto entity : view) {
+            const auto& renderable = view.get<Renderable>(entity);
+            if (!renderable.hasModel) {
+                continue;
+            }
             
-            const float quatLength = std::sqrt(
-                transform.rotation.x * transform.rotation.x +
-                transform.rotation.y * transform.rotation.y +
-                transform.rotation.z * transform.rotation.z
-            );
+            RenderItem& item = snapshot.items.emplace_back();
+            item.entity = entity;
+            item.model = renderable.model;
+            item.color = renderable.color;
+            item.transform = view.get<Transform>(entity);
+            item.isGround = registry.all_of<Ground>(entity);
+            if (const auto* previous = registry.try_get<PreviousTransform>(entity); previous != nullptr) {
+                item.previous = *previous;
+                item.hasPrevious = true;
+            }
+            if (const auto* bounds = registry.try_get<WorldBounds>(entity); bounds != nullptr) {
+                item.bounds = bounds->box;
+                item.hasBounds = true;
+            }
+            if (const auto* lod = registry.try_get<Lod>(entity); lod != nullptr && lod->model != nullptr && !lod->model->levels.empty()) {
+                item.lod = lod->model;
+                item.lodLevel = lod->level;
+            }
+        }
+    }
+    
+    /// Draw a captured frame; reads nothing but the snapshot, so the registry may be stepped meanwhile
+    /// Same output as drawGround followed by draw
+    /// @param snapshot Frame captured by captureSnapshot
+    /// @param instancedRenderer Batching renderer (per-entity draws when instancing is unsupported)
+    /// @param frustum Camera frustum; items whose bounds lie outside it are skipped (nullptr: no culling)
+    /// @param stats Culling counters to accumulate into (optional)
+    /// @param lodView Camera used to pick the level of items with a Lod chain (nullptr: always level 0)
+    static void drawSnapshot(
+        const RenderSnapshot& snapshot,
+        InstancedRenderer& instancedRenderer,
+        const Frustum* frustum = nullptr,
+        CullingStats* stats = nullptr,
+        const LodView* lodView = nullptr
+    ) {
+        PROJECT_PROFILE_SCOPE("RenderSystem::drawSnapshot");
+        
+        const bool instanced = instancedRenderer.isInstancingSupported();
+        if (instanced) {
+            instancedRenderer.begin();
+        }
+        
+        TransformPool& transformPool = instancedRenderer.getTransformPool();
+        transformPool.clear();
+        transformPool.reserve(snapshot.items.size());
+        snapshot.drawList.clear();
+        const bool interpolate = snapshot.interpolationAlpha < 1.0F;
+        
+        for (const RenderItem& item : snapshot.items) {
+            const bool visible = (frustum == nullptr) || !item.hasBounds || frustum->intersects(item.bounds);
+            if (stats != nullptr) {
+                ++(visible ? stats->drawn : stats->culled);
+            }
+            if (!visible) {
+                continue;
+            }
             
-            if (quatLength > 0.0001F) {  // Not identity quaternion
-                rotationAxis = Vector3Normalize(Vector3{
-                    transform.rotation.x,
-                    transform.rotation.y,
-                    transform.rotation.z
-                });
-                rotationAngle = 2.0F * acosf(std::clamp(transform.rotation.w, -1.0F, 1.0F));
+            if (item.isGround) {
+                DrawModelEx(*item.model, item.transform.position, Vector3{0.0F, 1.0F, 0.0F}, 0.0F, item.transform.scale, item.color);
+                continue;
             }
             
-            // Draw the model
-            // Use DrawModelEx with proper scale
-            const Vector3 scale = transform.scale;
-            if (scale.x > 0.0F && scale.y > 0.0F && scale.z > 0.0F) {
-                DrawModelEx(
-                    renderable.model,
-                    transform.position,
-                    rotationAxis,
-                    rotationAngle,
-                    scale,
-                    renderable.color
-                );
+            if (interpolate && item.hasPrevious) {
+                transformPool.push(item.entity, item.transform, item.previous);
             } else {
-                // Fallback to DrawModel if scale is invalid
-                DrawModel(renderable.model, transform.position, 1.0F, renderable.color);
+                transformPool.push(item.entity, item.transform);
             }
+            snapshot.drawList.push_back(&item);
+        }
+        
+        transformPool.buildMatrices(snapshot.interpolationAlpha);
+        
+        const auto matrices = transformPool.getMatrices();
+        for (size_t i = 0; i < snapshot.drawList.size(); ++i) {
+            const RenderItem& item = *snapshot.drawList[i];
+            const Model& model = (lodView != nullptr && item.lod != nullptr)
+                ? selectLevel(*item.lod, item.transform.scale, matrices[i], *lodView, item.lodLevel)
+                : *item.model;
             
-            // Draw wireframe for physics objects (optional visual aid)
-            // You can add a component to control this if needed
+            const Vector3& scale = item.transform.scale;
+            if (instanced) {
+                instancedRenderer.submit(model, matrices[i], item.color);
+            } else if (scale.x > 0.0F && scale.y > 0.0F && scale.z > 0.0F) {
+                drawModel(model, matrices[i], item.color);
+            } else {
+                drawModel(model, MatrixTranslate(matrices[i].m12, matrices[i].m13, matrices[i].m14), item.color);
+            }
+        }
+        
+        if (instanced) {
+            instancedRenderer.flush();
         }
     }
     
-    /// Draw ground entities with special handling
+    /// Draw every mesh of a model with a world matrix, tinted the way DrawModelEx tints
+    /// @param model Model to draw
+    /// @param matrix World matrix of the instance
+    /// @param tint Color multiplied with each material's diffuse color
+    static void drawModel(const Model& model, const Matrix& matrix, Color tint) {
+        const Matrix worldMatrix = MatrixMultiply(model.transform, matrix);
+        for (int i = 0; i < model.meshCount; ++i) {
+            // Materials are shared with the model, so tint in place and restore afterwards
+            Material& material = model.materials[model.meshMaterial[i]];
+            Color& diffuseColor = material.maps[MATERIAL_MAP_DIFFUSE].color;
+            const Color originalColor = diffuseColor;
+            diffuseColor = ColorTint(originalColor, tint);
+            DrawMesh(model.meshes[i], material, worldMatrix);
+            diffuseColor = originalColor;
+        }
+    }
+    
+    /// Check an entity's WorldBounds against the frustum and count the result
+    /// Entities without bounds are always drawn
+    /// @return True if the entity should be drawn
+    [[nodiscard]] static bool passesCulling(
+        const entt::registry& registry,
+        entt::entity entity,
+        const Frustum* frustum,
+        CullingStats* stats
+    ) {
+        const auto* bounds = (frustum != nullptr) ? registry.try_get<WorldBounds>(entity) : nullptr;
+        const bool visible = (bounds == nullptr) || frustum->intersects(bounds->box);
+        if (stats != nullptr) {
+            ++(visible ? stats->drawn : stats->culled);
+        }
+        return visible;
+    }
+    
+    /// Draw ground entities with special handling (StaticMesh ground is drawn by its StaticBatch)
     /// @param registry The ECS registry
-    static void drawGround(const entt::registry& registry) {
-        auto view = registry.view<const Transform, const Renderable, const Ground>();
+    /// @param frustum Camera frustum used for culling (nullptr: no culling)
+    /// @param stats Culling counters to accumulate into (optional)
+    static void drawGround(
+        const entt::registry& registry,
+        const Frustum* frustum = nullptr,
+        CullingStats* stats = nullptr
+    ) {
+        PROJECT_PROFILE_SCOPE("RenderSystem::drawGround");
+        
+        auto view = registry.view<const Transform, const Renderable, const Ground>(entt::exclude<StaticMesh>);
         
         for (auto entity : view) {
             const auto& transform = view.get<Transform>(entity);
             const auto& renderable = view.get<Renderable>(entity);
             
-            if (!renderable.hasModel) {
+            if (!renderable.hasModel || !passesCulling(registry, entity, frustum, stats)) {
                 continue;
             }
             
             // Ground is typically drawn with a specific scale
             DrawModelEx(
-                renderable.model,
+                *renderable.model,
                 transform.position,
                 Vector3{0.0F, 1.0F, 0.0F},  // Up axis
                 0.0F,  // No rotation
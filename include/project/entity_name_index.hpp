@@ -0,0 +1,57 @@
+#pragma once
+
+#include <project/ecs_components.hpp>
+#include <project/string_hash.hpp>
+#include <entt/entt.hpp>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace project {
+
+/// Hashed name -> entity lookup for the Name component
+///
+/// Follows the registry's Name signals: every Name emplaced, replaced or removed (including
+/// by destroying the entity or clearing the registry) updates the index, whether it went
+/// through assign() or straight to the registry. A name maps to the entity that received it
+/// last. Replacing a Name outside assign() cannot tell which name it replaced, so the old
+/// entry stays until reused; find() checks the entity still carries the name and skips it.
+class EntityNameIndex {
+public:
+    /// Index every Name already in the registry and connect to its Name signals
+    /// @param registry Registry to follow (must outlive the index)
+    explicit EntityNameIndex(entt::registry& registry);
+    ~EntityNameIndex();
+    
+    // Rule of Five: disable copy and move (the registry's signals point at the index)
+    EntityNameIndex(const EntityNameIndex&) = delete;
+    EntityNameIndex& operator=(const EntityNameIndex&) = delete;
+    EntityNameIndex(EntityNameIndex&&) = delete;
+    EntityNameIndex& operator=(EntityNameIndex&&) = delete;
+    
+    /// Emplace or replace the entity's Name component, dropping the entry of its old name
+    void assign(entt::entity entity, std::string name);
+    
+    /// Remove the entity's Name component (the signal drops its entry)
+    void remove(entt::entity entity);
+    
+    /// Find an entity by name (entt::null if none)
+    [[nodiscard]] entt::entity find(std::string_view name) const;
+    
+    /// Get the number of indexed names
+    [[nodiscard]] size_t size() const noexcept { return entities.size(); }
+    
+private:
+    entt::registry* registry{nullptr};
+    std::unordered_map<std::string, entt::entity, TransparentStringHash, std::equal_to<>> entities;
+    
+    /// Drop a name's entry if it maps to the entity
+    void erase(std::string_view name, entt::entity entity);
+    
+    void onNameAssigned(entt::registry& owner, entt::entity entity);
+    void onNameRemoved(entt::registry& owner, entt::entity entity);
+};
+
+} // namespace project
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <raylib.h>
+#include <array>
+
+namespace project {
+
+/// View frustum as six inward-facing planes, for culling bounding boxes before drawing
+struct Frustum {
+    /// Plane (a, b, c, d): points with a*x + b*y + c*z + d >= 0 are inside
+    std::array<Vector4, 6> planes{};
+
+    /// Extract the planes from a view-projection matrix (Gribb/Hartmann)
+    /// @param viewProjection raymath-style view * projection (as passed to shaders as mvp)
+    [[nodiscard]] static Frustum fromViewProjection(const Matrix& viewProjection) noexcept {
+        // Rows of the clip matrix; raylib matrices are column-major (m0..m3 is the first column)
+        const Vector4 row0{viewProjection.m0, viewProjection.m4, viewProjection.m8, viewProjection.m12};
+        const Vector4 row1{viewProjection.m1, viewProjection.m5, viewProjection.m9, viewProjection.m13};
+        const Vector4 row2{viewProjection.m2, viewProjection.m6, viewProjection.m10, viewProjection.m14};
+        const Vector4 row3{viewProjection.m3, viewProjection.m7, viewProjection.m11, viewProjection.m15};
+
+        const auto add = [](const Vector4& lhs, const Vector4& rhs) {
+            return Vector4{lhs.x + rhs.x, lhs.y + rhs.y, lhs.z + rhs.z, lhs.w + rhs.w};
+        };
+        const auto subtract = [](const Vector4& lhs, const Vector4& rhs) {
+            return Vector4{lhs.x - rhs.x, lhs.y - rhs.y, lhs.z - rhs.z, lhs.w - rhs.w};
+        };
+
+        Frustum frustum;
+        frustum.planes = {
+            add(row3, row0),       // Left
+            subtract(row3, row0),  // Right
+            add(row3, row1),       // Bottom
+            subtract(row3, row1),  // Top
+            add(row3, row2),       // Near
+            subtract(row3, row2)   // Far
+        };
+        return frustum;
+    }
+
+    /// Build the frustum of the camera currently set by BeginMode3D()
+    /// Reads rlgl's modelview and projection matrices, so no camera needs to be passed around
+    [[nodiscard]] static Frustum fromCurrentCamera();
+
+    /// Check if a world-space box is at least partly inside the frustum
+    /// Conservative: boxes near frustum corners may pass even when just outside
+    [[nodiscard]] bool intersects(const BoundingBox& box) const noexcept {
+        for (const Vector4& plane : planes) {
+            // Test the box corner furthest along the plane normal
+            const float x = (plane.x >= 0.0F) ? box.max.x : box.min.x;
+            const float y = (plane.y >= 0.0F) ? box.max.y : box.min.y;
+            const float z = (plane.z >= 0.0F) ? box.max.z : box.min.z;
+            if ((plane.x * x) + (plane.y * y) + (plane.z * z) + plane.w < 0.0F) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+} // namespace project
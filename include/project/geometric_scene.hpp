@@ -24,6 +24,7 @@ public:
     [[nodiscard]] const char* getName() const override { return "Geometric Scene"; }
     void initialize() override;
     void cleanup() override;
+    [[nodiscard]] size_t getMemoryEstimate() const override;
 
 private:
     struct GeometricObject {
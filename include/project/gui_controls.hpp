@@ -1,10 +1,14 @@
 #pragma once
 
 #include <project/scene_manager.hpp>
+#include <project/profiler.hpp>
 #include <raylib.h>
+#include <array>
 
 namespace project {
 
+class BulletPhysicsScene;
+
 /// GUI controls and panels for the application
 /// Provides UI for scene management, camera controls, and debug information
 class GuiControls {
@@ -24,23 +28,63 @@ public:
     void renderControlPanel(SceneManager& sceneManager, Camera3D& camera);
     
     /// Render debug information panel
-    void renderDebugPanel();
+    /// @param sceneManager Reference to scene manager (for per-scene render statistics)
+    void renderDebugPanel(SceneManager& sceneManager);
     
     /// Render scene information panel
     /// @param sceneManager Reference to scene manager
     void renderSceneInfo(SceneManager& sceneManager);
     
+    /// Render physics settings panel (only shown when the current scene simulates physics)
+    /// @param sceneManager Reference to scene manager
+    void renderPhysicsPanel(SceneManager& sceneManager);
+    
+    /// Render the frame profiler panel (frame time history and flame view of the scopes)
+    /// @param sceneManager Reference to scene manager (to flag pipelined mode)
+    void renderProfilerPanel(const SceneManager& sceneManager);
+    
+    /// Render the memory panel (per-subsystem usage and budgets from MemoryTracker)
+    void renderMemoryPanel();
+    
     /// Show demo window (for testing ImGui integration)
     void showDemoWindow();
     
     /// Get show demo flag
     [[nodiscard]] bool& getShowDemo() noexcept { return showDemo; }
+    
+    /// Check if any panel (or the demo window) is open
+    /// When none is, the application can idle ImGui (see ImGuiManager::setIdle)
+    [[nodiscard]] bool hasVisiblePanels() const noexcept {
+        return showControlPanel || showDebugPanel || showSceneInfo || showPhysicsPanel || showProfilerPanel || showMemoryPanel || showDemo;
+    }
+    
+    /// Show or hide every panel at once (hiding also closes the demo window)
+    void setPanelsVisible(bool visible) noexcept {
+        showControlPanel = visible;
+        showDebugPanel = visible;
+        showSceneInfo = visible;
+        showPhysicsPanel = visible;
+        showProfilerPanel = visible;
+        showMemoryPanel = visible;
+        showDemo = showDemo && visible;
+    }
 
 private:
     // Control panel state
     bool showControlPanel{true};
     bool showDebugPanel{true};
     bool showSceneInfo{true};
+    bool showPhysicsPanel{true};
+    bool schedulerUnavailable{false};
+    int physicsThreadCount{1};  // "Threads" slider value, applied when the drag ends
+    bool physicsThreadSliderActive{false};
+    bool showProfilerPanel{true};
+    int spawnBoxCount{1000};  // Boxes added per "Spawn Boxes" click
+    int spawnDebrisCount{20000};  // Pieces thrown per "Crash Debris" click
+    int profilerFrameAge{0};  // Frame shown in the flame view (0 = latest)
+    std::array<float, Profiler::kHistorySize> frameTimeHistory{};
+    bool showMemoryPanel{true};
+    bool memoryReportWritten{false};  // Last "Write memory.json" click succeeded
     bool showDemo{false};
     
     // Camera controls
@@ -48,6 +92,9 @@ private:
     static constexpr float kDefaultCameraSensitivity = 0.003F;
     float cameraSpeed{kDefaultCameraSpeed};
     float cameraSensitivity{kDefaultCameraSensitivity};
+    
+    void renderPhysicsThreadingControls(BulletPhysicsScene& physicsScene);
+    static void renderFlameView(const ProfileFrame& frame);
 };
 
 } // namespace project
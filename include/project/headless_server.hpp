@@ -0,0 +1,87 @@
+#pragma once
+
+#include <project/headless_world.hpp>
+#include <project/task_pool.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace project {
+
+/// Settings of a HeadlessServer
+struct HeadlessServerConfig {
+    size_t worldCount{1};
+    std::uint32_t frameInterval{1};  // Steps between state frames (0: no frames)
+    bool fullState{false};           // Frames carry every box's state, not just the hash
+};
+
+/// Header at the start of a state stream
+struct StateStreamHeader {
+    std::uint32_t magic{0x54534C48};  // "HLST"
+    std::uint32_t version{1};
+    std::uint32_t worldCount{0};
+    std::uint32_t fullState{0};
+    float stepRate{0.0F};
+    std::uint32_t frameInterval{0};
+};
+
+static_assert(std::is_trivially_copyable_v<StateStreamHeader>);
+
+/// Many HeadlessWorlds in one process, stepped in lockstep and sharded across a TaskPool
+///
+/// Every step runs the worlds in parallel, each on whichever thread picks it up. A world
+/// only reads its own inputs and writes its own frame buffer, and the frames are appended
+/// in world order afterwards, so the state stream is the same for any number of threads.
+class HeadlessServer {
+public:
+    /// @param config World count and state stream settings
+    /// @param taskPool Threads to shard the worlds over (must outlive the server)
+    HeadlessServer(const HeadlessServerConfig& config, TaskPool& taskPool);
+    ~HeadlessServer() = default;
+
+    // Rule of Five: disable copy and move (tasks point at the worlds)
+    HeadlessServer(const HeadlessServer&) = delete;
+    HeadlessServer& operator=(const HeadlessServer&) = delete;
+    HeadlessServer(HeadlessServer&&) = delete;
+    HeadlessServer& operator=(HeadlessServer&&) = delete;
+
+    /// Queue recorded inputs (commands for steps already taken or unknown worlds are dropped)
+    /// @return Number of commands dropped
+    size_t addInputs(const InputStream& inputs);
+
+    /// Write the header a state stream starts with
+    /// @param bytes Receives the header (appended)
+    void writeStreamHeader(std::vector<unsigned char>& bytes) const;
+
+    /// Apply this step's inputs and advance every world by one fixed step
+    /// @param frames Receives the frames of this step, in world order (appended)
+    void step(std::vector<unsigned char>& frames);
+
+    /// Get the number of steps taken
+    [[nodiscard]] std::uint32_t getStepIndex() const noexcept { return stepIndex; }
+
+    [[nodiscard]] size_t getWorldCount() const noexcept { return shards.size(); }
+
+    [[nodiscard]] HeadlessWorld& getWorld(size_t index) noexcept { return shards[index]->world; }
+
+    /// Get a hash over every world's getStateHash(), in world order
+    [[nodiscard]] std::uint64_t getStateHash() const;
+
+private:
+    /// One world with the inputs and frame buffer only its task touches
+    struct Shard {
+        HeadlessWorld world;
+        std::vector<InputCommand> inputs;  // Sorted by step
+        size_t nextInput{0};
+        std::vector<unsigned char> frame;
+    };
+
+    HeadlessServerConfig config;
+    TaskPool* taskPool{nullptr};
+    std::vector<std::unique_ptr<Shard>> shards;
+    std::uint32_t stepIndex{0};
+};
+
+} // namespace project
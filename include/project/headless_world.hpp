@@ -0,0 +1,138 @@
+#pragma once
+
+#include <project/physics_world.hpp>
+#include <project/shape_cache.hpp>
+#include <entt/entt.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace project {
+
+/// Kinds of recorded input
+enum class InputCommandType : std::uint32_t {
+    SpawnBoxes,    // Spawn `value` boxes in the scene's box layout, above earlier batches
+    ApplyImpulse,  // Apply `vector` (N*s) to the centre of box `value`, in spawn order
+};
+
+/// One recorded input for one world
+struct InputCommand {
+    std::uint32_t step{0};   // Applied before this step runs (0: before the first step)
+    std::uint32_t world{0};  // Index of the world it goes to
+    InputCommandType type{InputCommandType::SpawnBoxes};
+    std::uint32_t value{0};
+    float vector[3]{};
+};
+
+/// State of one box after a step
+struct BodyState {
+    float position[3]{};
+    float rotation[4]{0.0F, 0.0F, 0.0F, 1.0F};  // x, y, z, w
+};
+
+/// Header of one world's frame in a state stream, followed by bodyCount BodyStates
+/// when the stream carries full state
+struct StateFrameHeader {
+    std::uint32_t step{0};   // Steps taken when the frame was captured
+    std::uint32_t world{0};
+    std::uint32_t bodyCount{0};
+    std::uint32_t reserved{0};
+    std::uint64_t stateHash{0};  // HeadlessWorld::getStateHash()
+};
+
+static_assert(std::is_trivially_copyable_v<InputCommand>);
+static_assert(std::is_trivially_copyable_v<BodyState>);
+static_assert(std::is_trivially_copyable_v<StateFrameHeader>);
+
+/// Recorded inputs of a headless run, in the order they were recorded
+///
+/// Serialized like PhysicsSnapshot: a small header followed by the raw records, so a
+/// recording is compact and can be written by one process and replayed by another.
+struct InputStream {
+    std::vector<InputCommand> commands;
+
+    /// Get the size writeTo() produces
+    [[nodiscard]] size_t getSerializedSize() const noexcept;
+
+    /// Serialize into a byte buffer (replaces its contents, reusing its capacity)
+    void writeTo(std::vector<unsigned char>& bytes) const;
+
+    /// Load from bytes produced by writeTo()
+    /// @return False if the bytes are truncated or from another version (the stream is left empty)
+    bool readFrom(std::span<const unsigned char> bytes);
+};
+
+/// The physics scene's simulation without a window, GL context or assets
+///
+/// Builds the ground and boxes of BulletPhysicsScene (same PhysicsSceneLayout) on a
+/// single-threaded PhysicsWorld and advances it in whole fixed steps driven only by
+/// recorded inputs. Given the same inputs, the same binary takes the same steps, so
+/// getStateHash() matches across runs, thread counts and machines of the same build.
+/// The character and car are left out, their collision shapes come from models.
+///
+/// Worlds share nothing but the process-wide BulletAllocator, so different worlds may
+/// be stepped on different threads at the same time.
+class HeadlessWorld {
+public:
+    HeadlessWorld();
+    ~HeadlessWorld() = default;
+
+    // Rule of Five: disable copy and move (the physics world points into the registry)
+    HeadlessWorld(const HeadlessWorld&) = delete;
+    HeadlessWorld& operator=(const HeadlessWorld&) = delete;
+    HeadlessWorld(HeadlessWorld&&) = delete;
+    HeadlessWorld& operator=(HeadlessWorld&&) = delete;
+
+    /// Build the physics world and the ground (no-op if already built)
+    void initialize();
+
+    /// Destroy every body and start over at step 0 on the next initialize()
+    void shutdown();
+
+    /// Apply one recorded input
+    /// Commands naming a box that does not exist are ignored
+    void apply(const InputCommand& command);
+
+    /// Advance exactly one fixed step
+    void step();
+
+    /// Get the number of steps taken since initialize()
+    [[nodiscard]] std::uint32_t getStepIndex() const noexcept { return stepIndex; }
+
+    /// Get the number of boxes spawned so far
+    [[nodiscard]] size_t getBoxCount() const noexcept { return boxes.size(); }
+
+    /// Write the state of every box, in spawn order
+    /// @param states Receives the states (replaced)
+    void captureState(std::vector<BodyState>& states) const;
+
+    /// Get a hash of the step index and every box's exact position and rotation
+    [[nodiscard]] std::uint64_t getStateHash() const;
+
+    /// Append this world's frame (header, and box states if fullState) to a state stream
+    /// @param worldIndex Index written into the frame header
+    void writeFrame(std::uint32_t worldIndex, bool fullState, std::vector<unsigned char>& bytes) const;
+
+    /// Get the physics world (e.g. for its step configuration)
+    [[nodiscard]] PhysicsWorld& getPhysicsWorld() noexcept { return physicsWorld; }
+
+private:
+    entt::registry registry;
+    PhysicsWorld physicsWorld;  // Declared after the registry it points into
+
+    ShapeHandle boxShape;
+    std::vector<entt::entity> boxes;  // Spawn order, as addressed by InputCommand::value
+    size_t nextBoxLayer{0};           // First layout layer above every spawned batch
+    std::uint32_t stepIndex{0};
+
+    // Reused across spawns and frames
+    std::vector<BodySpawn> spawns;
+    std::vector<entt::entity> spawned;
+    mutable std::vector<BodyState> frameStates;
+
+    void spawnBoxes(size_t count);
+};
+
+} // namespace project
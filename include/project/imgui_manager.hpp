@@ -1,5 +1,6 @@
 #pragma once
 
+#include <project/imgui_raylib_platform.hpp>
 #include <raylib.h>
 #include <string>
 #include <functional>
@@ -24,11 +25,22 @@ public:
     void initialize();
     
     /// Begin a new ImGui frame (call at start of each frame)
+    /// Does nothing while idle; check isFrameActive() before issuing ImGui calls
     void beginFrame();
     
     /// End ImGui frame and render (call at end of each frame)
     void endFrame();
     
+    /// Skip ImGui entirely from the next frame on (no input, NewFrame or Render)
+    /// Use when no window is shown; input is resynchronized when the UI comes back
+    void setIdle(bool idle) noexcept { this->idle = idle; }
+    
+    /// Check if the UI is idle
+    [[nodiscard]] bool isIdle() const noexcept { return idle; }
+    
+    /// Check if an ImGui frame is open (between beginFrame() and endFrame() of a non-idle frame)
+    [[nodiscard]] bool isFrameActive() const noexcept { return frameActive; }
+    
     /// Shutdown ImGui (called automatically in destructor)
     void shutdown();
     
@@ -42,10 +54,10 @@ public:
     [[nodiscard]] bool isInitialized() const noexcept { return initialized; }
 
 private:
+    ImGuiRaylibPlatform platform;
     bool initialized{false};
-    
-    void setupInput();
-    void updateInput();
+    bool idle{false};
+    bool frameActive{false};
 };
 
 } // namespace project
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <raylib.h>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace project {
+
+/// Dear ImGui platform backend for raylib, built on ImGui's input event queue
+///
+/// Only changes are submitted: key presses come from raylib's pressed-key queue, releases are
+/// checked for the keys currently held, and mouse position and buttons are sent when they
+/// differ from what ImGui last saw. Every character typed during the frame is forwarded.
+/// State is compared rather than replayed, so frames skipped while the UI is idle leave no
+/// key or button stuck.
+///
+/// Requires an ImGui context; the OpenGL3 renderer backend is set up separately.
+class ImGuiRaylibPlatform {
+public:
+    /// Register the backend with the current ImGui context
+    void initialize();
+
+    /// Release held keys and unregister the backend
+    void shutdown();
+
+    /// Submit the input that changed since the last call (before ImGui::NewFrame)
+    void newFrame();
+
+private:
+    static constexpr size_t kMouseButtonCount = 5;
+
+    std::vector<int> heldKeys;  // raylib keys ImGui currently sees as down
+    std::array<bool, kMouseButtonCount> mouseButtonsDown{};
+    Vector2 lastMousePosition{-1.0F, -1.0F};
+    bool focused{true};
+    bool initialized{false};
+
+    /// Send key-up events for every held key (on focus loss and shutdown)
+    void releaseHeldKeys();
+
+    /// Send the Ctrl/Shift/Alt/Super modifier state derived from the held keys
+    void updateModifiers() const;
+};
+
+} // namespace project
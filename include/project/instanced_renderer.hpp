@@ -0,0 +1,136 @@
+#pragma once
+
+#include <project/transform_pool.hpp>
+#include <raylib.h>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace project {
+
+/// Index into Material::params of the alpha-test cutoff used by instanced draws
+/// Texels whose texture alpha is below it are discarded. raylib zeroes params, so materials
+/// are not alpha-tested unless they opt in (LOD impostors do, for their cut-out views).
+/// Alpha-tested batches go through the instancing shader even for a single instance.
+inline constexpr int kMaterialAlphaCutoffParam = 0;
+
+/// Batches model draws by (mesh, material, tint) and submits one DrawMeshInstanced per batch
+///
+/// flush() orders the batches by shader and albedo texture, so models sharing a cached atlas
+/// (see AssetCache) are drawn back to back without rebinding it.
+///
+/// Usage per frame: begin(), submit() every visible model, then flush().
+/// If the instancing shader cannot be compiled on this platform, isInstancingSupported()
+/// returns false and callers should fall back to per-entity DrawModelEx.
+class InstancedRenderer {
+public:
+    InstancedRenderer() = default;
+    ~InstancedRenderer();
+
+    // Rule of Five: disable copy, allow move
+    InstancedRenderer(const InstancedRenderer&) = delete;
+    InstancedRenderer& operator=(const InstancedRenderer&) = delete;
+    InstancedRenderer(InstancedRenderer&&) noexcept = default;
+    InstancedRenderer& operator=(InstancedRenderer&&) noexcept = default;
+
+    /// Load the instancing shader (requires an active GL context)
+    void initialize();
+
+    /// Unload the instancing shader and drop all batches
+    void shutdown();
+
+    /// Check if instanced submission is available
+    [[nodiscard]] bool isInstancingSupported() const noexcept { return instancingSupported; }
+
+    /// Start a new frame (keeps batch storage allocated)
+    void begin();
+
+    /// Queue every mesh of a model for drawing
+    /// @param model Model to draw (must stay alive until flush())
+    /// @param transform World matrix of the instance (as from Transform::getMatrix())
+    /// @param tint Color multiplied with the material's diffuse color
+    void submit(const Model& model, const Matrix& transform, Color tint);
+
+    /// Queue many instances of a model at once (one batch lookup per mesh, not per instance)
+    /// @param model Model to draw (must stay alive until flush())
+    /// @param transforms World matrix of every instance
+    /// @param tint Color multiplied with the material's diffuse color
+    void submitInstances(const Model& model, std::span<const Matrix> transforms, Color tint);
+
+    /// Draw all queued batches
+    void flush();
+
+    /// Get the staging storage RenderSystem composes this renderer's matrices in
+    [[nodiscard]] TransformPool& getTransformPool() noexcept { return transformPool; }
+
+    /// Get the number of draw calls issued by the last flush()
+    [[nodiscard]] size_t getDrawCallCount() const noexcept { return drawCallCount; }
+
+    /// Get the number of instances drawn by the last flush()
+    [[nodiscard]] size_t getInstanceCount() const noexcept { return instanceCount; }
+
+    /// Get the number of times the last flush() switched shader or albedo texture between batches
+    [[nodiscard]] size_t getStateChangeCount() const noexcept { return stateChangeCount; }
+
+private:
+    struct BatchKey {
+        const Mesh* mesh{nullptr};
+        const Material* material{nullptr};
+        std::uint32_t tint{0};
+
+        bool operator==(const BatchKey&) const = default;
+    };
+
+    struct BatchKeyHash {
+        size_t operator()(const BatchKey& key) const noexcept;
+    };
+
+    struct Batch {
+        std::vector<Matrix> transforms;
+    };
+
+    Shader instancingShader{};
+    bool instancingSupported{false};
+    int alphaCutoffLocation{-1};
+    float appliedAlphaCutoff{-1.0F};  // Last value uploaded to the alphaCutoff uniform
+
+    // Batches persist across frames so their transform buffers are reused
+    std::unordered_map<BatchKey, Batch, BatchKeyHash> batches;
+    TransformPool transformPool;
+
+    // Non-empty batches in draw order; scratch storage reused by flush()
+    std::vector<const std::pair<const BatchKey, Batch>*> drawOrder;
+
+    size_t drawCallCount{0};
+    size_t instanceCount{0};
+    size_t stateChangeCount{0};
+
+    void drawBatch(const BatchKey& key, const Batch& batch);
+};
+
+/// Instanced draw counters summed over a frame
+/// A renderer may be flushed several times per frame (entities, then debris) and begin()
+/// restarts its counters, so the owner adds them up after every flush()
+struct InstancingStats {
+    size_t drawCalls{0};
+    size_t instances{0};
+    size_t stateChanges{0};  // Shader or albedo texture switches between batches
+
+    void reset() noexcept {
+        drawCalls = 0;
+        instances = 0;
+        stateChanges = 0;
+    }
+
+    /// Add the counters of the renderer's last flush()
+    void add(const InstancedRenderer& renderer) noexcept {
+        drawCalls += renderer.getDrawCallCount();
+        instances += renderer.getInstanceCount();
+        stateChanges += renderer.getStateChangeCount();
+    }
+};
+
+} // namespace project
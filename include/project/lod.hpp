@@ -0,0 +1,78 @@
+#pragma once
+
+#include <project/asset_cache.hpp>
+#include <raylib.h>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace project {
+
+/// How AssetCache::acquireLodModel builds a level-of-detail chain from a full-detail model
+struct LodSettings {
+    /// Clustering grid resolution of each simplified level, along the longest bounds axis
+    /// (coarser levels use fewer cells; levels that would not drop vertices are skipped)
+    std::vector<int> simplifyResolutions{24, 8};
+
+    /// Projected size (fraction of the viewport height) below which each level hands over to
+    /// the next one, from finest to coarsest; one entry per transition
+    std::vector<float> screenSizes{0.30F, 0.12F, 0.04F};
+
+    /// Add a crossed-quad impostor rendered from the model as the last level
+    bool impostor{true};
+
+    /// Edge length in pixels of each impostor view
+    int impostorResolution{128};
+};
+
+/// Full-detail model, simplified copies and an optional impostor of one asset
+///
+/// Simplified levels share the source model's materials, so every level batches separately
+/// in the InstancedRenderer (its meshes differ) while textures stay uploaded once.
+struct LodModel {
+    std::vector<ModelHandle> levels;  // 0 = full detail, then coarser
+    std::vector<float> screenSizes;   // Level i hands over to i + 1 below screenSizes[i]
+    bool hasImpostor{false};          // The last level is the impostor
+    Vector3 center{0.0F, 0.0F, 0.0F}; // Bounding sphere of level 0, in model space
+    float radius{0.0F};
+
+    /// Fraction of a threshold by which the projected size has to cross it before the level
+    /// changes, so objects sitting at a boundary don't flicker between levels
+    static constexpr float kHysteresis = 0.15F;
+
+    /// Pick the level for a projected size, moving away from the current one only once the
+    /// size is clearly past a threshold
+    /// @param screenSize Fraction of the viewport height the bounding sphere covers
+    /// @param currentLevel Level used last frame
+    [[nodiscard]] size_t selectLevel(float screenSize, size_t currentLevel) const noexcept;
+};
+
+/// Camera data for LOD selection, read from the current camera the way Frustum is
+struct LodView {
+    Vector3 cameraPosition{0.0F, 0.0F, 0.0F};
+    float projectionScale{1.0F};  // 1 / tan(fovy / 2) of the perspective projection
+    float bias{1.0F};             // Multiplies projected sizes (> 1 keeps detail longer)
+
+    /// Build the view of the camera currently set by BeginMode3D()
+    [[nodiscard]] static LodView fromCurrentCamera();
+
+    /// Get the fraction of the viewport height a sphere covers
+    /// @param center World-space center of the sphere
+    /// @param radius World-space radius of the sphere
+    [[nodiscard]] float getScreenSize(const Vector3& center, float radius) const noexcept;
+};
+
+/// Build a level-of-detail chain (needs the GL context; call outside BeginMode3D)
+/// Simplifies by vertex clustering on the CPU copy of the meshes, keeping texture
+/// coordinates apart so palette-textured models keep their colors
+/// @param model Full-detail model (level 0; kept alive by the chain)
+/// @param bounds Model-space bounds of the model
+/// @param settings Levels to build
+/// @return The chain (just level 0 if the model has no CPU-side vertices)
+[[nodiscard]] LodHandle buildLodModel(
+    const ModelHandle& model,
+    const BoundingBox& bounds,
+    const LodSettings& settings
+);
+
+} // namespace project
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+namespace project {
+
+/// Subsystems that memory is accounted to
+enum class MemoryCategory : std::uint8_t {
+    Ecs,        // EnTT component storages
+    Physics,    // Bullet's heap (BulletAllocator) and the rigid body pools
+    AssetsCpu,  // Mesh arrays of cached models
+    AssetsGpu,  // Uploaded mesh buffers and textures
+    Debris,     // DebrisSystem streams and draw batches
+    ImGui,      // Dear ImGui's heap
+    Count
+};
+
+inline constexpr size_t kMemoryCategoryCount = static_cast<size_t>(MemoryCategory::Count);
+
+/// Accounting of one category as of the last MemoryTracker::endSample()
+struct MemoryCategoryStats {
+    size_t liveBytes{0};
+    size_t peakBytes{0};               // High-water mark of liveBytes since startup or resetPeaks()
+    std::uint64_t allocations{0};      // Allocations counted so far (hooked categories only)
+    float allocationsPerSecond{0.0F};  // Over the last rate window (hooked categories only)
+    size_t budgetBytes{0};             // 0: no budget
+    bool hooked{false};                // An allocator hook counts every allocation of this category
+
+    [[nodiscard]] bool isOverBudget() const noexcept { return budgetBytes != 0 && liveBytes > budgetBytes; }
+};
+
+/// Per-subsystem memory accounting with budgets
+///
+/// Categories are fed in two ways. Allocators that see every allocation (Bullet's, behind
+/// btAlignedAllocSetCustom, and ImGui's) are hooked: they count live bytes and allocations
+/// as they happen, from any thread. Memory owned by containers (component storages, object
+/// pools, cached assets) is measured instead: once per frame, between beginSample() and
+/// endSample(), the owners add the bytes they reserve (see SceneManager::reportMemory).
+///
+/// endSample() updates peaks and allocation rates and checks budgets. A category going over
+/// its budget is reported once on stderr and stays flagged until it drops back under it.
+///
+/// Sampling is not thread-safe; run it on the main thread while no simulation step is in flight.
+class MemoryTracker {
+public:
+    /// Get the process-wide tracker
+    [[nodiscard]] static MemoryTracker& instance();
+
+    ~MemoryTracker() = default;
+
+    // Rule of Five: disable copy and move (singleton)
+    MemoryTracker(const MemoryTracker&) = delete;
+    MemoryTracker& operator=(const MemoryTracker&) = delete;
+    MemoryTracker(MemoryTracker&&) = delete;
+    MemoryTracker& operator=(MemoryTracker&&) = delete;
+
+    /// Count an allocation made through a hooked allocator (thread-safe)
+    /// @param category Category the allocator belongs to
+    /// @param bytes Requested size
+    static void recordAllocation(MemoryCategory category, size_t bytes) noexcept;
+
+    /// Count the release of an allocation passed to recordAllocation (thread-safe)
+    static void recordDeallocation(MemoryCategory category, size_t bytes) noexcept;
+
+    /// Start a sample: forget the bytes measured last frame
+    void beginSample() noexcept;
+
+    /// Add measured bytes to a category (between beginSample() and endSample())
+    void addMeasured(MemoryCategory category, size_t bytes) noexcept;
+
+    /// Finish a sample: combine measured and hooked bytes, update peaks and rates, check budgets
+    /// @param deltaTime Seconds since the last sample
+    void endSample(float deltaTime);
+
+    /// Get the accounting of a category as of the last endSample()
+    [[nodiscard]] const MemoryCategoryStats& getStats(MemoryCategory category) const noexcept {
+        return stats[static_cast<size_t>(category)];
+    }
+
+    /// Get the live bytes summed over every category
+    [[nodiscard]] size_t getTotalLiveBytes() const noexcept;
+
+    /// Set the budget of a category
+    /// @param bytes Live bytes above which the category is over budget (0: no budget)
+    void setBudget(MemoryCategory category, size_t bytes) noexcept;
+
+    /// Restart every high-water mark from the current usage
+    void resetPeaks() noexcept;
+
+    /// Write the last sample as JSON (one object per category)
+    void writeJson(std::ostream& output) const;
+
+    /// Write the last sample as JSON to a file
+    /// @return True if the file was written
+    bool writeJsonFile(const std::string& path) const;
+
+    /// Get the display name of a category
+    [[nodiscard]] static const char* getCategoryName(MemoryCategory category) noexcept;
+
+private:
+    MemoryTracker() = default;
+
+    // Length of the window allocation rates are averaged over, in seconds
+    static constexpr float kRateWindow = 0.5F;
+
+    std::array<MemoryCategoryStats, kMemoryCategoryCount> stats{};
+    std::array<size_t, kMemoryCategoryCount> measuredBytes{};
+    std::array<std::uint64_t, kMemoryCategoryCount> windowStartAllocations{};
+    float windowElapsed{0.0F};
+};
+
+} // namespace project
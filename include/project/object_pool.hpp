@@ -0,0 +1,141 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace project {
+
+/// Fixed-size object pool: allocates objects of one type from contiguous chunks
+///
+/// create() and destroy() are O(1) and only touch the heap when a new chunk is needed,
+/// so spawn/despawn bursts reuse slots instead of hitting malloc. Objects never move.
+/// releaseMemory() frees every chunk at once once all objects have been destroyed.
+/// Not thread-safe; each pool belongs to one owner (e.g. one scene).
+/// @tparam T Object type (alignment of at least 16 bytes is kept for Bullet's SIMD types)
+/// @tparam ChunkSize Number of objects per chunk
+template <typename T, size_t ChunkSize = 128>
+class ObjectPool {
+public:
+    ObjectPool() = default;
+
+    ~ObjectPool() {
+        releaseMemory();
+    }
+
+    // Rule of Five: disable copy, allow move
+    // The chunks, and with them every live object, go to the target; the source is left
+    // empty (its free list pointed into the moved chunks)
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    ObjectPool(ObjectPool&& other) noexcept
+        : chunks(std::exchange(other.chunks, {})),
+          freeList(std::exchange(other.freeList, nullptr)),
+          liveCount(std::exchange(other.liveCount, 0)) {
+    }
+
+    ObjectPool& operator=(ObjectPool&& other) noexcept {
+        if (this != &other) {
+            chunks = std::exchange(other.chunks, {});
+            freeList = std::exchange(other.freeList, nullptr);
+            liveCount = std::exchange(other.liveCount, 0);
+        }
+        return *this;
+    }
+
+    /// Construct an object in a free slot
+    /// @return Pointer to the new object (release it with destroy(), never delete)
+    template <typename... Args>
+    [[nodiscard]] T* create(Args&&... args) {
+        if (freeList == nullptr) {
+            addChunk();
+        }
+
+        Slot* slot = freeList;
+        freeList = slot->next;
+        try {
+            T* object = ::new (static_cast<void*>(slot->storage)) T(std::forward<Args>(args)...);
+            ++liveCount;
+            return object;
+        } catch (...) {
+            slot->next = freeList;
+            freeList = slot;
+            throw;
+        }
+    }
+
+    /// Allocate chunks up front so the next count create() calls don't touch the heap
+    /// @param count Number of objects about to be created
+    void reserve(size_t count) {
+        while (getCapacity() - liveCount < count) {
+            addChunk();
+        }
+    }
+
+    /// Destroy an object created by this pool and return its slot
+    /// @param object Object to destroy (nullptr is ignored)
+    void destroy(T* object) noexcept {
+        if (object == nullptr) {
+            return;
+        }
+
+        object->~T();
+        auto* slot = reinterpret_cast<Slot*>(object);
+        slot->next = freeList;
+        freeList = slot;
+        --liveCount;
+    }
+
+    /// Free all chunks in one go
+    /// Only possible once every object has been destroyed; otherwise the memory is kept
+    /// @return True if the memory was released
+    bool releaseMemory() noexcept {
+        if (liveCount != 0) {
+            return false;
+        }
+        chunks.clear();
+        freeList = nullptr;
+        return true;
+    }
+
+    /// Get the number of objects currently alive
+    [[nodiscard]] size_t getLiveCount() const noexcept { return liveCount; }
+
+    /// Get the number of slots allocated (live + free)
+    [[nodiscard]] size_t getCapacity() const noexcept { return chunks.size() * ChunkSize; }
+
+    /// Get the number of bytes reserved by the pool's chunks
+    [[nodiscard]] size_t getReservedBytes() const noexcept { return chunks.size() * sizeof(Chunk); }
+
+private:
+    static constexpr size_t kAlignment = std::max(alignof(T), size_t{16});
+
+    union alignas(kAlignment) Slot {
+        Slot* next;
+        std::byte storage[sizeof(T)];
+    };
+
+    struct Chunk {
+        Slot slots[ChunkSize];
+    };
+
+    std::vector<std::unique_ptr<Chunk>> chunks;
+    Slot* freeList{nullptr};
+    size_t liveCount{0};
+
+    void addChunk() {
+        auto& chunk = chunks.emplace_back(std::make_unique_for_overwrite<Chunk>());
+        // Link the slots in address order so consecutive creates stay adjacent in memory
+        for (size_t i = ChunkSize; i > 0; --i) {
+            Slot& slot = chunk->slots[i - 1];
+            slot.next = freeList;
+            freeList = &slot;
+        }
+    }
+};
+
+} // namespace project
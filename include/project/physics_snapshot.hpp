@@ -0,0 +1,64 @@
+#pragma once
+
+#include <project/ecs_components.hpp>
+#include <entt/entt.hpp>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace project {
+
+/// Captured state of one dynamic rigid body
+struct BodySnapshot {
+    entt::entity entity{entt::null};
+    std::int32_t activationState{0};
+    float deactivationTime{0.0F};
+    float position[3]{};
+    float rotation[4]{0.0F, 0.0F, 0.0F, 1.0F};  // x, y, z, w
+    float linearVelocity[3]{};
+    float angularVelocity[3]{};
+};
+
+/// Captured Transform (and PreviousTransform, if the entity has one) of one entity
+struct TransformSnapshot {
+    entt::entity entity{entt::null};
+    std::uint32_t hasPrevious{0};
+    Transform transform;
+    PreviousTransform previous;
+};
+
+static_assert(std::is_trivially_copyable_v<BodySnapshot>);
+static_assert(std::is_trivially_copyable_v<TransformSnapshot>);
+
+/// Dynamic body and transform state of a PhysicsWorld's registry, for rollback and fast resets
+///
+/// Holds no pointers, only entity ids, so it can be written to bytes, stored and sent over
+/// the network. Recapturing into the same snapshot reuses its storage.
+struct PhysicsSnapshot {
+    std::vector<BodySnapshot> bodies;
+    std::vector<TransformSnapshot> transforms;
+    float accumulator{0.0F};  // Fixed-step time owed, so replays step at the same moments
+
+    /// Drop the captured state (keeps the storage)
+    void clear() noexcept {
+        bodies.clear();
+        transforms.clear();
+        accumulator = 0.0F;
+    }
+
+    /// Check if anything was captured
+    [[nodiscard]] bool isEmpty() const noexcept { return bodies.empty() && transforms.empty(); }
+
+    /// Get the size writeTo() produces
+    [[nodiscard]] size_t getSerializedSize() const noexcept;
+
+    /// Serialize into a byte buffer (replaces its contents, reusing its capacity)
+    void writeTo(std::vector<unsigned char>& bytes) const;
+
+    /// Load from bytes produced by writeTo()
+    /// @return False if the bytes are truncated or from another version (the snapshot is left empty)
+    bool readFrom(std::span<const unsigned char> bytes);
+};
+
+} // namespace project
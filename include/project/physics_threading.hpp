@@ -0,0 +1,72 @@
+#pragma once
+
+#include <array>
+
+// Bullet's task scheduler interface only exists in thread-safe builds
+#if defined(PROJECT_BULLET_MULTITHREADING)
+class btITaskScheduler;
+#endif
+
+namespace project {
+
+/// Which Bullet dynamics world the physics scene builds
+enum class PhysicsBackend {
+    SingleThreaded,  // btDiscreteDynamicsWorld + btSequentialImpulseConstraintSolver
+    MultiThreaded    // btDiscreteDynamicsWorldMt + solver pool + btCollisionDispatcherMt
+};
+
+/// Task scheduler driving the multithreaded backend
+enum class TaskSchedulerKind {
+    ThreadPool,     // Project thread pool (always available in thread-safe builds)
+    BulletDefault,  // Bullet's built-in scheduler
+    OpenMP,         // Requires Bullet built with BT_USE_OPENMP
+    TBB,            // Requires Bullet built with BT_USE_TBB
+    PPL,            // Requires Bullet built with BT_USE_PPL (Windows)
+    Custom          // Scheduler supplied through setCustomTaskScheduler()
+};
+
+/// Display names for TaskSchedulerKind, indexed by the enum value
+inline constexpr std::array<const char*, 6> kTaskSchedulerNames{
+    "Thread Pool", "Bullet Default", "OpenMP", "TBB", "PPL", "Custom"
+};
+
+/// Process-wide control of Bullet's task scheduler
+/// Bullet keeps a single global scheduler, so this is a static facade rather than an object
+class PhysicsThreading {
+public:
+    PhysicsThreading() = delete;
+
+    /// Check if the project was built against a thread-safe Bullet (BT_THREADSAFE)
+    [[nodiscard]] static constexpr bool isAvailable() noexcept {
+#if defined(PROJECT_BULLET_MULTITHREADING)
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    /// Install a task scheduler as Bullet's global scheduler
+    /// @param kind Scheduler to install
+    /// @param threadCount Requested worker count (clamped to the scheduler's maximum)
+    /// @return False if the scheduler is not available in this build
+    static bool activateTaskScheduler(TaskSchedulerKind kind, int threadCount);
+
+    /// Get the kind of the active scheduler
+    [[nodiscard]] static TaskSchedulerKind getActiveTaskScheduler() noexcept;
+
+    /// Change the number of threads used by the active scheduler (takes effect next step)
+    static void setThreadCount(int threadCount);
+
+    /// Get the number of threads used by the active scheduler (1 if single-threaded)
+    [[nodiscard]] static int getThreadCount();
+
+    /// Get the largest thread count the active scheduler accepts
+    [[nodiscard]] static int getMaxThreadCount();
+
+#if defined(PROJECT_BULLET_MULTITHREADING)
+    /// Register an application-provided scheduler for TaskSchedulerKind::Custom (not owned)
+    static void setCustomTaskScheduler(btITaskScheduler* scheduler) noexcept;
+#endif
+};
+
+} // namespace project
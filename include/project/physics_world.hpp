@@ -0,0 +1,176 @@
+#pragma once
+
+#include <project/ecs_components.hpp>
+#include <project/ecs_systems.hpp>
+#include <project/physics_snapshot.hpp>
+#include <project/physics_threading.hpp>
+#include <project/shape_cache.hpp>
+#include <project/spatial_query.hpp>
+#include <entt/entt.hpp>
+#include <raylib.h>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// Forward declarations for Bullet Physics
+class btDiscreteDynamicsWorld;
+class btCollisionDispatcher;
+class btDbvtBroadphase;
+class btConstraintSolver;
+class btDefaultCollisionConfiguration;
+class btVector3;
+
+namespace project {
+
+/// One body for PhysicsWorld::createBodies
+struct BodySpawn {
+    Vector3 position{0.0F, 0.0F, 0.0F};
+    Quaternion rotation{0.0F, 0.0F, 0.0F, 1.0F};
+    std::uint32_t shapeIndex{0};  // Into the shapes span passed alongside
+    float mass{0.0F};             // 0 for static
+};
+
+/// Bullet dynamics world bound to an ECS registry, independent of rendering and windowing
+///
+/// Owns the Bullet world, pooled bodies, interned shapes and fixed-step state. Scenes add
+/// Renderable and other components on top of the entities it creates; headless tools
+/// (benchmarks, servers) use it on its own without a window or GL context.
+class PhysicsWorld {
+public:
+    /// @param registry Registry receiving Transform/PhysicsBody components (must outlive the world)
+    explicit PhysicsWorld(entt::registry& registry);
+    ~PhysicsWorld();
+
+    // Rule of Five: disable copy and move (motion states and components point into the world)
+    PhysicsWorld(const PhysicsWorld&) = delete;
+    PhysicsWorld& operator=(const PhysicsWorld&) = delete;
+    PhysicsWorld(PhysicsWorld&&) = delete;
+    PhysicsWorld& operator=(PhysicsWorld&&) = delete;
+
+    /// Build the Bullet world for the selected backend
+    void initialize();
+
+    /// Destroy every body and the Bullet world (other components in the registry are kept)
+    void shutdown();
+
+    /// Check if the world has been built
+    [[nodiscard]] bool isInitialized() const noexcept { return dynamicsWorld != nullptr; }
+
+    /// Advance the simulation by whole fixed steps and sync moved bodies (see PhysicsSystem::update)
+    /// @param deltaTime Time since last update
+    /// @param taskPool Threads for the transform sync (nullptr: calling thread only)
+    void update(float deltaTime, TaskPool* taskPool = nullptr);
+
+    /// Advance exactly one fixed step and sync moved bodies, regardless of elapsed time or budget
+    /// For headless servers and replays, where every run has to take the same steps;
+    /// the accumulator is left alone
+    void step();
+
+    /// Create an entity with Transform, PhysicsBody and (for dynamic bodies) PreviousTransform
+    /// @param position Initial position
+    /// @param collisionShape Shared collision shape, usually from getShapeCache()
+    /// @param mass Mass of the body (0 for static)
+    /// @return The created entity (also stored as the body's user index for SpatialQuery)
+    entt::entity createBody(const Vector3& position, ShapeHandle collisionShape, float mass);
+
+    /// Create many bodies at once (what createBody does, without the per-entity overhead)
+    /// Entities and component storage are allocated in one go, pooled bodies are reserved up
+    /// front, inertia is computed once per shape, and the broadphase tree is rebuilt once
+    /// after large batches instead of staying in its incrementally inserted shape
+    /// @param spawns Body descriptors
+    /// @param shapes Shapes referenced by BodySpawn::shapeIndex (shared by every body using them)
+    /// @param entities Receives the created entities in descriptor order (replaced); spawns whose
+    ///                 shapeIndex is out of range or names a null shape are skipped and get entt::null
+    void createBodies(std::span<const BodySpawn> spawns, std::span<const ShapeHandle> shapes, std::vector<entt::entity>& entities);
+
+    /// Get the Bullet world (nullptr before initialize())
+    [[nodiscard]] btDiscreteDynamicsWorld* getDynamicsWorld() noexcept { return dynamicsWorld; }
+
+    /// Capture every dynamic body and every Transform in the registry
+    /// @param snapshot Receives the state (its storage is reused)
+    void captureSnapshot(PhysicsSnapshot& snapshot) const;
+
+    /// Put captured bodies and transforms back without rebuilding anything
+    /// Entities destroyed since the capture are skipped and entities created since keep
+    /// their state; contact caches are not captured and refresh on the next step
+    /// @param snapshot State from captureSnapshot() on this world's registry
+    void restoreSnapshot(const PhysicsSnapshot& snapshot);
+
+    /// Get spatial queries over this world's bodies (empty results before initialize())
+    [[nodiscard]] SpatialQuery getSpatialQuery() const noexcept;
+
+    /// Get the shape cache used for this world's bodies
+    [[nodiscard]] ShapeCache& getShapeCache() noexcept { return shapeCache; }
+
+    /// Get the fixed-step configuration (editable at runtime, e.g. from the GUI)
+    [[nodiscard]] PhysicsStepConfig& getStepConfig() noexcept { return stepConfig; }
+
+    /// Get the fixed-step statistics from the last update
+    [[nodiscard]] const PhysicsStepState& getStepState() const noexcept { return stepState; }
+
+    /// Get the dirty-set state (for callers stepping the world by hand)
+    [[nodiscard]] PhysicsSyncState& getSyncState() noexcept { return syncState; }
+
+    /// Get the entities whose transforms physics changed during the last update
+    [[nodiscard]] const std::vector<entt::entity>& getMovedEntities() const noexcept { return syncState.movedThisFrame; }
+
+    /// Get the number of live rigid bodies
+    [[nodiscard]] size_t getBodyCount() const noexcept { return bodyPool.rigidBodies.getLiveCount(); }
+
+    /// Get the bytes reserved by the rigid body and motion state pools
+    [[nodiscard]] size_t getPooledBytes() const noexcept {
+        return bodyPool.rigidBodies.getReservedBytes() + bodyPool.motionStates.getReservedBytes();
+    }
+
+    /// Get the dynamics world backend
+    [[nodiscard]] PhysicsBackend getPhysicsBackend() const noexcept { return physicsBackend; }
+
+    /// Select the dynamics world backend; takes effect on the next initialize()
+    /// Falls back to single-threaded if multithreading is not compiled in
+    void setPhysicsBackend(PhysicsBackend backend) noexcept;
+
+    /// Get the task scheduler used by the multithreaded backend
+    [[nodiscard]] TaskSchedulerKind getTaskScheduler() const noexcept { return taskScheduler; }
+
+    /// Select the task scheduler for the multithreaded backend (applied immediately if active)
+    /// @return False if the scheduler is not available in this build
+    bool setTaskScheduler(TaskSchedulerKind kind);
+
+private:
+    // Pooled rigid bodies and motion states; declared first so it outlives everything using it
+    PhysicsBodyPool bodyPool;
+
+    // Interned collision shapes; kept across shutdown() so convex hulls are built only once
+    ShapeCache shapeCache;
+
+    // Registry holding the physics components (not owned)
+    entt::registry* registry{nullptr};
+
+    // Bullet Physics world components
+    btDiscreteDynamicsWorld* dynamicsWorld{nullptr};
+    btCollisionDispatcher* dispatcher{nullptr};
+    btDbvtBroadphase* overlappingPairCache{nullptr};
+    btConstraintSolver* constraintSolver{nullptr};
+    btConstraintSolver* solverPool{nullptr};  // Only used by the multithreaded backend
+    btDefaultCollisionConfiguration* collisionConfiguration{nullptr};
+
+    // Threading configuration
+    PhysicsBackend physicsBackend{PhysicsBackend::SingleThreaded};
+    TaskSchedulerKind taskScheduler{TaskSchedulerKind::ThreadPool};
+
+    // Fixed-step simulation settings and accumulator
+    PhysicsStepConfig stepConfig;
+    PhysicsStepState stepState;
+
+    // Dirty list written by the motion states (they hold its address)
+    PhysicsSyncState syncState;
+
+    /// Create the pooled body for an existing entity and add the physics components
+    void attachBody(entt::entity entity, const BodySpawn& spawn, const ShapeHandle& collisionShape, const btVector3& localInertia);
+
+    void setupSingleThreadedWorld();
+    void setupMultiThreadedWorld();
+    void destroyWorld();
+};
+
+} // namespace project
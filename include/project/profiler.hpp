@@ -0,0 +1,202 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace project {
+
+/// One timed CPU scope inside a frame
+struct ProfileSample {
+    const char* name{nullptr};  // Static string passed to the scope macro
+    std::int32_t parent{-1};    // Index of the enclosing sample in the frame (-1 = top level)
+    std::uint16_t depth{0};     // Nesting depth (0 = top level)
+    double startMs{0.0};        // Start time relative to the frame start
+    double durationMs{0.0};
+};
+
+/// GPU time of one GPU scope, as last reported by the driver
+struct GpuSample {
+    const char* name{nullptr};
+    double durationMs{0.0};
+};
+
+/// Everything recorded for one frame
+struct ProfileFrame {
+    double frameMs{0.0};
+    std::vector<ProfileSample> cpuSamples;  // In scope-begin order (parents before children)
+    std::vector<GpuSample> gpuSamples;      // Results are a few frames old (queries are not waited on)
+};
+
+/// Lightweight in-game frame profiler
+///
+/// Records nested CPU scopes on the main thread and GPU time (GL_TIME_ELAPSED queries) for
+/// a few flat GPU scopes, and keeps a rolling history of frames for the profiler panel.
+/// Use the PROJECT_PROFILE_* macros for instrumentation; they compile to nothing when the
+/// project is built with Project_ENABLE_PROFILER=OFF.
+///
+/// Scopes opened on other threads (e.g. physics workers, or the simulation thread in
+/// SceneManager's pipelined mode) are ignored.
+class Profiler {
+public:
+    static constexpr size_t kHistorySize = 240;
+
+    /// Get the process-wide profiler
+    [[nodiscard]] static Profiler& instance();
+
+    /// Check if the instrumentation macros are compiled in
+    [[nodiscard]] static constexpr bool isCompiledIn() noexcept {
+#if defined(PROJECT_ENABLE_PROFILER)
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    ~Profiler();
+
+    // Rule of Five: disable copy and move (singleton)
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+    Profiler(Profiler&&) = delete;
+    Profiler& operator=(Profiler&&) = delete;
+
+    /// Start recording a frame (call once at the top of the main loop)
+    void beginFrame();
+
+    /// Finish the current frame and push it into the history
+    void endFrame();
+
+    /// Open a CPU scope
+    /// @param name Static string (only the pointer is stored)
+    void beginScope(const char* name);
+
+    /// Close the innermost CPU scope
+    void endScope();
+
+    /// Open a GPU scope (GPU scopes cannot nest; requires an active GL context)
+    /// @param name Static string (only the pointer is stored)
+    void beginGpuScope(const char* name);
+
+    /// Close the open GPU scope
+    void endGpuScope();
+
+    /// Delete GPU queries (call before the GL context is destroyed)
+    void shutdownGpu();
+
+    /// Pause or resume recording (the history is kept while paused)
+    void setPaused(bool paused) noexcept { this->paused = paused; }
+
+    /// Check if recording is paused
+    [[nodiscard]] bool isPaused() const noexcept { return paused; }
+
+    /// Check if GPU timer queries are available on this platform
+    [[nodiscard]] bool isGpuTimingSupported() const noexcept { return gpuTimingSupported; }
+
+    /// Get the number of frames in the history
+    [[nodiscard]] size_t getFrameCount() const noexcept { return frameCount; }
+
+    /// Get a recorded frame
+    /// @param age 0 = most recent completed frame, up to getFrameCount() - 1
+    [[nodiscard]] const ProfileFrame& getFrame(size_t age) const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    // GPU queries are read back kGpuLatency frames later so the CPU never waits on the GPU
+    static constexpr size_t kGpuLatency = 3;
+    static constexpr size_t kMaxGpuScopes = 8;
+
+    struct GpuScope {
+        const char* name{nullptr};
+        std::array<unsigned int, kGpuLatency> queries{};
+        std::array<bool, kGpuLatency> pending{};
+        double lastDurationMs{0.0};
+    };
+
+    Profiler() = default;
+
+    std::array<ProfileFrame, kHistorySize> history{};
+    size_t newestFrame{0};
+    size_t frameCount{0};
+
+    ProfileFrame current;
+    std::vector<std::int32_t> openScopes;
+    Clock::time_point frameStart{};
+    std::thread::id mainThread{};
+    bool frameOpen{false};
+    bool paused{false};
+
+    std::array<GpuScope, kMaxGpuScopes> gpuScopes{};
+    size_t gpuScopeCount{0};
+    size_t gpuFrameSlot{0};
+    GpuScope* openGpuScope{nullptr};
+    bool gpuInitialized{false};
+    bool gpuTimingSupported{false};
+
+    [[nodiscard]] bool isRecordingThread() const noexcept;
+    [[nodiscard]] double elapsedMs() const noexcept;
+    void initializeGpu();
+    void collectGpuResults();
+    [[nodiscard]] GpuScope* findGpuScope(const char* name);
+};
+
+/// RAII CPU scope, used through PROJECT_PROFILE_SCOPE
+class ProfileScope {
+public:
+    explicit ProfileScope(const char* name) {
+        Profiler::instance().beginScope(name);
+    }
+
+    ~ProfileScope() {
+        Profiler::instance().endScope();
+    }
+
+    // Rule of Five: disable copy and move (bound to the enclosing block)
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+    ProfileScope(ProfileScope&&) = delete;
+    ProfileScope& operator=(ProfileScope&&) = delete;
+};
+
+/// RAII GPU scope, used through PROJECT_PROFILE_GPU_SCOPE
+class GpuProfileScope {
+public:
+    explicit GpuProfileScope(const char* name) {
+        Profiler::instance().beginGpuScope(name);
+    }
+
+    ~GpuProfileScope() {
+        Profiler::instance().endGpuScope();
+    }
+
+    // Rule of Five: disable copy and move (bound to the enclosing block)
+    GpuProfileScope(const GpuProfileScope&) = delete;
+    GpuProfileScope& operator=(const GpuProfileScope&) = delete;
+    GpuProfileScope(GpuProfileScope&&) = delete;
+    GpuProfileScope& operator=(GpuProfileScope&&) = delete;
+};
+
+} // namespace project
+
+#define PROJECT_PROFILE_CONCAT_IMPL(a, b) a##b
+#define PROJECT_PROFILE_CONCAT(a, b) PROJECT_PROFILE_CONCAT_IMPL(a, b)
+
+#if defined(PROJECT_ENABLE_PROFILER)
+/// Time the rest of the enclosing block as a CPU scope
+#define PROJECT_PROFILE_SCOPE(name) \
+    const ::project::ProfileScope PROJECT_PROFILE_CONCAT(profileScope, __LINE__)(name)
+/// Time the GPU work issued in the rest of the enclosing block
+#define PROJECT_PROFILE_GPU_SCOPE(name) \
+    const ::project::GpuProfileScope PROJECT_PROFILE_CONCAT(gpuProfileScope, __LINE__)(name)
+#define PROJECT_PROFILE_BEGIN_FRAME() ::project::Profiler::instance().beginFrame()
+#define PROJECT_PROFILE_END_FRAME() ::project::Profiler::instance().endFrame()
+#else
+#define PROJECT_PROFILE_SCOPE(name) static_cast<void>(0)
+#define PROJECT_PROFILE_GPU_SCOPE(name) static_cast<void>(0)
+#define PROJECT_PROFILE_BEGIN_FRAME() static_cast<void>(0)
+#define PROJECT_PROFILE_END_FRAME() static_cast<void>(0)
+#endif
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <project/debris_system.hpp>
+#include <project/debug_draw.hpp>
+#include <project/ecs_components.hpp>
+#include <entt/entt.hpp>
+#include <raylib.h>
+#include <cstdint>
+#include <vector>
+
+namespace project {
+
+/// One renderable as the simulation left it at the end of a step
+struct RenderItem {
+    entt::entity entity{entt::null};
+    ModelHandle model;
+    LodHandle lod;                     // Level-of-detail chain (null: always draw model)
+    Transform transform;
+    PreviousTransform previous;
+    BoundingBox bounds{};              // World bounds used for culling (valid if hasBounds)
+    Color color{WHITE};
+    mutable std::uint8_t lodLevel{0};  // Level drawn last, for hysteresis (updated while drawing)
+    bool hasPrevious{false};
+    bool hasBounds{false};
+    bool isGround{false};
+};
+
+/// Everything the GL thread needs to draw one simulated frame, without touching the registry
+///
+/// Captured by RenderSystem::captureSnapshot at the end of a simulation step and drawn by
+/// RenderSystem::drawSnapshot. Scenes keep two: the simulation fills one while the other is
+/// drawn, and they swap once the step finished.
+struct RenderSnapshot {
+    std::vector<RenderItem> items;
+    std::vector<DebrisDrawBatch> debris;
+    DebugLines debugLines;           // Empty unless debug drawing is enabled
+    float interpolationAlpha{1.0F};  // Blend from previous to transform (1 = latest physics state)
+    
+    // Items that passed culling in the last draw; scratch storage kept between frames
+    mutable std::vector<const RenderItem*> drawList;
+};
+
+} // namespace project
@@ -1,20 +1,28 @@
 #pragma once
 
+#include <project/asset_cache.hpp>
+#include <project/string_hash.hpp>
 #include <raylib.h>
 #include <raymath.h>
-#include <vector>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <span>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 
 namespace project {
 
 /// Represents a single object in a 3D scene with position, rotation, and scale
 struct SceneObject {
-    Model model;
+    ModelHandle model;  // Shared with any other object using the same asset
     Vector3 position{0.0F, 0.0F, 0.0F};
     Vector3 rotation{0.0F, 0.0F, 0.0F};  // Rotation in degrees (pitch, yaw, roll)
     float scale{1.0F};
     Color tint{WHITE};
-    std::string name;  // Optional identifier
+    std::string_view name;  // Optional identifier, interned by the owning Scene (change with Scene::renameObject)
     
     /// Draw this object in 3D space
     void draw() const;
@@ -23,7 +31,26 @@ struct SceneObject {
     [[nodiscard]] Matrix getTransformMatrix() const;
 };
 
+/// Stable reference to an object of a Scene
+/// Stays valid until the object is removed; a handle to a removed object never matches a
+/// newer object reusing its slot (the generation differs)
+struct SceneObjectHandle {
+    static constexpr std::uint32_t kInvalidIndex = std::numeric_limits<std::uint32_t>::max();
+    
+    std::uint32_t index{kInvalidIndex};  // Slot in the scene's slot table
+    std::uint32_t generation{0};
+    
+    [[nodiscard]] bool isValid() const noexcept { return index != kInvalidIndex; }
+    
+    bool operator==(const SceneObjectHandle&) const = default;
+};
+
 /// Manages a collection of 3D objects and provides scene-level operations
+///
+/// Objects are stored densely and removed by swapping the last object into the gap, so
+/// iteration order changes on removal; handles go through a slot table and keep pointing at
+/// the same object. Names are interned in a hashed index: each distinct name is stored once
+/// and objects refer to it, and lookups take a string_view without allocating.
 class Scene {
 public:
     Scene() = default;
@@ -35,28 +62,44 @@ public:
     Scene(Scene&&) noexcept = default;
     Scene& operator=(Scene&&) noexcept = default;
     
-    /// Add an object to the scene (takes ownership of the model)
-    /// Returns the index of the added object
-    [[nodiscard]] size_t addObject(Model model, Vector3 position = Vector3Zero(), 
-                                   float scale = 1.0F, const std::string& name = "");
+    /// Add an object to the scene (shares the model handle)
+    /// Returns a handle to the added object
+    [[nodiscard]] SceneObjectHandle addObject(ModelHandle model, Vector3 position = Vector3Zero(), 
+                                              float scale = 1.0F, std::string_view name = {});
     
     /// Add an object with full transform parameters
-    [[nodiscard]] size_t addObject(Model model, Vector3 position, Vector3 rotation, 
-                                   float scale, const std::string& name = "");
+    [[nodiscard]] SceneObjectHandle addObject(ModelHandle model, Vector3 position, Vector3 rotation, 
+                                              float scale, std::string_view name = {});
+    
+    /// Get an object by handle (returns nullptr if it was removed)
+    [[nodiscard]] SceneObject* getObject(SceneObjectHandle handle);
+    [[nodiscard]] const SceneObject* getObject(SceneObjectHandle handle) const;
+    
+    /// Check if a handle still refers to an object of this scene
+    [[nodiscard]] bool contains(SceneObjectHandle handle) const noexcept;
     
-    /// Get a reference to an object by index
-    [[nodiscard]] SceneObject& getObject(size_t index);
-    [[nodiscard]] const SceneObject& getObject(size_t index) const;
+    /// Get every object (order changes when objects are removed)
+    [[nodiscard]] std::span<SceneObject> getObjects() noexcept { return objects; }
+    [[nodiscard]] std::span<const SceneObject> getObjects() const noexcept { return objects; }
     
-    /// Get object by name (returns nullptr if not found)
-    [[nodiscard]] SceneObject* findObjectByName(const std::string& name);
-    [[nodiscard]] const SceneObject* findObjectByName(const std::string& name) const;
+    /// Get object by name (returns nullptr if not found, or for an empty name)
+    /// With several objects of the same name, returns one of them
+    [[nodiscard]] SceneObject* findObjectByName(std::string_view name);
+    [[nodiscard]] const SceneObject* findObjectByName(std::string_view name) const;
     
-    /// Remove an object from the scene by index
-    void removeObject(size_t index);
+    /// Get the handle of an object by name (invalid handle if not found)
+    [[nodiscard]] SceneObjectHandle findHandleByName(std::string_view name) const;
+    
+    /// Change the name of an object
+    /// @return False if the handle no longer refers to an object
+    bool renameObject(SceneObjectHandle handle, std::string_view name);
+    
+    /// Remove an object from the scene (no effect on a stale handle)
+    /// @return True if an object was removed
+    bool removeObject(SceneObjectHandle handle);
     
     /// Remove an object from the scene by name
-    bool removeObjectByName(const std::string& name);
+    bool removeObjectByName(std::string_view name);
     
     /// Get the number of objects in the scene
     [[nodiscard]] size_t getObjectCount() const noexcept { return objects.size(); }
@@ -71,8 +114,33 @@ public:
     void clear();
     
 private:
+    /// Slot table entry: where the object of a handle lives in the dense array
+    struct Slot {
+        std::uint32_t denseIndex{SceneObjectHandle::kInvalidIndex};  // Invalid while free
+        std::uint32_t generation{0};
+    };
+    
+    /// Name index entry: an object carrying the name, and how many objects do
+    struct NameEntry {
+        SceneObjectHandle handle;
+        std::uint32_t count{0};
+    };
+    
     std::vector<SceneObject> objects;
+    std::vector<std::uint32_t> objectSlots;  // Slot of each object, parallel to objects
+    std::vector<Slot> slots;
+    std::vector<std::uint32_t> freeSlots;
+    
+    // Keys own the interned names; node-based, so the SceneObject views stay valid
+    std::unordered_map<std::string, NameEntry, TransparentStringHash, std::equal_to<>> nameIndex;
+    
+    [[nodiscard]] SceneObjectHandle insert(SceneObject object, std::string_view name);
+    
+    /// Point an object at the interned copy of a name and count it in the index
+    void indexName(SceneObjectHandle handle, SceneObject& object, std::string_view name);
+    
+    /// Drop an object's name from the index (an interned name is freed with its last object)
+    void unindexName(SceneObjectHandle handle, std::string_view name);
 };
 
 } // namespace project
-
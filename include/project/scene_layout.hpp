@@ -0,0 +1,60 @@
+#pragma once
+
+#include <raylib.h>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+namespace project {
+
+/// Ground and box layout of the physics scene
+///
+/// Shared by BulletPhysicsScene and HeadlessWorld, so a headless run steps exactly the
+/// bodies the interactive scene would (minus the model-based character and car).
+class PhysicsSceneLayout {
+public:
+    PhysicsSceneLayout() = delete;
+
+    static constexpr Vector3 kGroundHalfExtents{20.0F, 0.5F, 20.0F};
+    static constexpr float kGroundY = -0.5F;  // Top face at y = 0
+
+    static constexpr float kBoxHalfExtent = 0.5F;
+    static constexpr float kBoxMass = 1.0F;
+    static constexpr size_t kLayerSide = 16;  // Boxes per row; a 16x16 layer fits on the ground
+    static constexpr size_t kLayerSize = kLayerSide * kLayerSide;
+
+    /// Get the row length of a batch of boxes
+    /// Square layers are filled from the bottom up, so large counts grow upwards instead of off the ground
+    /// @param count Boxes spawned together
+    [[nodiscard]] static size_t getBoxRowLength(size_t count) {
+        return std::min(kLayerSide, static_cast<size_t>(std::ceil(std::sqrt(static_cast<float>(count)))));
+    }
+
+    /// Get the number of layers a batch of boxes fills (the last one possibly in part)
+    /// @param count Boxes spawned together
+    [[nodiscard]] static size_t getBoxLayerCount(size_t count) {
+        return (count + kLayerSize - 1) / kLayerSize;
+    }
+
+    /// Get the spawn position of one box of a batch
+    /// A batch stacked on earlier ones passes indices from firstLayer * kLayerSize on: its
+    /// boxes start above every earlier layer instead of inside it
+    /// @param boxIndex Index of the box within its batch
+    /// @param rowLength getBoxRowLength() of the batch
+    [[nodiscard]] static Vector3 getBoxPosition(size_t boxIndex, size_t rowLength) {
+        constexpr float kStartHeight = 5.0F;
+        constexpr float kSpacing = 2.0F;
+        constexpr float kLayerSpacing = 1.5F;
+
+        const size_t layer = boxIndex / kLayerSize;
+        const size_t cell = boxIndex % kLayerSize;
+        const float rowOffset = static_cast<float>(rowLength) / 2.0F;
+        return Vector3{
+            (static_cast<float>(cell % rowLength) - rowOffset) * kSpacing,
+            kStartHeight + (static_cast<float>(layer) * kLayerSpacing),
+            (static_cast<float>(cell / rowLength) - rowOffset) * kSpacing
+        };
+    }
+};
+
+} // namespace project
@@ -1,16 +1,36 @@
 #pragma once
 
 #include <project/scene_strategy.hpp>
+#include <project/asset_cache.hpp>
+#include <project/simulation_thread.hpp>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
 namespace project {
 
+/// Lifecycle state of a registered scene
+enum class SceneResidency {
+    Cold,    // Not initialized (never activated, or evicted)
+    Warm,    // Initialized but inactive: kept in memory, not updated or drawn
+    Active   // The current scene
+};
+
+/// How many inactive scenes SceneManager keeps initialized
+struct SceneResidencyPolicy {
+    size_t maxWarmScenes{1};      // Inactive scenes kept initialized (0: tear down on every switch)
+    bool preloadNext{true};       // Call preload() on the next scene after each switch
+    size_t memoryBudgetBytes{0};  // Evict warm scenes while the resident estimate exceeds this (0: no limit)
+};
+
 /// Manages scene switching using the Strategy pattern
 /// Allows switching between different scene implementations at runtime
 class SceneManager {
 public:
     SceneManager();
+    
+    /// @param assetCache Shared asset cache; assets left unused after a scene switch are released
+    explicit SceneManager(AssetCache* assetCache);
     ~SceneManager() = default;
     
     // Rule of Five: disable copy, allow move
@@ -42,16 +62,72 @@ public:
     [[nodiscard]] const SceneStrategy* getCurrentScene() const noexcept;
     
     /// Update the current scene
+    /// In pipelined mode this waits for the step started last frame, publishes its frame and
+    /// runs the scene's GL-thread work; the next step starts in startSimulation()
     void update();
     
+    /// Start the next simulation step of the current scene on the simulation thread
+    /// Call after any GUI edits of the frame and before draw(); no-op unless pipelined
+    void startSimulation();
+    
+    /// Enable or disable stepping the simulation on its own thread, overlapped with drawing
+    /// Scenes that do not support it keep updating inline
+    void setPipelined(bool enabled);
+    
+    /// Check if pipelined mode is enabled
+    [[nodiscard]] bool isPipelined() const noexcept { return pipelined; }
+    
+    /// Check if the current scene is stepped on the simulation thread
+    [[nodiscard]] bool isCurrentScenePipelined() const noexcept;
+    
     /// Draw the current scene
     void draw() const;
+    
+    /// Get a registered scene by index (nullptr if out of range)
+    [[nodiscard]] const SceneStrategy* getScene(size_t index) const noexcept;
+    
+    /// Get the residency state of a registered scene
+    [[nodiscard]] SceneResidency getSceneResidency(size_t index) const noexcept;
+    
+    /// Get the residency policy
+    [[nodiscard]] const SceneResidencyPolicy& getResidencyPolicy() const noexcept { return residencyPolicy; }
+    
+    /// Set the residency policy (evicts warm scenes right away if the new policy requires it)
+    void setResidencyPolicy(const SceneResidencyPolicy& policy);
+    
+    /// Get the summed memory estimate of every initialized scene, in bytes
+    [[nodiscard]] size_t getResidentMemoryEstimate() const;
+    
+    /// Report the memory of every initialized scene and of the asset cache to a tracker
+    /// Call between MemoryTracker::beginSample() and endSample(), while no step is in flight
+    /// (after update() and before startSimulation())
+    void reportMemory(MemoryTracker& tracker);
 
 private:
     std::vector<std::unique_ptr<SceneStrategy>> scenes;
+    std::vector<SceneResidency> residency;      // Parallel to scenes
+    std::vector<std::uint64_t> lastActivated;   // Parallel to scenes, for LRU eviction
+    std::uint64_t activationCounter{0};
     size_t currentSceneIndex{0};
+    AssetCache* assetCache{nullptr};
+    SceneResidencyPolicy residencyPolicy;
+    
+    // Pipelined mode; the thread is created on first use and declared last so it joins
+    // before the scenes its job points at are destroyed
+    bool pipelined{false};
+    SceneStrategy* publishedScene{nullptr};  // Scene whose last simulate() result draw() shows
+    std::unique_ptr<SimulationThread> simulationThread;
+    
+    /// Wait until no simulation step is in flight
+    void waitForSimulation() const;
     
     void activateScene(size_t index);
+    
+    /// Cleanup least recently used warm scenes until the policy is met
+    void enforceResidencyPolicy();
+    
+    /// Cleanup one scene and mark it cold
+    void evictScene(size_t index);
 };
 
 } // namespace project
@@ -1,9 +1,12 @@
 #pragma once
 
 #include <raylib.h>
+#include <cstddef>
 
 namespace project {
 
+class MemoryTracker;
+
 /// Abstract base class for scene rendering strategies (Strategy pattern)
 /// This allows different scene implementations to be swapped at runtime
 class SceneStrategy {
@@ -25,12 +28,43 @@ public:
     /// Draw the scene (called each frame)
     virtual void draw() const = 0;
     
+    /// Check if the scene splits its update for SceneManager's pipelined mode
+    /// Pipelined scenes step the simulation on a separate thread while the last finished step is
+    /// drawn, so draw() must then read only what publishFrame() handed over
+    [[nodiscard]] virtual bool supportsPipelining() const { return false; }
+    
+    /// Pipelined mode: the part of update() that stays on the GL thread (asset swaps, edits)
+    /// Runs while no simulation step is in flight, as does everything else but draw()
+    virtual void updateMainThread() {}
+    
+    /// Pipelined mode: the part of update() run on the simulation thread
+    /// Must not call GL or touch anything draw() reads; ends by capturing the frame to draw
+    /// @param deltaTime Frame time to simulate, in seconds
+    virtual void simulate(float deltaTime) { static_cast<void>(deltaTime); }
+    
+    /// Pipelined mode: make the frame captured by the last simulate() the one draw() shows
+    /// Called on the GL thread once that step finished
+    virtual void publishFrame() {}
+    
     /// Initialize the scene (called when scene becomes active)
     virtual void initialize() {}
     
-    /// Cleanup the scene (called when scene becomes inactive)
+    /// Cleanup the scene (called when the scene is evicted; warm scenes skip this on switch)
     virtual void cleanup() {}
     
+    /// Start loading assets in the background ahead of initialize() (e.g. via AssetCache::requestModel)
+    /// Must stay cheap: it runs on the frame that switches to the previous scene
+    virtual void preload() {}
+    
+    /// Estimate the memory this scene keeps resident while initialized, in bytes
+    /// Used by SceneManager to evict warm scenes under a memory budget
+    [[nodiscard]] virtual size_t getMemoryEstimate() const { return 0; }
+    
+    /// Add the memory this scene owns to the tracker's categories (see MemoryTracker::addMeasured)
+    /// Called between samples while no simulation step is in flight; shared assets are
+    /// reported by the asset cache instead
+    virtual void reportMemory(MemoryTracker& tracker) { static_cast<void>(tracker); }
+    
 protected:
     SceneStrategy() = default;
 };
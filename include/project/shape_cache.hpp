@@ -0,0 +1,96 @@
+#pragma once
+
+#include <raylib.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <unordered_map>
+
+class btCollisionShape;
+
+namespace project {
+
+/// Shared handle to an interned Bullet collision shape
+/// Rigid bodies only keep a raw pointer, so the PhysicsBody holding the handle must
+/// destroy its rigid body before releasing the handle
+using ShapeHandle = std::shared_ptr<btCollisionShape>;
+
+/// Interns collision shapes so bodies with identical geometry share one btCollisionShape
+///
+/// Primitive shapes are keyed by type and exact parameters; convex hulls are keyed by a
+/// hash of the model's vertex data, so a hull is computed once per model, not per spawn.
+///
+/// Like AssetCache, the cache keeps its own reference to every shape; call releaseUnused()
+/// to delete shapes no body uses anymore.
+class ShapeCache {
+public:
+    ShapeCache() = default;
+    ~ShapeCache() = default;
+
+    // Rule of Five: disable copy, allow move
+    ShapeCache(const ShapeCache&) = delete;
+    ShapeCache& operator=(const ShapeCache&) = delete;
+    ShapeCache(ShapeCache&&) noexcept = default;
+    ShapeCache& operator=(ShapeCache&&) noexcept = default;
+
+    /// Get a shared box shape
+    /// @param halfExtents Half size along each axis
+    [[nodiscard]] ShapeHandle acquireBox(const Vector3& halfExtents);
+
+    /// Get a shared Y-axis capsule shape
+    /// @param radius Capsule radius
+    /// @param height Height of the cylindrical part (excluding the caps)
+    [[nodiscard]] ShapeHandle acquireCapsule(float radius, float height);
+
+    /// Get a shared sphere shape
+    /// @param radius Sphere radius
+    [[nodiscard]] ShapeHandle acquireSphere(float radius);
+
+    /// Get a shared convex hull around every vertex of a model (in model space, including
+    /// model.transform), simplified to at most a few dozen points
+    /// @param model Model with CPU-side vertex data
+    /// @return Handle to the hull, or nullptr if the model has no vertices
+    [[nodiscard]] ShapeHandle acquireConvexHull(const Model& model);
+
+    /// Get a shared convex hull over points that were already simplified (e.g. baked offline)
+    /// @param hullPoints Hull points in model space
+    /// @return Handle to the hull, or nullptr if there are no points
+    [[nodiscard]] ShapeHandle acquireConvexHull(std::span<const Vector3> hullPoints);
+
+    /// Delete every shape that is only referenced by the cache itself
+    /// @return Number of shapes released
+    size_t releaseUnused();
+
+    /// Drop all cache references (shapes still in use stay alive until their last handle goes away)
+    void clear();
+
+    /// Get the number of cached shapes
+    [[nodiscard]] size_t getShapeCount() const noexcept { return shapes.size(); }
+
+private:
+    enum class ShapeType : std::uint32_t {
+        Box,
+        Capsule,
+        Sphere,
+        ConvexHull
+    };
+
+    struct ShapeKey {
+        ShapeType type{ShapeType::Box};
+        std::uint64_t parameters[2]{0, 0};  // Packed float bits, or the mesh hash for hulls
+
+        bool operator==(const ShapeKey&) const = default;
+    };
+
+    struct ShapeKeyHash {
+        size_t operator()(const ShapeKey& key) const noexcept;
+    };
+
+    /// Hash the vertex data and transform of a model (FNV-1a)
+    [[nodiscard]] static std::uint64_t hashModelGeometry(const Model& model);
+
+    std::unordered_map<ShapeKey, ShapeHandle, ShapeKeyHash> shapes;
+};
+
+} // namespace project
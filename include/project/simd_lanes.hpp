@@ -0,0 +1,103 @@
+#pragma once
+
+// Four-wide float helpers shared by the vectorized kernels (TransformPool, DebrisSystem)
+//
+// SSE2 and AArch64 NEON are baseline on their targets, so the kernels need no runtime
+// dispatch or per-file compiler flags. Elsewhere kLaneCount is 0 and the kernels run their
+// scalar remainder loops only.
+
+#include <cstddef>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define PROJECT_SIMD_SSE2
+#elif (defined(__ARM_NEON) && defined(__aarch64__)) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define PROJECT_SIMD_NEON
+#endif
+
+namespace project::simd {
+
+#if defined(PROJECT_SIMD_SSE2)
+    inline constexpr const char* kInstructionSetName = "SSE2";
+    inline constexpr size_t kLaneCount = 4;
+    using Lanes = __m128;
+
+    inline Lanes load(const float* values) { return _mm_loadu_ps(values); }
+    inline void store(Lanes value, float* destination) { _mm_storeu_ps(destination, value); }
+    inline Lanes splat(float value) { return _mm_set1_ps(value); }
+    inline Lanes add(Lanes lhs, Lanes rhs) { return _mm_add_ps(lhs, rhs); }
+    inline Lanes sub(Lanes lhs, Lanes rhs) { return _mm_sub_ps(lhs, rhs); }
+    inline Lanes mul(Lanes lhs, Lanes rhs) { return _mm_mul_ps(lhs, rhs); }
+    inline Lanes max(Lanes lhs, Lanes rhs) { return _mm_max_ps(lhs, rhs); }
+    inline Lanes sqrt(Lanes value) { return _mm_sqrt_ps(value); }
+    inline Lanes reciprocalSqrt(Lanes value) { return _mm_div_ps(_mm_set1_ps(1.0F), _mm_sqrt_ps(value)); }
+    inline Lanes signBits(Lanes value) { return _mm_and_ps(value, _mm_set1_ps(-0.0F)); }
+    inline Lanes flipSign(Lanes value, Lanes sign) { return _mm_xor_ps(value, sign); }
+
+    /// All bits set in the lanes where lhs < rhs
+    inline Lanes lessThan(Lanes lhs, Lanes rhs) { return _mm_cmplt_ps(lhs, rhs); }
+
+    /// Pick ifTrue in the lanes where mask is set, ifFalse elsewhere
+    inline Lanes select(Lanes mask, Lanes ifTrue, Lanes ifFalse) {
+        return _mm_or_ps(_mm_and_ps(mask, ifTrue), _mm_andnot_ps(mask, ifFalse));
+    }
+
+    /// Write lane k of (a, b, c, d) as one matrix row: to rows + k * 16 floats
+    inline void storeRows(Lanes a, Lanes b, Lanes c, Lanes d, float* rows) {
+        _MM_TRANSPOSE4_PS(a, b, c, d);
+        _mm_storeu_ps(rows, a);
+        _mm_storeu_ps(rows + 16, b);
+        _mm_storeu_ps(rows + 32, c);
+        _mm_storeu_ps(rows + 48, d);
+    }
+
+    inline void storeRow(const float* row, float* destination) { _mm_storeu_ps(destination, _mm_loadu_ps(row)); }
+#elif defined(PROJECT_SIMD_NEON)
+    inline constexpr const char* kInstructionSetName = "NEON";
+    inline constexpr size_t kLaneCount = 4;
+    using Lanes = float32x4_t;
+
+    inline Lanes load(const float* values) { return vld1q_f32(values); }
+    inline void store(Lanes value, float* destination) { vst1q_f32(destination, value); }
+    inline Lanes splat(float value) { return vdupq_n_f32(value); }
+    inline Lanes add(Lanes lhs, Lanes rhs) { return vaddq_f32(lhs, rhs); }
+    inline Lanes sub(Lanes lhs, Lanes rhs) { return vsubq_f32(lhs, rhs); }
+    inline Lanes mul(Lanes lhs, Lanes rhs) { return vmulq_f32(lhs, rhs); }
+    inline Lanes max(Lanes lhs, Lanes rhs) { return vmaxq_f32(lhs, rhs); }
+    inline Lanes sqrt(Lanes value) { return vsqrtq_f32(value); }
+    inline Lanes reciprocalSqrt(Lanes value) { return vdivq_f32(vdupq_n_f32(1.0F), vsqrtq_f32(value)); }
+
+    inline Lanes signBits(Lanes value) {
+        return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(value), vdupq_n_u32(0x80000000U)));
+    }
+
+    inline Lanes flipSign(Lanes value, Lanes sign) {
+        return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(value), vreinterpretq_u32_f32(sign)));
+    }
+
+    /// All bits set in the lanes where lhs < rhs
+    inline Lanes lessThan(Lanes lhs, Lanes rhs) { return vreinterpretq_f32_u32(vcltq_f32(lhs, rhs)); }
+
+    /// Pick ifTrue in the lanes where mask is set, ifFalse elsewhere
+    inline Lanes select(Lanes mask, Lanes ifTrue, Lanes ifFalse) {
+        return vbslq_f32(vreinterpretq_u32_f32(mask), ifTrue, ifFalse);
+    }
+
+    /// Write lane k of (a, b, c, d) as one matrix row: to rows + k * 16 floats
+    inline void storeRows(Lanes a, Lanes b, Lanes c, Lanes d, float* rows) {
+        const float32x4x2_t ab = vtrnq_f32(a, b);
+        const float32x4x2_t cd = vtrnq_f32(c, d);
+        vst1q_f32(rows, vcombine_f32(vget_low_f32(ab.val[0]), vget_low_f32(cd.val[0])));
+        vst1q_f32(rows + 16, vcombine_f32(vget_low_f32(ab.val[1]), vget_low_f32(cd.val[1])));
+        vst1q_f32(rows + 32, vcombine_f32(vget_high_f32(ab.val[0]), vget_high_f32(cd.val[0])));
+        vst1q_f32(rows + 48, vcombine_f32(vget_high_f32(ab.val[1]), vget_high_f32(cd.val[1])));
+    }
+
+    inline void storeRow(const float* row, float* destination) { vst1q_f32(destination, vld1q_f32(row)); }
+#else
+    inline constexpr const char* kInstructionSetName = "scalar";
+    inline constexpr size_t kLaneCount = 0;
+#endif
+
+} // namespace project::simd
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <stop_token>
+#include <thread>
+
+namespace project {
+
+/// Dedicated thread that runs one simulation step at a time, next to the GL thread
+///
+/// The hand-off is a pair of counters used as a fence: start() bumps the submitted count and
+/// the thread bumps the completed count when the job returns. Both sides block with atomic
+/// wait/notify, so no mutex is taken per frame. start() and wait() are called from one thread.
+///
+/// Jobs must not throw.
+class SimulationThread {
+public:
+    using Job = std::function<void()>;
+    
+    SimulationThread();
+    ~SimulationThread();
+    
+    // Rule of Five: disable copy and move (the thread points at this object)
+    SimulationThread(const SimulationThread&) = delete;
+    SimulationThread& operator=(const SimulationThread&) = delete;
+    SimulationThread(SimulationThread&&) = delete;
+    SimulationThread& operator=(SimulationThread&&) = delete;
+    
+    /// Run a job on the thread; waits for the previous job first
+    void start(Job job);
+    
+    /// Block until the last started job finished (returns at once when idle)
+    void wait() const;
+    
+    /// Check if a job is still running
+    [[nodiscard]] bool isBusy() const noexcept;
+    
+private:
+    Job pendingJob;                          // Written by start() only while the thread is idle
+    std::atomic<std::uint64_t> submitted{0};
+    std::atomic<std::uint64_t> completed{0};
+    std::jthread thread;                     // Last member: joins before the state above goes away
+    
+    void threadLoop(std::stop_token stopToken);
+};
+
+} // namespace project
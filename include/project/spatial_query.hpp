@@ -0,0 +1,73 @@
+#pragma once
+
+#include <entt/entt.hpp>
+#include <raylib.h>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+// Forward declarations for Bullet Physics
+class btCollisionWorld;
+
+namespace project {
+
+/// Line segment for ray queries
+struct RaySegment {
+    Vector3 from{0.0F, 0.0F, 0.0F};
+    Vector3 to{0.0F, 0.0F, 0.0F};
+};
+
+/// Closest hit along a ray
+struct RayHit {
+    entt::entity entity{entt::null};  // Entity owning the body that was hit
+    Vector3 point{0.0F, 0.0F, 0.0F};
+    Vector3 normal{0.0F, 0.0F, 0.0F};
+    float fraction{1.0F};  // Position along the ray (0 at from, 1 at to)
+    bool hit{false};
+};
+
+/// Entity found by a nearest-neighbour query
+struct NearestHit {
+    entt::entity entity{entt::null};
+    float distance{0.0F};  // From the query point to the body's origin
+};
+
+/// Read-only spatial queries against a physics world's broadphase, returning entities
+///
+/// Overlaps and nearest-neighbour queries walk the btDbvtBroadphase trees and test body
+/// AABBs, so they are conservative: a rotated box matches wherever its AABB does. Rays
+/// run Bullet's full narrowphase and report exact hits.
+///
+/// Queries read the world and must not overlap a simulation step. Cheap to copy; create
+/// one from PhysicsWorld::getSpatialQuery() when needed.
+class SpatialQuery {
+public:
+    /// @param world Collision world to query (nullptr: every query returns nothing)
+    explicit SpatialQuery(btCollisionWorld* world) noexcept : world(world) {}
+
+    /// Cast a ray and report the closest hit
+    [[nodiscard]] RayHit raycast(const Vector3& from, const Vector3& to) const;
+
+    /// Cast many rays, spread over Bullet's task scheduler in multithreaded builds
+    /// @param rays Rays to cast
+    /// @param hits Receives one result per ray, in order (resized to rays.size())
+    void raycastBatch(std::span<const RaySegment> rays, std::vector<RayHit>& hits) const;
+
+    /// Find entities whose body AABB intersects a sphere
+    [[nodiscard]] std::vector<entt::entity> overlapSphere(const Vector3& center, float radius) const;
+
+    /// Find entities whose body AABB intersects an axis-aligned box
+    [[nodiscard]] std::vector<entt::entity> overlapBox(const Vector3& center, const Vector3& halfExtents) const;
+
+    /// Find the entities whose body origins are closest to a point
+    /// @param point Query point
+    /// @param count Maximum number of results
+    /// @param maxDistance Search radius (bounds the broadphase walk)
+    /// @return Up to count hits, closest first
+    [[nodiscard]] std::vector<NearestHit> nearest(const Vector3& point, size_t count, float maxDistance) const;
+
+private:
+    btCollisionWorld* world{nullptr};
+};
+
+} // namespace project
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <project/asset_cache.hpp>
+#include <project/ecs_systems.hpp>
+#include <project/frustum.hpp>
+#include <entt/entt.hpp>
+#include <raylib.h>
+#include <cstddef>
+#include <vector>
+
+namespace project {
+
+/// Static renderables merged into a few large, pre-transformed meshes
+///
+/// Every mesh of every StaticMesh entity is transformed to world space and appended to the
+/// chunk of its material's shader and albedo texture. Per-material colors and entity tints
+/// are baked into the vertex colors, so entities differing only in tint share a chunk.
+/// Chunks hold at most 65535 vertices (raylib's 16-bit indices).
+///
+/// Build and draw on the GL thread. The source models stay referenced while the batch holds
+/// their materials.
+class StaticBatch {
+public:
+    StaticBatch() = default;
+    ~StaticBatch();
+    
+    // Rule of Five: disable copy and move (owns GPU meshes)
+    StaticBatch(const StaticBatch&) = delete;
+    StaticBatch& operator=(const StaticBatch&) = delete;
+    StaticBatch(StaticBatch&&) = delete;
+    StaticBatch& operator=(StaticBatch&&) = delete;
+    
+    /// Merge every StaticMesh entity, replacing the previous chunks
+    /// @param registry The ECS registry
+    void build(const entt::registry& registry);
+    
+    /// Rebuild if static content changed since the last build
+    /// @param registry The ECS registry
+    void update(const entt::registry& registry) {
+        if (dirty) {
+            build(registry);
+        }
+    }
+    
+    /// Request a rebuild on the next update() (static entities were created or destroyed)
+    void markDirty() noexcept { dirty = true; }
+    
+    /// Unload every chunk and drop the source models
+    void clear();
+    
+    /// Draw the chunks
+    /// @param frustum Camera frustum; chunks outside it are skipped (nullptr: no culling)
+    /// @param stats Culling counters to accumulate into, one per chunk (optional)
+    void draw(const Frustum* frustum = nullptr, CullingStats* stats = nullptr) const;
+    
+    /// Get the number of merged meshes (one draw call each)
+    [[nodiscard]] size_t getChunkCount() const noexcept { return chunks.size(); }
+    
+    /// Get the number of entities merged by the last build
+    [[nodiscard]] size_t getEntityCount() const noexcept { return entityCount; }
+    
+    /// Get the number of source meshes merged by the last build
+    [[nodiscard]] size_t getSourceMeshCount() const noexcept { return sourceMeshCount; }
+    
+    /// Get the size of the merged vertex and index data (held once in RAM and once on the GPU)
+    [[nodiscard]] size_t getMeshBytes() const noexcept;
+    
+private:
+    struct Chunk {
+        Mesh mesh{};
+        Material material{};  // Copy of a source material (maps shared with the source model)
+        BoundingBox bounds{};
+    };
+    
+    std::vector<Chunk> chunks;
+    std::vector<ModelHandle> sourceModels;  // Keep the materials the chunks point at alive
+    size_t entityCount{0};
+    size_t sourceMeshCount{0};
+    bool dirty{true};
+};
+
+} // namespace project
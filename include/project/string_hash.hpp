@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace project {
+
+inline constexpr std::uint64_t kFnv1aOffsetBasis = 14695981039346656037ULL;
+inline constexpr std::uint64_t kFnv1aPrime = 1099511628211ULL;
+
+/// 64-bit FNV-1a over raw bytes, stable across runs and platforms (unlike std::hash)
+/// Exact bit patterns are hashed, so any drift changes the result; chain buffers by passing
+/// the previous result as hash
+[[nodiscard]] inline std::uint64_t fnv1a(const void* data, size_t size, std::uint64_t hash = kFnv1aOffsetBasis) noexcept {
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= static_cast<std::uint64_t>(bytes[i]);
+        hash *= kFnv1aPrime;
+    }
+    return hash;
+}
+
+/// Hash for string-keyed unordered containers that also accepts std::string_view and C
+/// strings, so lookups don't build a temporary std::string (pair with std::equal_to<>)
+struct TransparentStringHash {
+    using is_transparent = void;
+    
+    [[nodiscard]] size_t operator()(std::string_view text) const noexcept {
+        return std::hash<std::string_view>{}(text);
+    }
+    
+    [[nodiscard]] size_t operator()(const std::string& text) const noexcept {
+        return std::hash<std::string_view>{}(text);
+    }
+    
+    [[nodiscard]] size_t operator()(const char* text) const noexcept {
+        return std::hash<std::string_view>{}(text);
+    }
+};
+
+} // namespace project
@@ -0,0 +1,168 @@
+#pragma once
+
+#include <project/task_pool.hpp>
+#include <entt/entt.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace project {
+
+/// Components a system reads and writes, declared when it is added to a SystemScheduler
+///
+/// A system may emplace and remove the components it writes. Anything touching entities as a
+/// whole (create, destroy, clear) or components it did not declare must be exclusive().
+class SystemAccess {
+public:
+    /// Declare components the system only reads
+    template <typename... Components>
+    SystemAccess& reads() {
+        (add<Components>(readSet), ...);
+        return *this;
+    }
+
+    /// Declare components the system writes, emplaces or removes
+    template <typename... Components>
+    SystemAccess& writes() {
+        (add<Components>(writeSet), ...);
+        return *this;
+    }
+
+    /// Declare that the system needs the whole registry (runs alone)
+    SystemAccess& exclusive() noexcept {
+        isExclusive = true;
+        return *this;
+    }
+
+    /// Check if two systems may not run at the same time
+    /// (either writes a component the other uses, or either is exclusive)
+    [[nodiscard]] bool conflictsWith(const SystemAccess& other) const;
+
+    /// Create the storage of every declared component
+    /// EnTT creates storage on first use, which changes the registry itself; doing it up front
+    /// leaves concurrent systems touching only their own storage
+    void prepare(entt::registry& registry) const;
+
+private:
+    using StorageFactory = void (*)(entt::registry&);
+
+    struct ComponentEntry {
+        entt::id_type id;
+        StorageFactory createStorage;
+    };
+
+    std::vector<ComponentEntry> readSet;
+    std::vector<ComponentEntry> writeSet;
+    bool isExclusive{false};
+
+    template <typename T>
+    void add(std::vector<ComponentEntry>& set) {
+        const entt::id_type id = entt::type_hash<T>::value();
+        if (std::ranges::none_of(set, [id](const ComponentEntry& entry) { return entry.id == id; })) {
+            set.push_back({id, [](entt::registry& registry) { static_cast<void>(registry.storage<T>()); }});
+        }
+    }
+
+    [[nodiscard]] static bool intersects(const std::vector<ComponentEntry>& lhs, const std::vector<ComponentEntry>& rhs);
+};
+
+/// Runs ECS systems on a TaskPool, in parallel wherever their declared access allows
+///
+/// Systems keep the order they were added in, except that a system overlaps the ones before
+/// it when it conflicts with none of them. Each system is assigned a stage when it is added:
+/// one past the latest stage of any earlier system it conflicts with. The systems of a stage
+/// run concurrently; stages run one after the other.
+class SystemScheduler {
+public:
+    using SystemFunction = std::function<void(entt::registry&)>;
+
+    /// Add a system after the ones added so far
+    /// @param name Display name (debug panel)
+    /// @param access Components the system reads and writes
+    /// @param function Runs the system; may itself split work with TaskPool::parallelFor
+    void add(std::string name, SystemAccess access, SystemFunction function);
+
+    /// Remove every system
+    void clear();
+
+    /// Run every system once
+    /// @param registry Registry passed to the systems
+    /// @param taskPool Threads for systems sharing a stage (the calling thread takes part)
+    void run(entt::registry& registry, TaskPool& taskPool);
+
+    /// Get the number of systems
+    [[nodiscard]] size_t getSystemCount() const noexcept { return systems.size(); }
+
+    /// Get the number of stages the systems were grouped into
+    [[nodiscard]] size_t getStageCount() const noexcept { return stages.size(); }
+
+    /// Get the name of a system
+    [[nodiscard]] const std::string& getSystemName(size_t index) const { return systems[index].name; }
+
+    /// Get the stage a system runs in
+    [[nodiscard]] size_t getSystemStage(size_t index) const { return systems[index].stage; }
+
+private:
+    struct System {
+        std::string name;
+        SystemAccess access;
+        SystemFunction function;
+        size_t stage{0};
+    };
+
+    std::vector<System> systems;
+    std::vector<std::vector<size_t>> stages;  // System indices per stage
+};
+
+/// Run a function for every entity of a view, split into parallel chunks
+/// Walks the packed entity array of the first component's storage and skips entities
+/// missing the others, so chunks are plain index ranges. The function may only touch the
+/// components of the entity it is given. Every component must carry data (no tags).
+/// @param registry The ECS registry
+/// @param taskPool Threads to split the work over
+/// @param grainSize Entities per chunk, at least
+/// @param function Called as function(entity, components&...)
+template <typename Lead, typename... Others, typename Function>
+void parallelEach(entt::registry& registry, TaskPool& taskPool, size_t grainSize, Function function) {
+    auto& leadStorage = registry.storage<Lead>();
+    const entt::entity* entities = leadStorage.data();
+
+    const auto runChunks = [&](auto&... otherStorages) {
+        taskPool.parallelFor(0, leadStorage.size(), grainSize, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                const entt::entity entity = entities[i];
+                if ((otherStorages.contains(entity) && ...)) {
+                    function(entity, leadStorage.get(entity), otherStorages.get(entity)...);
+                }
+            }
+        });
+    };
+    runChunks(registry.storage<Others>()...);
+}
+
+/// Run a function for every entity of a list, split into parallel chunks when a pool is given
+/// @param entities Entities to visit (unique; the function may only touch their own components)
+/// @param taskPool Threads to split the work over (nullptr: run on the calling thread)
+/// @param grainSize Entities per chunk, at least
+/// @param function Called as function(entity)
+template <typename Function>
+void parallelForEntities(std::span<const entt::entity> entities, TaskPool* taskPool, size_t grainSize, Function function) {
+    if (taskPool == nullptr) {
+        for (const entt::entity entity : entities) {
+            function(entity);
+        }
+        return;
+    }
+
+    taskPool->parallelFor(0, entities.size(), grainSize, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            function(entities[i]);
+        }
+    });
+}
+
+} // namespace project
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+namespace project {
+
+/// Tasks started together; TaskPool::wait() returns once all of them finished
+class TaskGroup {
+public:
+    TaskGroup() = default;
+
+    // Rule of Five: disable copy and move (queued tasks point at the group)
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+    TaskGroup(TaskGroup&&) = delete;
+    TaskGroup& operator=(TaskGroup&&) = delete;
+
+    /// Check if every task of the group finished
+    [[nodiscard]] bool isDone() const noexcept { return pending.load(std::memory_order_acquire) == 0; }
+
+private:
+    friend class TaskPool;
+
+    std::atomic<size_t> pending{0};
+};
+
+/// Work-stealing pool of std::jthread workers for CPU-side systems
+///
+/// Every worker owns a queue: it runs its own tasks newest first and, once that is empty,
+/// steals the oldest task from the others. Tasks started from outside the pool go to a
+/// shared queue. Threads waiting on a group run queued tasks before they block, so tasks
+/// may start and wait on groups of their own.
+///
+/// Tasks must not throw.
+class TaskPool {
+public:
+    using Task = std::function<void()>;
+
+    /// Start the workers
+    /// @param workerCount Worker threads besides the calling thread (0: run everything inline)
+    explicit TaskPool(size_t workerCount = getDefaultWorkerCount());
+    ~TaskPool();
+
+    // Rule of Five: disable copy and move (workers point at the pool)
+    TaskPool(const TaskPool&) = delete;
+    TaskPool& operator=(const TaskPool&) = delete;
+    TaskPool(TaskPool&&) = delete;
+    TaskPool& operator=(TaskPool&&) = delete;
+
+    /// Queue a task
+    /// @param group Group to count the task in (must outlive the task)
+    /// @param task Work to run on any thread of the pool
+    void run(TaskGroup& group, Task task);
+
+    /// Run queued tasks on the calling thread until every task of the group finished
+    /// Once nothing is left to run, blocks until the tasks running elsewhere are done
+    void wait(TaskGroup& group);
+
+    /// Split [begin, end) into chunks of about grainSize and run them in parallel
+    /// The calling thread takes the first chunk; returns once every chunk finished
+    /// @param body Called with [chunkBegin, chunkEnd) once per chunk
+    void parallelFor(size_t begin, size_t end, size_t grainSize, const std::function<void(size_t, size_t)>& body);
+
+    /// Get the number of worker threads (the calling thread is not counted)
+    [[nodiscard]] size_t getWorkerCount() const noexcept { return workers.size(); }
+
+    /// Get one worker less than the hardware threads, leaving a core to the main thread
+    [[nodiscard]] static size_t getDefaultWorkerCount() noexcept;
+
+private:
+    struct QueuedTask {
+        Task task;
+        TaskGroup* group{nullptr};
+    };
+
+    struct Queue {
+        std::mutex mutex;
+        std::deque<QueuedTask> tasks;
+    };
+
+    // Queue 0 takes tasks started outside the pool; worker i owns queue i + 1
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::vector<std::jthread> workers;
+
+    std::mutex sleepMutex;
+    std::condition_variable_any wakeCondition;
+    std::atomic<size_t> queuedCount{0};
+
+    // Signalled whenever a group's last task finishes; wait() sleeps on it once nothing is queued
+    std::mutex doneMutex;
+    std::condition_variable doneCondition;
+
+    void workerLoop(std::stop_token stopToken, size_t queueIndex);
+
+    /// Pop a task from the home queue, or steal one from another queue, and run it
+    /// @return False if every queue was empty
+    bool runOne(size_t homeQueue);
+
+    /// Get the queue owned by the calling thread (0 for threads outside the pool)
+    [[nodiscard]] size_t getHomeQueue() const noexcept;
+};
+
+} // namespace project
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <project/ecs_components.hpp>
+#include <entt/entt.hpp>
+#include <raylib.h>
+#include <array>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace project {
+
+/// Structure-of-arrays staging for the transforms drawn in a frame
+///
+/// RenderSystem gathers the poses of the visible entities into one contiguous float stream
+/// per component (position x, y, z, rotation x, y, z, w, ...), then buildMatrices() blends
+/// and composes every world matrix in a single pass: four entities at a time with SSE2 or
+/// NEON, scalar on other targets. Storage is kept between frames, so after warm-up a frame
+/// allocates nothing.
+class TransformPool {
+public:
+    /// Drop all poses and matrices (keeps the storage)
+    void clear() noexcept;
+
+    /// Reserve room for count poses
+    void reserve(size_t count);
+
+    /// Append a pose that does not blend (static entities, or no interpolation)
+    void push(entt::entity entity, const Transform& transform);
+
+    /// Append a pose blended from the previous physics state
+    /// @param entity Entity the pose belongs to
+    /// @param transform Current transform
+    /// @param previous Pose before the latest fixed step
+    void push(entt::entity entity, const Transform& transform, const PreviousTransform& previous);
+
+    /// Blend every pose from previous to current and compose its world matrix
+    /// Rotations are blended with a normalized lerp, which matches slerp closely for the
+    /// small rotations of a single fixed step
+    /// @param interpolationAlpha Blend factor in [0, 1] (1 = current poses only)
+    void buildMatrices(float interpolationAlpha);
+
+    /// Get the number of poses pushed since the last clear()
+    [[nodiscard]] size_t size() const noexcept { return entities.size(); }
+
+    /// Check if no poses were pushed since the last clear()
+    [[nodiscard]] bool empty() const noexcept { return entities.empty(); }
+
+    /// Get the entities, in push order
+    [[nodiscard]] std::span<const entt::entity> getEntities() const noexcept { return entities; }
+
+    /// Get the world matrices from the last buildMatrices(), in push order
+    [[nodiscard]] std::span<const Matrix> getMatrices() const noexcept { return matrices; }
+
+    /// Get the instruction set the matrix kernel was compiled for ("SSE2", "NEON" or "scalar")
+    [[nodiscard]] static const char* getKernelName() noexcept;
+
+private:
+    enum Stream : size_t {
+        PositionX, PositionY, PositionZ,
+        RotationX, RotationY, RotationZ, RotationW,
+        ScaleX, ScaleY, ScaleZ,
+        PreviousPositionX, PreviousPositionY, PreviousPositionZ,
+        PreviousRotationX, PreviousRotationY, PreviousRotationZ, PreviousRotationW,
+        StreamCount
+    };
+
+    std::array<std::vector<float>, StreamCount> streams;
+    std::vector<entt::entity> entities;
+    std::vector<Matrix> matrices;
+};
+
+} // namespace project
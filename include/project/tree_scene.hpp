@@ -2,6 +2,7 @@
 
 #include <project/scene_strategy.hpp>
 #include <project/scene.hpp>
+#include <project/asset_cache.hpp>
 #include <string>
 
 namespace project {
@@ -10,7 +11,9 @@ namespace project {
 /// This is the original scene from the codebase
 class TreeScene : public SceneStrategy {
 public:
-    explicit TreeScene(const std::string& modelPath);
+    /// @param assetCache Cache used to share the tree model (must outlive the scene)
+    /// @param modelPath Path to the tree model file
+    TreeScene(AssetCache& assetCache, const std::string& modelPath);
     ~TreeScene() override;
     
     // Rule of Five: disable copy, allow move
@@ -19,16 +22,21 @@ public:
     TreeScene(TreeScene&&) noexcept = default;
     TreeScene& operator=(TreeScene&&) noexcept = default;
     
+    void update() override;
     void draw() const override;
     [[nodiscard]] const char* getName() const override { return "Tree Scene"; }
     void initialize() override;
     void cleanup() override;
+    void preload() override;
+    [[nodiscard]] size_t getMemoryEstimate() const override;
     
     [[nodiscard]] size_t getObjectCount() const { return scene.getObjectCount(); }
 
 private:
     Scene scene;
+    AssetCache* assetCache{nullptr};
     std::string modelPath;
+    ModelRequestHandle modelRequest;  // Set while the model streams in
     bool isInitialized{false};
     
     static constexpr float kModelScale = 2.0F;
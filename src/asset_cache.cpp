@@ -0,0 +1,501 @@
+#include <project/asset_cache.hpp>
+#include <project/async_asset_loader.hpp>
+#include <project/baked_model.hpp>
+#include <project/lod.hpp>
+#include <project/string_hash.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+// rlgl is compiled into raylib, but its header is not shipped with the prebuilt library
+extern "C" unsigned int rlGetTextureIdDefault();
+
+namespace project {
+
+namespace {
+    /// Release every entry whose only owner is the cache
+    template <typename Map>
+    size_t eraseUnreferenced(Map& map) {
+        size_t released = 0;
+        for (auto iterator = map.begin(); iterator != map.end();) {
+            if (iterator->second.use_count() <= 1) {
+                iterator = map.erase(iterator);
+                ++released;
+            } else {
+                ++iterator;
+            }
+        }
+        return released;
+    }
+
+    /// Drop path -> hash entries that point at assets no longer cached
+    template <typename PathMap, typename AssetMap>
+    void erasePathsWithoutAsset(PathMap& paths, const AssetMap& assets) {
+        for (auto iterator = paths.begin(); iterator != paths.end();) {
+            if (assets.find(iterator->second) == assets.end()) {
+                iterator = paths.erase(iterator);
+            } else {
+                ++iterator;
+            }
+        }
+    }
+
+    /// Estimate one copy of a model's mesh buffers: position, normal, texcoord and color per
+    /// vertex plus 16-bit indices (raylib keeps the CPU arrays after the upload)
+    size_t estimateMeshBytes(const Model& model) {
+        constexpr size_t kBytesPerVertex = (3 + 3 + 2) * sizeof(float) + 4;
+        size_t bytes = 0;
+        for (int i = 0; i < model.meshCount; ++i) {
+            const Mesh& mesh = model.meshes[i];
+            bytes += static_cast<size_t>(mesh.vertexCount) * kBytesPerVertex;
+            if (mesh.indices != nullptr) {
+                bytes += static_cast<size_t>(mesh.triangleCount) * 3 * sizeof(unsigned short);
+            }
+        }
+        return bytes;
+    }
+
+    /// Estimate the albedo textures of a model as RGBA8, skipping ids already in countedTextures
+    /// Material 0 is raylib's shared default material; its 1x1 texture is not counted
+    size_t estimateTextureBytes(const Model& model, std::vector<unsigned int>& countedTextures) {
+        size_t bytes = 0;
+        for (int i = 1; i < model.materialCount; ++i) {
+            const Texture2D& albedo = model.materials[i].maps[MATERIAL_MAP_ALBEDO].texture;
+            if (std::ranges::find(countedTextures, albedo.id) != countedTextures.end()) {
+                continue;
+            }
+            countedTextures.push_back(albedo.id);
+            bytes += static_cast<size_t>(albedo.width) * static_cast<size_t>(albedo.height) * 4;
+        }
+        return bytes;
+    }
+
+    /// Point materials binding one of the shared textures back at raylib's default texture,
+    /// so UnloadModel leaves the shared textures to the cache
+    void detachSharedTextures(const Model& model, const std::vector<TextureHandle>& sharedTextures) {
+        if (sharedTextures.empty()) {
+            return;
+        }
+
+        const Texture2D defaultTexture{rlGetTextureIdDefault(), 1, 1, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8};
+        for (int i = 0; i < model.materialCount; ++i) {
+            Texture2D& albedo = model.materials[i].maps[MATERIAL_MAP_ALBEDO].texture;
+            const bool shared = std::ranges::any_of(sharedTextures, [&albedo](const TextureHandle& texture) {
+                return texture->id == albedo.id;
+            });
+            if (shared) {
+                albedo = defaultTexture;
+            }
+        }
+    }
+
+    // Model being uploaded by uploadPreparedModel(); only touched on the GL thread
+    const PreparedModel* servedModel = nullptr;
+
+    std::string normalizePath(const char* path) {
+        return std::filesystem::path(path).lexically_normal().generic_string();
+    }
+
+    /// File loader installed around LoadModel: serves the prepared bytes from memory and
+    /// withholds the atlas that was already decoded on a worker
+    unsigned char* loadServedFileData(const char* fileName, int* dataSize) {
+        *dataSize = 0;
+        const std::string path = normalizePath(fileName);
+
+        std::vector<unsigned char> diskData;
+        const std::vector<unsigned char>* source = nullptr;
+        if (servedModel != nullptr && path == normalizePath(servedModel->path.c_str())) {
+            source = &servedModel->fileData;
+        } else if (servedModel != nullptr && path == servedModel->atlasPath) {
+            return nullptr;  // LoadModel leaves the material untextured; the atlas is patched in after
+        } else {
+            // Anything else (external buffers, other images) still comes from disk
+            std::ifstream file(fileName, std::ios::binary);
+            diskData.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+            source = &diskData;
+        }
+
+        if (source->empty()) {
+            return nullptr;
+        }
+
+        // raylib releases file data with RL_FREE (free by default)
+        auto* data = static_cast<unsigned char*>(std::malloc(source->size()));
+        if (data == nullptr) {
+            return nullptr;
+        }
+        std::memcpy(data, source->data(), source->size());
+        *dataSize = static_cast<int>(source->size());
+        return data;
+    }
+} // namespace
+
+AssetCache::AssetCache() = default;
+AssetCache::~AssetCache() = default;
+AssetCache::AssetCache(AssetCache&&) noexcept = default;
+AssetCache& AssetCache::operator=(AssetCache&&) noexcept = default;
+
+ModelHandle AssetCache::acquireModel(const std::string& path) {
+    // Fast path: this exact path was loaded before
+    if (const auto pathIt = modelHashByPath.find(path); pathIt != modelHashByPath.end()) {
+        if (const auto modelIt = modelsByHash.find(pathIt->second); modelIt != modelsByHash.end()) {
+            return modelIt->second;
+        }
+    }
+
+    if (!FileExists(path.c_str())) {
+        std::cerr << "AssetCache: model not found: " << path << '\n';
+        return nullptr;
+    }
+
+    // Same content under a different path shares the existing upload
+    const std::uint64_t contentHash = hashFileContents(path);
+    if (const auto modelIt = modelsByHash.find(contentHash); modelIt != modelsByHash.end()) {
+        modelHashByPath[path] = contentHash;
+        return modelIt->second;
+    }
+
+    // What a requestModel() worker runs (baked file lookup, atlas decode), so models loaded
+    // either way share their atlas texture
+    PreparedModel prepared = AsyncAssetLoader::prepareModel(path);
+    return uploadPreparedModel(prepared);
+}
+
+ModelRequestHandle AssetCache::requestModel(const std::string& path) {
+    if (const auto pendingIt = pendingRequests.find(path); pendingIt != pendingRequests.end()) {
+        return pendingIt->second;
+    }
+
+    auto request = std::make_shared<ModelRequest>(path);
+
+    // Already resident: complete immediately
+    if (const auto pathIt = modelHashByPath.find(path); pathIt != modelHashByPath.end()) {
+        if (const auto modelIt = modelsByHash.find(pathIt->second); modelIt != modelsByHash.end()) {
+            request->model = modelIt->second;
+            request->status = ModelRequest::Status::Ready;
+            return request;
+        }
+    }
+
+    if (loader == nullptr) {
+        loader = std::make_unique<AsyncAssetLoader>();
+    }
+    loader->enqueueModel(path);
+    pendingRequests.emplace(path, request);
+    return request;
+}
+
+size_t AssetCache::processPendingUploads(double budgetMs) {
+    if (loader == nullptr || pendingRequests.empty()) {
+        return 0;
+    }
+
+    using Clock = std::chrono::steady_clock;
+    const auto start = Clock::now();
+    size_t completed = 0;
+
+    do {
+        std::optional<PreparedModel> prepared = loader->popPrepared();
+        if (!prepared.has_value()) {
+            break;
+        }
+
+        const auto requestIt = pendingRequests.find(prepared->path);
+        if (requestIt == pendingRequests.end()) {
+            continue;
+        }
+
+        ModelRequest& request = *requestIt->second;
+        request.model = uploadPreparedModel(*prepared);
+        request.status = (request.model != nullptr) ? ModelRequest::Status::Ready : ModelRequest::Status::Failed;
+        pendingRequests.erase(requestIt);
+        ++completed;
+    } while (std::chrono::duration<double, std::milli>(Clock::now() - start).count() < budgetMs);
+
+    return completed;
+}
+
+ModelHandle AssetCache::uploadPreparedModel(PreparedModel& prepared) {
+    if (!prepared.found) {
+        std::cerr << "AssetCache: model not found: " << prepared.path << '\n';
+        return nullptr;
+    }
+
+    // Same content under a different path (or loaded synchronously meanwhile) shares the upload
+    modelHashByPath[prepared.path] = prepared.contentHash;
+    if (const auto modelIt = modelsByHash.find(prepared.contentHash); modelIt != modelsByHash.end()) {
+        return modelIt->second;
+    }
+
+    // Every model sampling this image binds the one cached texture
+    const TextureHandle atlas = (prepared.atlas.data != nullptr)
+        ? acquireAtlasTexture(prepared.atlasPath, prepared.atlasHash, prepared.atlas)
+        : nullptr;
+
+    if (prepared.baked != nullptr) {
+        return uploadBakedModel(prepared.baked, prepared.contentHash, atlas, prepared.atlasPath);
+    }
+
+    servedModel = &prepared;
+    SetLoadFileDataCallback(&loadServedFileData);
+    Model model = LoadModel(prepared.path.c_str());
+    SetLoadFileDataCallback(nullptr);
+    servedModel = nullptr;
+
+    if (!IsModelValid(model)) {
+        std::cerr << "AssetCache: failed to load model: " << prepared.path << '\n';
+        modelHashByPath.erase(prepared.path);
+        return nullptr;
+    }
+
+    // Materials left on the default texture were waiting for the atlas. Material 0 is
+    // raylib's default material
+    std::vector<TextureHandle> sharedTextures;
+    if (atlas != nullptr) {
+        const unsigned int defaultTextureId = rlGetTextureIdDefault();
+        for (int i = 1; i < model.materialCount; ++i) {
+            Texture2D& albedo = model.materials[i].maps[MATERIAL_MAP_ALBEDO].texture;
+            if (albedo.id == defaultTextureId) {
+                albedo = *atlas;
+            }
+        }
+        sharedTextures.push_back(atlas);
+    }
+
+    auto handle = wrapModel(model, std::move(sharedTextures));
+    storeModel(prepared.contentHash, handle);
+    return handle;
+}
+
+ModelHandle AssetCache::uploadBakedModel(
+    const std::shared_ptr<const BakedModel>& baked,
+    std::uint64_t hash,
+    const TextureHandle& atlas,
+    const std::string& atlasPath
+) {
+    // The deleter keeps the mapping alive for as long as the meshes point into it
+    std::vector<TextureHandle> sharedTextures;
+    if (atlas != nullptr) {
+        sharedTextures.push_back(atlas);
+    }
+    ModelHandle handle(new Model(baked->createModel(atlas.get(), atlasPath)), [baked, sharedTextures](Model* cached) {
+        detachSharedTextures(*cached, sharedTextures);
+        BakedModel::releaseModel(*cached);
+        delete cached;
+    });
+
+    modelsByHash[hash] = handle;
+    modelBounds[handle.get()] = baked->getBounds();
+    bakedModels[handle.get()] = baked;
+    return handle;
+}
+
+ModelHandle AssetCache::acquireGeneratedModel(const std::string& key, const std::function<Model()>& factory) {
+    const std::uint64_t keyHash = hashKey(key);
+    if (const auto modelIt = modelsByHash.find(keyHash); modelIt != modelsByHash.end()) {
+        return modelIt->second;
+    }
+
+    Model model = factory();
+    if (!IsModelValid(model)) {
+        std::cerr << "AssetCache: generated model is invalid: " << key << '\n';
+        return nullptr;
+    }
+
+    auto handle = wrapModel(model);
+    storeModel(keyHash, handle);
+    return handle;
+}
+
+TextureHandle AssetCache::acquireTexture(const std::string& path) {
+    if (const auto pathIt = textureHashByPath.find(path); pathIt != textureHashByPath.end()) {
+        if (const auto textureIt = texturesByHash.find(pathIt->second); textureIt != texturesByHash.end()) {
+            return textureIt->second;
+        }
+    }
+
+    if (!FileExists(path.c_str())) {
+        std::cerr << "AssetCache: texture not found: " << path << '\n';
+        return nullptr;
+    }
+
+    const std::uint64_t contentHash = hashFileContents(path);
+    if (const auto textureIt = texturesByHash.find(contentHash); textureIt != texturesByHash.end()) {
+        textureHashByPath[path] = contentHash;
+        return textureIt->second;
+    }
+
+    Texture2D texture = LoadTexture(path.c_str());
+    if (!IsTextureValid(texture)) {
+        std::cerr << "AssetCache: failed to load texture: " << path << '\n';
+        return nullptr;
+    }
+
+    auto handle = wrapTexture(texture);
+    textureHashByPath[path] = contentHash;
+    texturesByHash[contentHash] = handle;
+    return handle;
+}
+
+TextureHandle AssetCache::acquireAtlasTexture(const std::string& path, std::uint64_t contentHash, const Image& image) {
+    if (const auto textureIt = texturesByHash.find(contentHash); textureIt != texturesByHash.end()) {
+        textureHashByPath[path] = contentHash;
+        return textureIt->second;
+    }
+
+    Texture2D texture = LoadTextureFromImage(image);
+    if (!IsTextureValid(texture)) {
+        std::cerr << "AssetCache: failed to upload texture: " << path << '\n';
+        return nullptr;
+    }
+
+    auto handle = wrapTexture(texture);
+    textureHashByPath[path] = contentHash;
+    texturesByHash[contentHash] = handle;
+    return handle;
+}
+
+BoundingBox AssetCache::getModelBounds(const ModelHandle& model) const {
+    if (const auto boundsIt = modelBounds.find(model.get()); boundsIt != modelBounds.end()) {
+        return boundsIt->second;
+    }
+    return GetModelBoundingBox(*model);
+}
+
+std::span<const Vector3> AssetCache::getBakedHull(const ModelHandle& model) const {
+    if (const auto bakedIt = bakedModels.find(model.get()); bakedIt != bakedModels.end()) {
+        return bakedIt->second->getHullPoints();
+    }
+    return {};
+}
+
+LodHandle AssetCache::acquireLodModel(const ModelHandle& model, const LodSettings& settings) {
+    if (model == nullptr) {
+        return nullptr;
+    }
+    if (const auto lodIt = lodModels.find(model.get()); lodIt != lodModels.end()) {
+        return lodIt->second;
+    }
+
+    auto handle = buildLodModel(model, getModelBounds(model), settings);
+    lodModels[model.get()] = handle;
+    return handle;
+}
+
+size_t AssetCache::releaseUnused() {
+    // Chains hold a reference to their source model, so they go first
+    const size_t releasedChains = eraseUnreferenced(lodModels);
+
+    // Bounds are keyed by address, so drop them with the models about to be freed
+    for (const auto& [hash, model] : modelsByHash) {
+        if (model.use_count() <= 1) {
+            modelBounds.erase(model.get());
+            bakedModels.erase(model.get());
+        }
+    }
+
+    // Models hold their shared atlas textures, so textures go last
+    const size_t releasedModels = eraseUnreferenced(modelsByHash);
+    const size_t released = releasedChains + releasedModels + eraseUnreferenced(texturesByHash);
+    erasePathsWithoutAsset(modelHashByPath, modelsByHash);
+    erasePathsWithoutAsset(textureHashByPath, texturesByHash);
+    return released;
+}
+
+void AssetCache::clear() {
+    lodModels.clear();
+    modelHashByPath.clear();
+    textureHashByPath.clear();
+    modelsByHash.clear();
+    texturesByHash.clear();
+    modelBounds.clear();
+    bakedModels.clear();
+}
+
+std::uint64_t AssetCache::hashFileContents(const std::string& path) {
+    int dataSize = 0;
+    unsigned char* data = LoadFileData(path.c_str(), &dataSize);
+    if (data == nullptr || dataSize <= 0) {
+        // Unreadable here (the loader may still manage); fall back to keying by path
+        UnloadFileData(data);
+        return hashKey("path:" + path);
+    }
+
+    const std::uint64_t hash = hashBytes(data, static_cast<size_t>(dataSize));
+    UnloadFileData(data);
+    return hash;
+}
+
+std::uint64_t AssetCache::hashBytes(const unsigned char* data, size_t size) {
+    return fnv1a(data, size);
+}
+
+size_t AssetCache::estimateModelBytes(const Model& model) {
+    constexpr size_t kCopies = 2;  // CPU + GPU
+    std::vector<unsigned int> countedTextures;
+    return estimateMeshBytes(model) * kCopies + estimateTextureBytes(model, countedTextures);
+}
+
+AssetCache::MemoryUsage AssetCache::getMemoryUsage() const {
+    MemoryUsage usage;
+    std::vector<const Model*> countedModels;
+    std::vector<unsigned int> countedTextures;
+    const auto addModel = [&](const ModelHandle& model) {
+        if (model == nullptr || std::ranges::find(countedModels, model.get()) != countedModels.end()) {
+            return;
+        }
+        countedModels.push_back(model.get());
+        const size_t meshBytes = estimateMeshBytes(*model);
+        usage.cpuBytes += meshBytes;
+        usage.gpuBytes += meshBytes + estimateTextureBytes(*model, countedTextures);
+    };
+
+    for (const auto& [hash, model] : modelsByHash) {
+        addModel(model);
+    }
+    // Coarser levels and impostors are owned by their chain, not by modelsByHash
+    for (const auto& [model, lod] : lodModels) {
+        for (const ModelHandle& level : lod->levels) {
+            addModel(level);
+        }
+    }
+    for (const auto& [hash, texture] : texturesByHash) {
+        if (std::ranges::find(countedTextures, texture->id) == countedTextures.end()) {
+            countedTextures.push_back(texture->id);
+            usage.gpuBytes += static_cast<size_t>(texture->width) * static_cast<size_t>(texture->height) * 4;
+        }
+    }
+    return usage;
+}
+
+std::uint64_t AssetCache::hashKey(const std::string& key) {
+    return fnv1a(key.data(), key.size());
+}
+
+ModelHandle AssetCache::wrapModel(Model model, std::vector<TextureHandle> sharedTextures) {
+    return ModelHandle(new Model(model), [sharedTextures = std::move(sharedTextures)](const Model* cached) {
+        detachSharedTextures(*cached, sharedTextures);
+        UnloadModel(*cached);
+        delete cached;
+    });
+}
+
+void AssetCache::storeModel(std::uint64_t hash, const ModelHandle& handle) {
+    modelsByHash[hash] = handle;
+    modelBounds[handle.get()] = GetModelBoundingBox(*handle);
+}
+
+TextureHandle AssetCache::wrapTexture(Texture2D texture) {
+    return TextureHandle(new Texture2D(texture), [](const Texture2D* cached) {
+        UnloadTexture(*cached);
+        delete cached;
+    });
+}
+
+} // namespace project
@@ -0,0 +1,215 @@
+#include <project/async_asset_loader.hpp>
+#include <project/asset_cache.hpp>
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string_view>
+
+namespace project {
+
+namespace {
+
+    constexpr std::uint32_t kGlbMagic = 0x46546C67;      // "glTF"
+    constexpr std::uint32_t kGlbJsonChunk = 0x4E4F534A;  // "JSON"
+    constexpr size_t kGlbHeaderSize = 12;
+    constexpr size_t kGlbChunkHeaderSize = 8;
+
+    bool readFile(const std::string& path, std::vector<unsigned char>& data) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file) {
+            return false;
+        }
+        data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        return !data.empty();
+    }
+
+    std::uint32_t readUint32(const std::vector<unsigned char>& data, size_t offset) {
+        std::uint32_t value = 0;
+        std::memcpy(&value, data.data() + offset, sizeof(value));
+        return value;  // glb is little-endian, like every platform we ship on
+    }
+
+    /// Get the JSON part of a .glb (first chunk) or the whole file for .gltf
+    std::string_view getGltfJson(const std::vector<unsigned char>& data) {
+        const auto* text = reinterpret_cast<const char*>(data.data());
+        if (data.size() < kGlbHeaderSize + kGlbChunkHeaderSize || readUint32(data, 0) != kGlbMagic) {
+            return {text, data.size()};
+        }
+
+        const size_t chunkLength = readUint32(data, kGlbHeaderSize);
+        if (readUint32(data, kGlbHeaderSize + 4) != kGlbJsonChunk ||
+            kGlbHeaderSize + kGlbChunkHeaderSize + chunkLength > data.size()) {
+            return {};
+        }
+        return {text + kGlbHeaderSize + kGlbChunkHeaderSize, chunkLength};
+    }
+
+    /// Collect the "uri" values of the top-level "images" array
+    /// Just enough JSON scanning for that one array; anything unexpected yields no URIs
+    std::vector<std::string> findImageUris(std::string_view json) {
+        std::vector<std::string> uris;
+        const size_t imagesKey = json.find("\"images\"");
+        if (imagesKey == std::string_view::npos) {
+            return uris;
+        }
+
+        int depth = 0;
+        bool expectUri = false;
+        for (size_t i = json.find('[', imagesKey); i < json.size(); ++i) {
+            const char character = json[i];
+            if (character == '[' || character == '{') {
+                ++depth;
+            } else if (character == ']' || character == '}') {
+                if (--depth == 0) {
+                    break;
+                }
+            } else if (character == '"') {
+                size_t end = i + 1;
+                while (end < json.size() && json[end] != '"') {
+                    end += (json[end] == '\\') ? 2 : 1;
+                }
+                if (end >= json.size()) {
+                    return {};
+                }
+
+                const std::string_view text = json.substr(i + 1, end - i - 1);
+                if (expectUri) {
+                    uris.emplace_back(text);
+                    expectUri = false;
+                } else {
+                    expectUri = (text == "uri");
+                }
+                i = end;
+            }
+        }
+        return uris;
+    }
+
+} // namespace
+
+AsyncAssetLoader::AsyncAssetLoader(unsigned int workerCount) {
+    workerCount = std::max(workerCount, 1U);
+    for (unsigned int i = 0; i < workerCount; ++i) {
+        workers.emplace_back([this](std::stop_token stopToken) { workerLoop(stopToken); });
+    }
+}
+
+AsyncAssetLoader::~AsyncAssetLoader() {
+    for (auto& worker : workers) {
+        worker.request_stop();
+    }
+    workAvailable.notify_all();
+    workers.clear();  // jthread joins on destruction
+}
+
+void AsyncAssetLoader::enqueueModel(const std::string& path) {
+    {
+        const std::scoped_lock lock(mutex);
+        queue.push_back(path);
+        ++inFlight;
+    }
+    workAvailable.notify_one();
+}
+
+std::optional<PreparedModel> AsyncAssetLoader::popPrepared() {
+    const std::scoped_lock lock(mutex);
+    if (prepared.empty()) {
+        return std::nullopt;
+    }
+
+    std::optional<PreparedModel> result(std::move(prepared.front()));
+    prepared.pop_front();
+    --inFlight;
+    return result;
+}
+
+size_t AsyncAssetLoader::getInFlightCount() const {
+    const std::scoped_lock lock(mutex);
+    return inFlight;
+}
+
+unsigned int AsyncAssetLoader::getDefaultWorkerCount() noexcept {
+    constexpr unsigned int kMaxWorkers = 2;
+    return std::clamp(std::thread::hardware_concurrency() / 2, 1U, kMaxWorkers);
+}
+
+PreparedModel AsyncAssetLoader::prepareModel(const std::string& path) {
+    PreparedModel result;
+    result.path = path;
+    result.found = readFile(path, result.fileData);
+    if (!result.found) {
+        return result;
+    }
+    result.contentHash = AssetCache::hashBytes(result.fileData.data(), result.fileData.size());
+
+    // A baked file built from these exact bytes replaces the glTF parse; only its atlas is decoded here
+    if (auto baked = BakedModel::open(BakedModel::getBakedPath(path)); baked != nullptr && baked->getSourceHash() == result.contentHash) {
+        result.fileData.clear();
+        result.fileData.shrink_to_fit();
+        for (size_t i = 0; i < baked->getMaterialCount() && result.atlasPath.empty(); ++i) {
+            result.atlasPath = baked->getAlbedoPath(i);
+        }
+        result.baked = std::move(baked);
+        if (!result.atlasPath.empty()) {
+            std::vector<unsigned char> imageData;
+            const std::string extension = std::filesystem::path(result.atlasPath).extension().string();
+            if (readFile(result.atlasPath, imageData)) {
+                result.atlas = LoadImageFromMemory(extension.c_str(), imageData.data(), static_cast<int>(imageData.size()));
+                result.atlasHash = AssetCache::hashBytes(imageData.data(), imageData.size());
+            }
+            if (result.atlas.data == nullptr) {
+                result.atlasPath.clear();  // Left to LoadTexture on the GL thread
+            }
+        }
+        return result;
+    }
+
+    // A single external image used as base color is the texture atlas every material samples
+    // (the kenney.nl packs share Textures/colormap.png). Anything else is left to LoadModel.
+    const std::string_view json = getGltfJson(result.fileData);
+    const std::vector<std::string> uris = findImageUris(json);
+    if (uris.size() != 1 || uris.front().starts_with("data:") || json.find("\"baseColorTexture\"") == std::string_view::npos) {
+        return result;
+    }
+
+    // raylib resolves image URIs relative to the model's directory
+    const std::filesystem::path imagePath = (std::filesystem::path(path).parent_path() / uris.front()).lexically_normal();
+    std::vector<unsigned char> imageData;
+    if (!readFile(imagePath.string(), imageData)) {
+        return result;
+    }
+
+    const std::string extension = imagePath.extension().string();
+    result.atlas = LoadImageFromMemory(extension.c_str(), imageData.data(), static_cast<int>(imageData.size()));
+    if (result.atlas.data != nullptr) {
+        result.atlasPath = imagePath.generic_string();
+        result.atlasHash = AssetCache::hashBytes(imageData.data(), imageData.size());
+    } else {
+        std::cerr << "AsyncAssetLoader: failed to decode " << imagePath.generic_string() << '\n';
+    }
+    return result;
+}
+
+void AsyncAssetLoader::workerLoop(std::stop_token stopToken) {
+    while (true) {
+        std::string path;
+        {
+            std::unique_lock lock(mutex);
+            if (!workAvailable.wait(lock, stopToken, [this] { return !queue.empty(); })) {
+                return;
+            }
+            path = std::move(queue.front());
+            queue.pop_front();
+        }
+
+        PreparedModel result = prepareModel(path);
+
+        const std::scoped_lock lock(mutex);
+        prepared.push_back(std::move(result));
+    }
+}
+
+} // namespace project
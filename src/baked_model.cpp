@@ -0,0 +1,325 @@
+#include <project/baked_model.hpp>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace project {
+
+namespace {
+
+    /// Components and component size of each baked::Attribute stream
+    struct AttributeLayout {
+        size_t components;
+        size_t componentBytes;
+    };
+
+    constexpr AttributeLayout kAttributeLayouts[baked::AttributeCount] = {
+        {3, sizeof(float)},          // Vertices
+        {2, sizeof(float)},          // Texcoords
+        {2, sizeof(float)},          // Texcoords2
+        {3, sizeof(float)},          // Normals
+        {4, sizeof(float)},          // Tangents
+        {4, sizeof(unsigned char)},  // Colors
+    };
+
+    /// Get the mesh array backing an attribute stream
+    void** getAttributeArray(Mesh& mesh, size_t attribute) {
+        switch (attribute) {
+        case baked::Vertices: return reinterpret_cast<void**>(&mesh.vertices);
+        case baked::Texcoords: return reinterpret_cast<void**>(&mesh.texcoords);
+        case baked::Texcoords2: return reinterpret_cast<void**>(&mesh.texcoords2);
+        case baked::Normals: return reinterpret_cast<void**>(&mesh.normals);
+        case baked::Tangents: return reinterpret_cast<void**>(&mesh.tangents);
+        default: return reinterpret_cast<void**>(&mesh.colors);
+        }
+    }
+
+    size_t getAttributeBytes(size_t attribute, size_t vertexCount) {
+        return vertexCount * kAttributeLayouts[attribute].components * kAttributeLayouts[attribute].componentBytes;
+    }
+
+    /// Appends aligned blocks to the output buffer and hands back their offsets
+    class BlockWriter {
+    public:
+        std::uint64_t append(const void* data, size_t size) {
+            bytes.resize((bytes.size() + baked::kAlignment - 1) / baked::kAlignment * baked::kAlignment);
+            const std::uint64_t offset = bytes.size();
+            const auto* source = static_cast<const unsigned char*>(data);
+            bytes.insert(bytes.end(), source, source + size);
+            return offset;
+        }
+
+        template <typename T>
+        void overwrite(std::uint64_t offset, const T& value) {
+            std::memcpy(bytes.data() + offset, &value, sizeof(T));
+        }
+
+        std::vector<unsigned char> bytes;
+    };
+
+} // namespace
+
+std::unique_ptr<MappedFile> MappedFile::open(const std::string& path) {
+    std::unique_ptr<MappedFile> file(new MappedFile());
+
+#if !defined(_WIN32)
+    const int descriptor = ::open(path.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+        return nullptr;
+    }
+
+    struct stat status {};
+    if (::fstat(descriptor, &status) == 0 && status.st_size > 0) {
+        // Private writable mapping: pages stay shared with the page cache (and evictable) unless
+        // something writes into a mesh array, which then only copies that page
+        void* mapping = ::mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ | PROT_WRITE, MAP_PRIVATE, descriptor, 0);
+        if (mapping != MAP_FAILED) {
+            file->bytes = static_cast<unsigned char*>(mapping);
+            file->byteCount = static_cast<size_t>(status.st_size);
+        }
+    }
+    ::close(descriptor);
+
+    if (file->bytes != nullptr) {
+        return file;
+    }
+#endif
+
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream) {
+        return nullptr;
+    }
+    file->fallback.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    if (file->fallback.empty()) {
+        return nullptr;
+    }
+    file->bytes = file->fallback.data();
+    file->byteCount = file->fallback.size();
+    return file;
+}
+
+MappedFile::~MappedFile() {
+#if !defined(_WIN32)
+    if (bytes != nullptr && fallback.empty()) {
+        ::munmap(bytes, byteCount);
+    }
+#endif
+}
+
+std::shared_ptr<const BakedModel> BakedModel::open(const std::string& path) {
+    auto file = MappedFile::open(path);
+    if (file == nullptr || file->size() < sizeof(baked::FileHeader)) {
+        return nullptr;
+    }
+
+    std::shared_ptr<BakedModel> model(new BakedModel());
+    std::memcpy(&model->header, file->data(), sizeof(baked::FileHeader));
+    const baked::FileHeader& header = model->header;
+    if (header.magic != baked::kMagic || header.version != baked::kVersion) {
+        std::cerr << "BakedModel: " << path << " is not a version " << baked::kVersion << " baked model\n";
+        return nullptr;
+    }
+
+    // Every array must lie inside the file and be aligned for its element type
+    const size_t fileSize = file->size();
+    const auto fits = [fileSize](std::uint64_t offset, size_t bytes) {
+        return offset % baked::kAlignment == 0 && offset <= fileSize && bytes <= fileSize - offset;
+    };
+
+    bool valid = fits(header.meshTableOffset, header.meshCount * sizeof(baked::MeshRecord)) &&
+                 fits(header.materialTableOffset, header.materialCount * sizeof(baked::MaterialRecord)) &&
+                 fits(header.hullOffset, header.hullPointCount * sizeof(Vector3)) &&
+                 fits(header.stringOffset, header.stringBytes) &&
+                 header.materialCount > 0;
+
+    const unsigned char* base = file->data();
+    if (valid) {
+        model->meshes = {reinterpret_cast<const baked::MeshRecord*>(base + header.meshTableOffset), header.meshCount};
+        model->materials = {reinterpret_cast<const baked::MaterialRecord*>(base + header.materialTableOffset), header.materialCount};
+        model->hullPoints = {reinterpret_cast<const Vector3*>(base + header.hullOffset), header.hullPointCount};
+        model->strings = reinterpret_cast<const char*>(base + header.stringOffset);
+    }
+
+    for (const baked::MeshRecord& mesh : model->meshes) {
+        valid = valid && mesh.vertexCount > 0 && mesh.attributeOffsets[baked::Vertices] != 0 &&
+                mesh.materialIndex < header.materialCount &&
+                (mesh.indicesOffset == 0 || fits(mesh.indicesOffset, mesh.triangleCount * 3 * sizeof(unsigned short)));
+        for (size_t attribute = 0; attribute < baked::AttributeCount; ++attribute) {
+            const std::uint64_t offset = mesh.attributeOffsets[attribute];
+            valid = valid && (offset == 0 || fits(offset, getAttributeBytes(attribute, mesh.vertexCount)));
+        }
+    }
+    for (const baked::MaterialRecord& material : model->materials) {
+        valid = valid && material.albedoPathOffset <= header.stringBytes &&
+                material.albedoPathLength <= header.stringBytes - material.albedoPathOffset;
+    }
+
+    if (!valid) {
+        std::cerr << "BakedModel: " << path << " is truncated or corrupt\n";
+        return nullptr;
+    }
+
+    model->directory = std::filesystem::path(path).parent_path().generic_string();
+    model->file = std::move(file);
+    return model;
+}
+
+std::string BakedModel::getBakedPath(const std::string& sourcePath) {
+    return sourcePath + ".bake";
+}
+
+bool BakedModel::write(
+    const std::string& path,
+    const Model& model,
+    std::uint64_t sourceHash,
+    const std::vector<std::string>& albedoPaths,
+    std::span<const Vector3> hullPoints
+) {
+    if (model.meshCount <= 0 || model.materialCount <= 0 || albedoPaths.size() != static_cast<size_t>(model.materialCount)) {
+        std::cerr << "BakedModel: nothing to bake for " << path << '\n';
+        return false;
+    }
+
+    baked::FileHeader header;
+    header.sourceHash = sourceHash;
+    header.meshCount = static_cast<std::uint32_t>(model.meshCount);
+    header.materialCount = static_cast<std::uint32_t>(model.materialCount);
+    header.hullPointCount = static_cast<std::uint32_t>(hullPoints.size());
+    header.transform = model.transform;
+    header.bounds = GetModelBoundingBox(model);
+
+    BlockWriter writer;
+    writer.append(&header, sizeof(header));  // Rewritten once the offsets are known
+
+    std::vector<baked::MeshRecord> meshRecords(static_cast<size_t>(model.meshCount));
+    for (int i = 0; i < model.meshCount; ++i) {
+        Mesh mesh = model.meshes[i];
+        if (mesh.boneIds != nullptr || mesh.boneWeights != nullptr || mesh.vertices == nullptr) {
+            std::cerr << "BakedModel: skinned meshes and meshes without CPU vertices are not supported\n";
+            return false;
+        }
+
+        baked::MeshRecord& record = meshRecords[static_cast<size_t>(i)];
+        record.vertexCount = static_cast<std::uint32_t>(mesh.vertexCount);
+        record.triangleCount = static_cast<std::uint32_t>(mesh.triangleCount);
+        record.materialIndex = static_cast<std::uint32_t>(model.meshMaterial[i]);
+        for (size_t attribute = 0; attribute < baked::AttributeCount; ++attribute) {
+            if (const void* array = *getAttributeArray(mesh, attribute); array != nullptr) {
+                record.attributeOffsets[attribute] = writer.append(array, getAttributeBytes(attribute, record.vertexCount));
+            }
+        }
+        if (mesh.indices != nullptr) {
+            record.indicesOffset = writer.append(mesh.indices, record.triangleCount * 3 * sizeof(unsigned short));
+        }
+    }
+    header.meshTableOffset = writer.append(meshRecords.data(), meshRecords.size() * sizeof(baked::MeshRecord));
+
+    std::string strings;
+    std::vector<baked::MaterialRecord> materialRecords(static_cast<size_t>(model.materialCount));
+    for (size_t i = 0; i < materialRecords.size(); ++i) {
+        baked::MaterialRecord& record = materialRecords[i];
+        record.albedoColor = model.materials[i].maps[MATERIAL_MAP_ALBEDO].color;
+        record.albedoPathOffset = static_cast<std::uint32_t>(strings.size());
+        record.albedoPathLength = static_cast<std::uint32_t>(albedoPaths[i].size());
+        strings += albedoPaths[i];
+    }
+    header.materialTableOffset = writer.append(materialRecords.data(), materialRecords.size() * sizeof(baked::MaterialRecord));
+    header.hullOffset = writer.append(hullPoints.data(), hullPoints.size_bytes());
+    header.stringOffset = writer.append(strings.data(), strings.size());
+    header.stringBytes = static_cast<std::uint32_t>(strings.size());
+    writer.overwrite(0, header);
+
+    std::ofstream output(path, std::ios::binary | std::ios::trunc);
+    output.write(reinterpret_cast<const char*>(writer.bytes.data()), static_cast<std::streamsize>(writer.bytes.size()));
+    if (!output) {
+        std::cerr << "BakedModel: failed to write " << path << '\n';
+        return false;
+    }
+    return true;
+}
+
+Model BakedModel::createModel(const Texture2D* sharedAlbedo, const std::string& sharedAlbedoPath) const {
+    Model model{};
+    model.transform = header.transform;
+    model.meshCount = static_cast<int>(header.meshCount);
+    model.materialCount = static_cast<int>(header.materialCount);
+
+    // raylib frees these arrays with RL_FREE in UnloadModel
+    model.meshes = static_cast<Mesh*>(RL_CALLOC(header.meshCount, sizeof(Mesh)));
+    model.meshMaterial = static_cast<int*>(RL_CALLOC(header.meshCount, sizeof(int)));
+    model.materials = static_cast<Material*>(RL_CALLOC(header.materialCount, sizeof(Material)));
+
+    unsigned char* base = const_cast<unsigned char*>(file->data());
+    for (size_t i = 0; i < meshes.size(); ++i) {
+        const baked::MeshRecord& record = meshes[i];
+        Mesh& mesh = model.meshes[i];
+        mesh.vertexCount = static_cast<int>(record.vertexCount);
+        mesh.triangleCount = static_cast<int>(record.triangleCount);
+        for (size_t attribute = 0; attribute < baked::AttributeCount; ++attribute) {
+            if (record.attributeOffsets[attribute] != 0) {
+                *getAttributeArray(mesh, attribute) = base + record.attributeOffsets[attribute];
+            }
+        }
+        if (record.indicesOffset != 0) {
+            mesh.indices = reinterpret_cast<unsigned short*>(base + record.indicesOffset);
+        }
+
+        // Streams straight from the mapped pages into the vertex buffers
+        UploadMesh(&mesh, false);
+        model.meshMaterial[i] = static_cast<int>(record.materialIndex);
+    }
+
+    for (size_t i = 0; i < materials.size(); ++i) {
+        Material& material = model.materials[i];
+        material = LoadMaterialDefault();
+        material.maps[MATERIAL_MAP_ALBEDO].color = materials[i].albedoColor;
+
+        const std::string albedoPath = getAlbedoPath(i);
+        if (albedoPath.empty()) {
+            continue;
+        }
+        // Other images are owned by the material (UnloadModel unloads them)
+        const Texture2D texture = (sharedAlbedo != nullptr && albedoPath == sharedAlbedoPath)
+            ? *sharedAlbedo
+            : LoadTexture(albedoPath.c_str());
+        if (IsTextureValid(texture)) {
+            material.maps[MATERIAL_MAP_ALBEDO].texture = texture;
+        }
+    }
+    return model;
+}
+
+void BakedModel::releaseModel(Model& model) {
+    // The attribute arrays belong to the mapping; detach them so UnloadModel only frees GPU
+    // buffers, materials and the arrays createModel allocated
+    for (int i = 0; i < model.meshCount; ++i) {
+        Mesh& mesh = model.meshes[i];
+        for (size_t attribute = 0; attribute < baked::AttributeCount; ++attribute) {
+            *getAttributeArray(mesh, attribute) = nullptr;
+        }
+        mesh.indices = nullptr;
+    }
+    UnloadModel(model);
+    model = Model{};
+}
+
+std::string BakedModel::getAlbedoPath(size_t materialIndex) const {
+    if (materialIndex >= materials.size() || materials[materialIndex].albedoPathLength == 0) {
+        return {};
+    }
+    const baked::MaterialRecord& material = materials[materialIndex];
+    const std::string relative(strings + material.albedoPathOffset, material.albedoPathLength);
+    return (std::filesystem::path(directory) / relative).lexically_normal().generic_string();
+}
+
+} // namespace project
@@ -0,0 +1,171 @@
+#include <project/bullet_allocator.hpp>
+#include <LinearMath/btAlignedAllocator.h>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+
+namespace project {
+
+namespace {
+
+    // Every block starts with a 16-byte header so returned pointers keep malloc's alignment
+    constexpr size_t kHeaderSize = 16;
+    constexpr size_t kSlabSize = 64 * 1024;
+
+    // Block sizes including the header; anything larger goes to malloc
+    constexpr std::array<size_t, 8> kBlockSizes{32, 64, 128, 256, 512, 1024, 2048, 4096};
+    constexpr std::uint32_t kLargeBlock = 0xFFFFFFFFU;
+
+    struct BlockHeader {
+        std::uint32_t sizeClass;
+        std::uint32_t reserved;
+        std::uint64_t requestedSize;
+    };
+    static_assert(sizeof(BlockHeader) <= kHeaderSize);
+
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    struct SizeClass {
+        std::mutex mutex;
+        FreeBlock* freeList{nullptr};
+    };
+
+    struct AllocatorState {
+        std::array<SizeClass, kBlockSizes.size()> sizeClasses;
+        std::atomic<size_t> bytesInUse{0};
+        std::atomic<size_t> peakBytesInUse{0};
+        std::atomic<size_t> liveAllocations{0};
+        std::atomic<size_t> reservedBytes{0};
+        std::atomic<size_t> largeAllocations{0};
+        std::atomic<size_t> totalAllocations{0};
+    };
+
+    // Intentionally leaked: Bullet objects owned by other statics may be freed during exit
+    AllocatorState& getState() {
+        static auto* state = new AllocatorState();
+        return *state;
+    }
+
+    std::once_flag installFlag;
+    std::atomic<bool> installed{false};
+
+    std::uint32_t findSizeClass(size_t blockSize) noexcept {
+        for (size_t i = 0; i < kBlockSizes.size(); ++i) {
+            if (blockSize <= kBlockSizes[i]) {
+                return static_cast<std::uint32_t>(i);
+            }
+        }
+        return kLargeBlock;
+    }
+
+    /// Carve a new slab into blocks for one size class (caller holds the class lock)
+    bool refill(AllocatorState& state, SizeClass& sizeClass, size_t blockSize) {
+        auto* slab = static_cast<std::byte*>(std::malloc(kSlabSize));
+        if (slab == nullptr) {
+            return false;
+        }
+        state.reservedBytes.fetch_add(kSlabSize, std::memory_order_relaxed);
+
+        for (size_t offset = kSlabSize; offset >= blockSize; offset -= blockSize) {
+            auto* block = reinterpret_cast<FreeBlock*>(slab + offset - blockSize);
+            block->next = sizeClass.freeList;
+            sizeClass.freeList = block;
+        }
+        return true;
+    }
+
+    void* allocate(size_t size) {
+        AllocatorState& state = getState();
+        const size_t blockSize = size + kHeaderSize;
+        const std::uint32_t classIndex = findSizeClass(blockSize);
+
+        std::byte* block = nullptr;
+        if (classIndex == kLargeBlock) {
+            block = static_cast<std::byte*>(std::malloc(blockSize));
+            if (block != nullptr) {
+                state.largeAllocations.fetch_add(1, std::memory_order_relaxed);
+            }
+        } else {
+            SizeClass& sizeClass = state.sizeClasses[classIndex];
+            const std::scoped_lock lock(sizeClass.mutex);
+            if (sizeClass.freeList != nullptr || refill(state, sizeClass, kBlockSizes[classIndex])) {
+                block = reinterpret_cast<std::byte*>(sizeClass.freeList);
+                sizeClass.freeList = sizeClass.freeList->next;
+            }
+        }
+
+        if (block == nullptr) {
+            return nullptr;
+        }
+
+        ::new (static_cast<void*>(block)) BlockHeader{classIndex, 0, size};
+        const size_t inUse = state.bytesInUse.fetch_add(size, std::memory_order_relaxed) + size;
+        size_t peak = state.peakBytesInUse.load(std::memory_order_relaxed);
+        while (inUse > peak && !state.peakBytesInUse.compare_exchange_weak(peak, inUse, std::memory_order_relaxed)) {
+        }
+        state.liveAllocations.fetch_add(1, std::memory_order_relaxed);
+        state.totalAllocations.fetch_add(1, std::memory_order_relaxed);
+        return block + kHeaderSize;
+    }
+
+    void deallocate(void* memory) {
+        if (memory == nullptr) {
+            return;
+        }
+
+        AllocatorState& state = getState();
+        std::byte* block = static_cast<std::byte*>(memory) - kHeaderSize;
+        const BlockHeader header = *reinterpret_cast<const BlockHeader*>(block);
+        state.bytesInUse.fetch_sub(static_cast<size_t>(header.requestedSize), std::memory_order_relaxed);
+        state.liveAllocations.fetch_sub(1, std::memory_order_relaxed);
+
+        if (header.sizeClass == kLargeBlock) {
+            state.largeAllocations.fetch_sub(1, std::memory_order_relaxed);
+            std::free(block);
+            return;
+        }
+
+        SizeClass& sizeClass = state.sizeClasses[header.sizeClass];
+        auto* freeBlock = reinterpret_cast<FreeBlock*>(block);
+        const std::scoped_lock lock(sizeClass.mutex);
+        freeBlock->next = sizeClass.freeList;
+        sizeClass.freeList = freeBlock;
+    }
+
+} // namespace
+
+void BulletAllocator::install() {
+    std::call_once(installFlag, [] {
+        // Bullet aligns on top of these functions (btAlignedAllocDefault)
+        btAlignedAllocSetCustom(&allocate, &deallocate);
+        installed.store(true, std::memory_order_release);
+    });
+}
+
+bool BulletAllocator::isInstalled() noexcept {
+    return installed.load(std::memory_order_acquire);
+}
+
+BulletAllocator::Stats BulletAllocator::getStats() noexcept {
+    const AllocatorState& state = getState();
+    Stats stats;
+    stats.bytesInUse = state.bytesInUse.load(std::memory_order_relaxed);
+    stats.peakBytesInUse = state.peakBytesInUse.load(std::memory_order_relaxed);
+    stats.liveAllocations = state.liveAllocations.load(std::memory_order_relaxed);
+    stats.reservedBytes = state.reservedBytes.load(std::memory_order_relaxed);
+    stats.largeAllocations = state.largeAllocations.load(std::memory_order_relaxed);
+    stats.totalAllocations = state.totalAllocations.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void BulletAllocator::resetPeak() noexcept {
+    AllocatorState& state = getState();
+    state.peakBytesInUse.store(state.bytesInUse.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+} // namespace project
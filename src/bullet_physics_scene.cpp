@@ -1,12 +1,68 @@
 #include <project/bullet_physics_scene.hpp>
+#include <project/memory_tracker.hpp>
+#include <project/scene_layout.hpp>
 #include <btBulletDynamicsCommon.h>
 #include <raymath.h>
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <iostream>
+#include <type_traits>
+#include <utility>
 
 namespace project {
 
-BulletPhysicsScene::BulletPhysicsScene() = default;
+namespace {
+    constexpr float kCarDistance = 5.0F;  // Distance of the car from the origin
+    constexpr const char* kCharacterPath = "assets/characters/character-a.glb";
+    constexpr const char* kCarPath = "assets/cars/police.glb";
+    
+    // Parts thrown by spawnDebris, picked at random per piece
+    constexpr std::array<const char*, 14> kDebrisPaths{
+        "assets/cars/debris-bolt.glb",
+        "assets/cars/debris-bumper.glb",
+        "assets/cars/debris-door.glb",
+        "assets/cars/debris-door-window.glb",
+        "assets/cars/debris-drivetrain.glb",
+        "assets/cars/debris-drivetrain-axle.glb",
+        "assets/cars/debris-nut.glb",
+        "assets/cars/debris-plate-a.glb",
+        "assets/cars/debris-plate-b.glb",
+        "assets/cars/debris-plate-small-a.glb",
+        "assets/cars/debris-plate-small-b.glb",
+        "assets/cars/debris-spoiler-a.glb",
+        "assets/cars/debris-spoiler-b.glb",
+        "assets/cars/debris-tire.glb",
+    };
+    
+    constexpr float kDebrisMass = 5.0F;                // Mass of a promoted piece in kg
+    constexpr float kDebrisPromotionRadius = 3.0F;     // Pieces this close to the camera become bodies
+    constexpr size_t kMaxPromotedDebris = 128;         // Promoted bodies per scene visit
+    constexpr size_t kMaxPromotionsPerFrame = 16;
+    
+    /// Estimate the bytes reserved by the storage of one component type
+    /// Counts the packed entity array and, for non-empty types, the payload; sparse pages are
+    /// left out. Creates the storage if it doesn't exist yet, so call it while nothing else
+    /// uses the registry
+    template <typename Component>
+    size_t estimateStorageBytes(entt::registry& registry) {
+        const size_t payload = std::is_empty_v<Component> ? 0 : sizeof(Component);
+        return registry.storage<Component>().capacity() * (payload + sizeof(entt::entity));
+    }
+    
+    /// Sum estimateStorageBytes over several component types
+    template <typename... Components>
+    size_t estimateStoragesBytes(entt::registry& registry) {
+        return (estimateStorageBytes<Components>(registry) + ...);
+    }
+} // namespace
+
+BulletPhysicsScene::BulletPhysicsScene(AssetCache& assetCache)
+    : assetCache(&assetCache) {
+    // However static entities come or go (spawns, destroys, registry.clear), the batch follows
+    registry.on_construct<StaticMesh>().connect<&BulletPhysicsScene::onStaticMeshChanged>(*this);
+    registry.on_destroy<StaticMesh>().connect<&BulletPhysicsScene::onStaticMeshChanged>(*this);
+}
 
 BulletPhysicsScene::~BulletPhysicsScene() {
     cleanup();
@@ -17,15 +73,28 @@ void BulletPhysicsScene::initialize() {
         return;
     }
     
-    setupPhysicsWorld();
+    physicsWorld.initialize();
+    instancedRenderer.initialize();
+    registerSystems();
     createGroundPlane();
     createCharacter();
     createCar();
     
+    // Debris types register as their models arrive
+    for (const char* path : kDebrisPaths) {
+        debrisRequests.push_back(assetCache->requestModel(path));
+    }
+    processDebrisRequests();
+    
+    // The spawns hold their own requests now
+    preloadRequests.clear();
+    
     isInitialized = true;
 }
 
 void BulletPhysicsScene::cleanup() {
+    preloadRequests.clear();
+    
     if (!isInitialized) {
         return;
     }
@@ -33,77 +102,140 @@ void BulletPhysicsScene::cleanup() {
     // Mark as uninitialized first to prevent re-entry
     isInitialized = false;
     
-    // Cleanup all entities - components will handle their own cleanup
-    // First remove all rigid bodies from the physics world
-    auto physicsView = registry.view<PhysicsBody>();
-    for (auto entity : physicsView) {
-        const auto& physicsBody = physicsView.get<PhysicsBody>(entity);
-        if (physicsBody.rigidBody != nullptr && dynamicsWorld != nullptr) {
-            dynamicsWorld->removeRigidBody(physicsBody.rigidBody);
-        }
+    // Destroy the rigid bodies and the Bullet world first, then the remaining components
+    // Renderables only drop their model references; the AssetCache decides when to unload
+    // Requests keep loading into the cache, so a later visit finds the models resident
+    pendingSpawns.clear();
+    savedState.clear();
+    physicsWorld.shutdown();
+    registry.clear();  // Also empties entityNames, through the Name destroy signal
+    
+    debris.clear();
+    debrisBatches.clear();
+    debrisRequests.clear();
+    pendingPromotions.clear();
+    promotedDebrisCount = 0;
+    
+    staticBatch.clear();
+    
+    // Snapshots hold model references too; drop them here, on the GL thread
+    for (auto& snapshot : renderSnapshots) {
+        snapshot.items.clear();
+        snapshot.drawList.clear();
+        snapshot.debris.clear();
+        snapshot.debugLines.clear();
     }
+    drawFromSnapshot = false;
+    debugLines.clear();
     
-    // Clear the registry (this will destroy all entities and components)
-    registry.clear();
+    instancedRenderer.shutdown();
+    debugLineRenderer.unload();
+}
+
+bool BulletPhysicsScene::restoreState() {
+    if (!isInitialized || savedState.isEmpty()) {
+        return false;
+    }
     
-    // Cleanup physics world
-    cleanupPhysicsWorld();
+    physicsWorld.restoreSnapshot(savedState);
+    return true;
 }
 
-void BulletPhysicsScene::setupPhysicsWorld() {
-    // Create collision configuration
-    collisionConfiguration = new btDefaultCollisionConfiguration();
+void BulletPhysicsScene::preload() {
+    if (isInitialized || !preloadRequests.empty()) {
+        return;
+    }
     
-    // Create dispatcher
-    dispatcher = new btCollisionDispatcher(collisionConfiguration);
+    preloadRequests.push_back(assetCache->requestModel(kCharacterPath));
+    preloadRequests.push_back(assetCache->requestModel(kCarPath));
+    for (const char* path : kDebrisPaths) {
+        preloadRequests.push_back(assetCache->requestModel(path));
+    }
+}
+
+size_t BulletPhysicsScene::getMemoryEstimate() const {
+    if (!isInitialized) {
+        return 0;
+    }
     
-    // Create broadphase
-    overlappingPairCache = new btDbvtBroadphase();
+    // Entities share models, so count each one once
+    std::vector<const Model*> models;
+    size_t bytes = physicsWorld.getPooledBytes();
+    for (const auto entity : registry.view<Renderable>()) {
+        const Model* model = registry.get<Renderable>(entity).model.get();
+        if (model != nullptr && std::ranges::find(models, model) == models.end()) {
+            models.push_back(model);
+            bytes += AssetCache::estimateModelBytes(*model);
+        }
+    }
+    return bytes;
+}
+
+void BulletPhysicsScene::reportMemory(MemoryTracker& tracker) {
+    if (!isInitialized) {
+        return;
+    }
     
-    // Create constraint solver
-    constraintSolver = new btSequentialImpulseConstraintSolver();
+    size_t ecsBytes = estimateStoragesBytes<
+        Transform, PreviousTransform, PhysicsBody, Renderable, Lod, LocalBounds, WorldBounds, BoundsDirty,
+        Parent, Children, LocalTransform, WorldMatrix, HierarchyRoot, HierarchyDirty, Ground, StaticMesh, Name
+    >(registry);
+    size_t debrisBytes = debris.getReservedBytes();
+    for (const RenderSnapshot& snapshot : renderSnapshots) {
+        ecsBytes += snapshot.items.capacity() * sizeof(RenderItem);
+        for (const DebrisDrawBatch& batch : snapshot.debris) {
+            debrisBytes += batch.matrices.capacity() * sizeof(Matrix);
+        }
+    }
+    for (const DebrisDrawBatch& batch : debrisBatches) {
+        debrisBytes += batch.matrices.capacity() * sizeof(Matrix);
+    }
     
-    // Create dynamics world
-    dynamicsWorld = new btDiscreteDynamicsWorld(
-        dispatcher,
-        overlappingPairCache,
-        constraintSolver,
-        collisionConfiguration
-    );
+    // Bullet's own heap is counted process-wide by BulletAllocator; the pools are per scene
+    const size_t batchBytes = staticBatch.getMeshBytes();
+    tracker.addMeasured(MemoryCategory::Ecs, ecsBytes);
+    tracker.addMeasured(MemoryCategory::Physics, physicsWorld.getPooledBytes());
+    tracker.addMeasured(MemoryCategory::Debris, debrisBytes);
+    tracker.addMeasured(MemoryCategory::AssetsCpu, batchBytes);
+    tracker.addMeasured(MemoryCategory::AssetsGpu, batchBytes);
+}
+
+void BulletPhysicsScene::setPhysicsBackend(PhysicsBackend backend) {
+    const PhysicsBackend previousBackend = physicsWorld.getPhysicsBackend();
+    physicsWorld.setPhysicsBackend(backend);
+    if (physicsWorld.getPhysicsBackend() == previousBackend) {
+        return;
+    }
     
-    // Set gravity (Y-axis up in raylib, Y-axis up in Bullet by default)
-    constexpr float kGravity = -9.8F;
-    dynamicsWorld->setGravity(btVector3(0.0F, kGravity, 0.0F));
+    // The world type is fixed at creation, so rebuild the scene around the new backend
+    if (isInitialized) {
+        cleanup();
+        initialize();
+    }
 }
 
 void BulletPhysicsScene::createGroundPlane() {
     // Create a large ground plane
-    constexpr float kGroundHalfExtentsX = 20.0F;
-    constexpr float kGroundHalfExtentsY = 0.5F;
-    constexpr float kGroundHalfExtentsZ = 20.0F;
-    constexpr float kGroundY = -0.5F;
+    constexpr Vector3 kGroundHalfExtents = PhysicsSceneLayout::kGroundHalfExtents;
     
     // Create collision shape
-    btCollisionShape* groundShape = new btBoxShape(
-        btVector3(kGroundHalfExtentsX, kGroundHalfExtentsY, kGroundHalfExtentsZ)
-    );
+    ShapeHandle groundShape = physicsWorld.getShapeCache().acquireBox(kGroundHalfExtents);
     
-    // Create ground model
+    // Create ground model (unit cube shared through the cache, scaled per entity)
     constexpr float kCubeSize = 1.0F;
-    Mesh cubeMesh = GenMeshCube(kCubeSize, kCubeSize, kCubeSize);
-    Model groundModel = LoadModelFromMesh(cubeMesh);
-    const bool hasGroundModel = IsModelValid(groundModel);
+    ModelHandle groundModel = assetCache->acquireGeneratedModel("generated:cube:1.0", [] {
+        return LoadModelFromMesh(GenMeshCube(kCubeSize, kCubeSize, kCubeSize));
+    });
     
     // Create ground entity
-    const Vector3 groundPosition{0.0F, kGroundY, 0.0F};
-    const Vector3 groundScale{40.0F, 1.0F, 40.0F};
+    const Vector3 groundPosition{0.0F, PhysicsSceneLayout::kGroundY, 0.0F};
+    const Vector3 groundScale = Vector3Scale(kGroundHalfExtents, 2.0F);
     
     auto groundEntity = createPhysicsEntity(
         groundPosition,
-        groundShape,
+        std::move(groundShape),
         0.0F,  // Static (mass = 0)
-        hasGroundModel,
-        groundModel,
+        std::move(groundModel),
         DARKGREEN,
         true  // isGround
     );
@@ -115,89 +247,114 @@ void BulletPhysicsScene::createGroundPlane() {
     }
 }
 
-void BulletPhysicsScene::createFallingBoxes() {
-    constexpr int kBoxCount = 10;
-    constexpr float kBoxSize = 0.5F;
-    constexpr float kBoxMass = 1.0F;
-    constexpr float kStartHeight = 5.0F;
-    constexpr float kSpacing = 2.0F;
-    
-    // Create a cube mesh for the boxes (shared mesh)
-    Mesh cubeMesh = GenMeshCube(kBoxSize * 2.0F, kBoxSize * 2.0F, kBoxSize * 2.0F);
-    
-    // Create boxes in a grid pattern
-    const int kGridSize = static_cast<int>(std::sqrt(static_cast<float>(kBoxCount)));
-    int boxIndex = 0;
-    
-    for (int i = 0; i < kGridSize && boxIndex < kBoxCount; ++i) {
-        for (int j = 0; j < kGridSize && boxIndex < kBoxCount; ++j) {
-            // Calculate position
-            const float posX = (static_cast<float>(i) - static_cast<float>(kGridSize) / 2.0F) * kSpacing;
-            const float posZ = (static_cast<float>(j) - static_cast<float>(kGridSize) / 2.0F) * kSpacing;
-            
-            // Create collision shape
-            btCollisionShape* boxShape = new btBoxShape(
-                btVector3(kBoxSize, kBoxSize, kBoxSize)
-            );
-            
-            // Create model (each box gets its own model instance)
-            Model boxModel = LoadModelFromMesh(cubeMesh);
-            const bool hasBoxModel = IsModelValid(boxModel);
-            
-            // Vary colors
-            const float hue = static_cast<float>(boxIndex) / static_cast<float>(kBoxCount);
-            const Color boxColor = ColorFromHSV(hue * 360.0F, 0.8F, 0.9F);
-            
-            // Create box entity
-            const Vector3 boxPosition{posX, kStartHeight, posZ};
-            createPhysicsEntity(
-                boxPosition,
-                boxShape,
-                kBoxMass,
-                hasBoxModel,
-                boxModel,
-                boxColor,
-                false  // not ground
-            );
-            
-            ++boxIndex;
+void BulletPhysicsScene::spawnEntities(
+    std::span<const EntitySpawn> spawns,
+    std::span<const ShapeHandle> shapes,
+    std::span<const ModelHandle> models,
+    std::vector<entt::entity>* entities
+) {
+    if (!isInitialized || spawns.empty()) {
+        return;
+    }
+    
+    spawnBodies.clear();
+    spawnBodies.reserve(spawns.size());
+    size_t renderableCount = 0;
+    for (const EntitySpawn& spawn : spawns) {
+        spawnBodies.push_back(spawn.body);
+        renderableCount += (spawn.modelIndex >= 0) ? 1 : 0;
+    }
+    physicsWorld.createBodies(spawnBodies, shapes, spawnedEntities);
+    
+    // Grow the render-side storage once rather than per entity
+    registry.storage<LocalBounds>().reserve(registry.storage<LocalBounds>().size() + renderableCount);
+    registry.storage<BoundsDirty>().reserve(registry.storage<BoundsDirty>().size() + renderableCount);
+    registry.storage<Renderable>().reserve(registry.storage<Renderable>().size() + renderableCount);
+    
+    // Bounds are looked up once per distinct model
+    std::vector<BoundingBox> modelBounds;
+    modelBounds.reserve(models.size());
+    for (const ModelHandle& model : models) {
+        modelBounds.push_back(assetCache->getModelBounds(model));
+    }
+    
+    for (size_t i = 0; i < spawns.size(); ++i) {
+        const EntitySpawn& spawn = spawns[i];
+        if (spawn.modelIndex < 0) {
+            continue;
+        }
+        
+        const auto modelIndex = static_cast<size_t>(spawn.modelIndex);
+        const entt::entity entity = spawnedEntities[i];
+        if (entity == entt::null) {
+            continue;
         }
+        registry.emplace<LocalBounds>(entity, modelBounds[modelIndex]);
+        registry.emplace<BoundsDirty>(entity);
+        
+        auto& renderable = registry.emplace<Renderable>(entity);
+        renderable.model = models[modelIndex];
+        renderable.color = spawn.color;
+        renderable.hasModel = true;
+    }
+    
+    if (entities != nullptr) {
+        entities->assign(spawnedEntities.begin(), spawnedEntities.end());
     }
 }
 
-void BulletPhysicsScene::createCharacter() {
-    constexpr const char* kCharacterPath = "assets/characters/character-a.glb";
-    constexpr float kCharacterMass = 0.0F;  // Static (doesn't fall)
-    constexpr float kCharacterDistance = 3.0F;  // Distance from origin (camera looks at origin)
-    constexpr float kGroundY = -0.5F;  // Ground plane Y position (matches createGroundPlane)
-    
-    std::cout << "=== Creating Character ===" << std::endl;
-    std::cout << "Character path: " << kCharacterPath << std::endl;
+void BulletPhysicsScene::spawnBoxes(size_t count) {
+    constexpr float kBoxSize = PhysicsSceneLayout::kBoxHalfExtent;
+    constexpr size_t kLayerSize = PhysicsSceneLayout::kLayerSize;
     
-    // Check if model file exists
-    if (!FileExists(kCharacterPath)) {
-        std::cout << "ERROR: Character model not found at: " << kCharacterPath << std::endl;
-        std::cout << "Current working directory check..." << std::endl;
+    if (!isInitialized || count == 0) {
         return;
     }
     
-    std::cout << "Character file exists, loading model..." << std::endl;
+    // Create a cube model for the boxes (one GPU copy shared by every box)
+    const ModelHandle boxModel = assetCache->acquireGeneratedModel("generated:cube:1.0", [] {
+        return LoadModelFromMesh(GenMeshCube(kBoxSize * 2.0F, kBoxSize * 2.0F, kBoxSize * 2.0F));
+    });
     
-    // Load the character model
-    Model characterModel = LoadModel(kCharacterPath);
-    const bool hasCharacterModel = IsModelValid(characterModel);
+    // Every box shares one collision shape
+    const ShapeHandle boxShape = physicsWorld.getShapeCache().acquireBox(Vector3{kBoxSize, kBoxSize, kBoxSize});
     
-    std::cout << "Model loaded. IsValid: " << (hasCharacterModel ? "YES" : "NO") << std::endl;
-    std::cout << "Model mesh count: " << characterModel.meshCount << std::endl;
-    std::cout << "Model material count: " << characterModel.materialCount << std::endl;
-    
-    if (!hasCharacterModel) {
-        std::cout << "ERROR: Failed to load character model from: " << kCharacterPath << std::endl;
-        return;
+    const size_t rowLength = PhysicsSceneLayout::getBoxRowLength(count);
+    std::vector<EntitySpawn> spawns(count);
+    for (size_t boxIndex = 0; boxIndex < count; ++boxIndex) {
+        // Vary colors
+        const float hue = static_cast<float>(boxIndex % kLayerSize) / static_cast<float>(kLayerSize);
+        
+        EntitySpawn& spawn = spawns[boxIndex];
+        spawn.body.position = PhysicsSceneLayout::getBoxPosition(boxIndex, rowLength);
+        spawn.body.mass = PhysicsSceneLayout::kBoxMass;
+        spawn.modelIndex = 0;
+        spawn.color = ColorFromHSV(hue * 360.0F, 0.8F, 0.9F);
     }
     
+    const ShapeHandle shapes[] = {boxShape};
+    const ModelHandle models[] = {boxModel};
+    spawnEntities(spawns, shapes, models);
+}
+
+void BulletPhysicsScene::createCharacter() {
+    std::cout << "=== Creating Character ===" << std::endl;
+    std::cout << "Character path: " << kCharacterPath << std::endl;
+    
+    // Stream the model in the background; a placeholder stands at the origin meanwhile
+    spawnWhenLoaded(assetCache->requestModel(kCharacterPath), Vector3{0.0F, 0.0F, 0.0F}, &BulletPhysicsScene::spawnCharacter);
+}
+
+void BulletPhysicsScene::spawnCharacter(ModelHandle characterModel) {
+    constexpr float kCharacterMass = 0.0F;  // Static (doesn't fall)
+    constexpr float kCharacterDistance = 3.0F;  // Distance from origin (camera looks at origin)
+    constexpr float kGroundY = -0.5F;  // Ground plane Y position (matches createGroundPlane)
+    
+    std::cout << "Model mesh count: " << characterModel->meshCount << std::endl;
+    std::cout << "Model material count: " << characterModel->materialCount << std::endl;
+    
     // Get bounding box to determine collision shape size
-    const BoundingBox boundingBox = GetModelBoundingBox(characterModel);
+    const BoundingBox boundingBox = assetCache->getModelBounds(characterModel);
     const Vector3 boundingSize = Vector3Subtract(boundingBox.max, boundingBox.min);
     
     std::cout << "Character model loaded. Bounding box size: (" 
@@ -210,10 +367,7 @@ void BulletPhysicsScene::createCharacter() {
     
     // Create capsule collision shape (better for characters than boxes)
     // btCapsuleShape is Y-axis aligned by default (upright for characters)
-    btCollisionShape* capsuleShape = new btCapsuleShape(
-        static_cast<btScalar>(capsuleRadius),
-        static_cast<btScalar>(capsuleHeight)
-    );
+    ShapeHandle capsuleShape = physicsWorld.getShapeCache().acquireCapsule(capsuleRadius, capsuleHeight);
     
     // Position character on the ground
     // Ground is at Y = -0.5, and the ground plane has a half-extent of 0.5, so the top of the ground is at Y = 0.0
@@ -238,16 +392,15 @@ void BulletPhysicsScene::createCharacter() {
     
     const auto characterEntity = createPhysicsEntity(
         characterPosition,
-        capsuleShape,
+        std::move(capsuleShape),
         kCharacterMass,
-        hasCharacterModel,
         characterModel,
         WHITE,  // Use model's original colors
         false   // not ground
     );
     
     // Add Name component to identify the character
-    registry.emplace<Name>(characterEntity, "character-a");
+    entityNames.assign(characterEntity, "character-a");
     
     // Set a visible scale for the character (GLB models might be very small or large)
     if (registry.all_of<Transform>(characterEntity)) {
@@ -260,59 +413,44 @@ void BulletPhysicsScene::createCharacter() {
     }
     
     // Debug: Print model info
-    std::cout << "Character entity created with " << characterModel.meshCount << " meshes" << std::endl;
-    std::cout << "Character entity created with " << characterModel.materialCount << " materials" << std::endl;
+    std::cout << "Character entity created with " << characterModel->meshCount << " meshes" << std::endl;
+    std::cout << "Character entity created with " << characterModel->materialCount << " materials" << std::endl;
 }
 
 void BulletPhysicsScene::createCar() {
-    constexpr const char* kCarPath = "assets/cars/police.glb";
-    constexpr float kCarMass = 1000.0F;  // Car mass in kg (typical sedan)
-    constexpr float kCarDistance = 5.0F;  // Distance from origin
-    
     std::cout << "=== Creating Car ===" << std::endl;
     std::cout << "Car path: " << kCarPath << std::endl;
     
-    // Check if model file exists
-    if (!FileExists(kCarPath)) {
-        std::cout << "ERROR: Car model not found at: " << kCarPath << std::endl;
-        return;
-    }
-    
-    std::cout << "Car file exists, loading model..." << std::endl;
-    
-    // Load the car model
-    Model carModel = LoadModel(kCarPath);
-    const bool hasCarModel = IsModelValid(carModel);
-    
-    std::cout << "Model loaded. IsValid: " << (hasCarModel ? "YES" : "NO") << std::endl;
-    std::cout << "Model mesh count: " << carModel.meshCount << std::endl;
-    std::cout << "Model material count: " << carModel.materialCount << std::endl;
+    // Stream the model in the background; a placeholder marks the parking spot meanwhile
+    spawnWhenLoaded(assetCache->requestModel(kCarPath), Vector3{kCarDistance, 0.0F, 0.0F}, &BulletPhysicsScene::spawnCar);
+}
+
+void BulletPhysicsScene::spawnCar(ModelHandle carModel) {
+    constexpr float kCarMass = 1000.0F;  // Car mass in kg (typical sedan)
     
-    if (!hasCarModel) {
-        std::cout << "ERROR: Failed to load car model from: " << kCarPath << std::endl;
-        return;
-    }
+    std::cout << "Model mesh count: " << carModel->meshCount << std::endl;
+    std::cout << "Model material count: " << carModel->materialCount << std::endl;
     
     // Get bounding box to determine collision shape size
-    const BoundingBox boundingBox = GetModelBoundingBox(carModel);
+    const BoundingBox boundingBox = assetCache->getModelBounds(carModel);
     const Vector3 boundingSize = Vector3Subtract(boundingBox.max, boundingBox.min);
     
     std::cout << "Car model loaded. Bounding box size: (" 
               << boundingSize.x << ", " << boundingSize.y << ", " << boundingSize.z << ")" << std::endl;
     
-    // Create box collision shape for the car (appropriate for vehicles)
-    // Use half-extents for btBoxShape
-    const float halfExtentX = std::max(boundingSize.x * 0.5F, 0.5F);
-    const float halfExtentY = std::max(boundingSize.y * 0.5F, 0.3F);
-    const float halfExtentZ = std::max(boundingSize.z * 0.5F, 0.8F);
-    
-    btCollisionShape* boxShape = new btBoxShape(
-        btVector3(
-            static_cast<btScalar>(halfExtentX),
-            static_cast<btScalar>(halfExtentY),
-            static_cast<btScalar>(halfExtentZ)
-        )
-    );
+    // Convex hull around the car mesh; baked offline when available, otherwise computed once
+    // per model and shared by every spawn
+    const auto bakedHull = assetCache->getBakedHull(carModel);
+    ShapeHandle carShape = bakedHull.empty()
+        ? physicsWorld.getShapeCache().acquireConvexHull(*carModel)
+        : physicsWorld.getShapeCache().acquireConvexHull(bakedHull);
+    if (carShape == nullptr) {
+        // No CPU-side vertices: fall back to a box around the bounding box
+        const float halfExtentX = std::max(boundingSize.x * 0.5F, 0.5F);
+        const float halfExtentY = std::max(boundingSize.y * 0.5F, 0.3F);
+        const float halfExtentZ = std::max(boundingSize.z * 0.5F, 0.8F);
+        carShape = physicsWorld.getShapeCache().acquireBox(Vector3{halfExtentX, halfExtentY, halfExtentZ});
+    }
     
     // Position car on the ground, offset from origin
     // Ground is at Y = -0.5, and the ground plane has a half-extent of 0.5, so the top of the ground is at Y = 0.0
@@ -333,16 +471,20 @@ void BulletPhysicsScene::createCar() {
     // Create car entity
     const auto carEntity = createPhysicsEntity(
         carPosition,
-        boxShape,
+        std::move(carShape),
         kCarMass,
-        hasCarModel,
         carModel,
         WHITE,  // Use model's original colors
         false   // not ground
     );
     
     // Add Name component to identify the car
-    registry.emplace<Name>(carEntity, "car-sedan");
+    entityNames.assign(carEntity, "car-sedan");
+    
+    // Simplified levels and an impostor for when the car is far away (built once per model)
+    if (LodHandle carLod = assetCache->acquireLodModel(carModel, LodSettings{}); carLod != nullptr) {
+        registry.emplace<Lod>(carEntity, std::move(carLod));
+    }
     
     // Set appropriate scale for the car
     if (registry.all_of<Transform>(carEntity)) {
@@ -352,73 +494,193 @@ void BulletPhysicsScene::createCar() {
                   << transform.scale.y << ", " << transform.scale.z << ")" << std::endl;
     }
     
+    attachRoofCargo(carEntity, boundingBox.max.y);
+    
     // Debug: Print model info
-    std::cout << "Car entity created with " << carModel.meshCount << " meshes" << std::endl;
-    std::cout << "Car entity created with " << carModel.materialCount << " materials" << std::endl;
+    std::cout << "Car entity created with " << carModel->meshCount << " meshes" << std::endl;
+    std::cout << "Car entity created with " << carModel->materialCount << " materials" << std::endl;
+}
+
+void BulletPhysicsScene::attachRoofCargo(entt::entity carEntity, float roofY) {
+    constexpr float kCubeSize = 1.0F;
+    constexpr Vector3 kCargoSize{0.9F, 0.35F, 0.6F};
+    ModelHandle cargoModel = assetCache->acquireGeneratedModel("generated:cube:1.0", [] {
+        return LoadModelFromMesh(GenMeshCube(kCubeSize, kCubeSize, kCubeSize));
+    });
+    if (cargoModel == nullptr) {
+        return;
+    }
+    
+    // No body of its own: the hierarchy carries it along with the car's pose
+    const auto cargo = registry.create();
+    registry.emplace<LocalBounds>(cargo, assetCache->getModelBounds(cargoModel));
+    registry.emplace<BoundsDirty>(cargo);
+    
+    auto& renderable = registry.emplace<Renderable>(cargo);
+    renderable.model = std::move(cargoModel);
+    renderable.color = BROWN;
+    renderable.hasModel = true;
+    
+    Transform local;
+    local.position = Vector3{0.0F, roofY + (kCargoSize.y * 0.5F), 0.0F};
+    local.scale = kCargoSize;
+    HierarchySystem::attach(registry, cargo, carEntity, local);
+}
+
+void BulletPhysicsScene::spawnWhenLoaded(ModelRequestHandle request, const Vector3& groundPosition, SpawnFunction spawn) {
+    if (request->getStatus() == ModelRequest::Status::Ready) {
+        (this->*spawn)(request->getModel());
+        return;
+    }
+    
+    // Translucent unit cube resting on the ground, drawn until the model arrives
+    constexpr float kCubeSize = 1.0F;
+    constexpr float kPlaceholderAlpha = 0.4F;
+    ModelHandle placeholderModel = assetCache->acquireGeneratedModel("generated:cube:1.0", [] {
+        return LoadModelFromMesh(GenMeshCube(kCubeSize, kCubeSize, kCubeSize));
+    });
+    
+    const auto placeholder = registry.create();
+    auto& transform = registry.emplace<Transform>(placeholder);
+    transform.position = Vector3Add(groundPosition, Vector3{0.0F, kCubeSize * 0.5F, 0.0F});
+    
+    if (placeholderModel != nullptr) {
+        registry.emplace<LocalBounds>(placeholder, assetCache->getModelBounds(placeholderModel));
+        registry.emplace<BoundsDirty>(placeholder);
+        
+        auto& renderable = registry.emplace<Renderable>(placeholder);
+        renderable.model = std::move(placeholderModel);
+        renderable.color = Fade(LIGHTGRAY, kPlaceholderAlpha);
+        renderable.hasModel = true;
+    }
+    
+    pendingSpawns.push_back(PendingSpawn{std::move(request), placeholder, spawn});
+}
+
+void BulletPhysicsScene::processPendingSpawns() {
+    std::erase_if(pendingSpawns, [this](const PendingSpawn& pending) {
+        if (!pending.request->isDone()) {
+            return false;
+        }
+        
+        registry.destroy(pending.placeholder);
+        if (pending.request->getStatus() == ModelRequest::Status::Ready) {
+            (this->*pending.spawn)(pending.request->getModel());
+        } else {
+            std::cout << "ERROR: Failed to load model from: " << pending.request->getPath() << std::endl;
+        }
+        return true;
+    });
+}
+
+void BulletPhysicsScene::processDebrisRequests() {
+    std::erase_if(debrisRequests, [this](const ModelRequestHandle& request) {
+        if (!request->isDone()) {
+            return false;
+        }
+        
+        if (request->getStatus() == ModelRequest::Status::Ready) {
+            debris.addType(request->getModel(), assetCache->getModelBounds(request->getModel()));
+        } else {
+            std::cout << "ERROR: Failed to load model from: " << request->getPath() << std::endl;
+        }
+        return true;
+    });
+}
+
+void BulletPhysicsScene::spawnDebris(size_t count, float speed) {
+    if (!isInitialized) {
+        return;
+    }
+    
+    // Burst from just above the car's roof line
+    constexpr float kBurstHeight = 1.0F;
+    Vector3 origin{0.0F, kBurstHeight, 0.0F};
+    if (const entt::entity car = findEntityByName("car-sedan"); car != entt::null && registry.all_of<Transform>(car)) {
+        origin = Vector3Add(registry.get<Transform>(car).position, Vector3{0.0F, kBurstHeight, 0.0F});
+    }
+    debris.spawnBurst(origin, count, speed);
+}
+
+void BulletPhysicsScene::collectDebrisPromotions() {
+    if (!debrisPromotionEnabled || promotedDebrisCount + pendingPromotions.size() >= kMaxPromotedDebris) {
+        return;
+    }
+    
+    const size_t remaining = kMaxPromotedDebris - promotedDebrisCount - pendingPromotions.size();
+    debris.promoteNear(promotionCenter, kDebrisPromotionRadius, std::min(remaining, kMaxPromotionsPerFrame), pendingPromotions);
+}
+
+void BulletPhysicsScene::spawnPromotedDebris() {
+    if (pendingPromotions.empty()) {
+        return;
+    }
+    
+    // One box per debris type, sized to its model bounds
+    std::vector<ShapeHandle> shapes;
+    std::vector<ModelHandle> models;
+    shapes.reserve(debris.getTypeCount());
+    models.reserve(debris.getTypeCount());
+    for (std::uint32_t type = 0; type < debris.getTypeCount(); ++type) {
+        const BoundingBox& bounds = debris.getTypeBounds(type);
+        shapes.push_back(physicsWorld.getShapeCache().acquireBox(Vector3Scale(Vector3Subtract(bounds.max, bounds.min), 0.5F)));
+        models.push_back(debris.getTypeModel(type));
+    }
+    
+    std::vector<EntitySpawn> spawns(pendingPromotions.size());
+    for (size_t i = 0; i < pendingPromotions.size(); ++i) {
+        const DebrisPromotion& promotion = pendingPromotions[i];
+        spawns[i].body.position = promotion.position;
+        spawns[i].body.rotation = promotion.rotation;
+        spawns[i].body.shapeIndex = promotion.type;
+        spawns[i].body.mass = kDebrisMass;
+        spawns[i].modelIndex = static_cast<std::int32_t>(promotion.type);
+    }
+    
+    std::vector<entt::entity> entities;
+    spawnEntities(spawns, shapes, models, &entities);
+    
+    // Bodies continue with the motion the pieces had
+    for (size_t i = 0; i < entities.size(); ++i) {
+        if (entities[i] == entt::null) {
+            continue;
+        }
+        const DebrisPromotion& promotion = pendingPromotions[i];
+        btRigidBody* body = registry.get<PhysicsBody>(entities[i]).rigidBody;
+        body->setLinearVelocity(btVector3(promotion.velocity.x, promotion.velocity.y, promotion.velocity.z));
+        body->setAngularVelocity(btVector3(promotion.angularVelocity.x, promotion.angularVelocity.y, promotion.angularVelocity.z));
+    }
+    
+    promotedDebrisCount += entities.size() - static_cast<size_t>(std::ranges::count(entities, entt::entity{entt::null}));
+    pendingPromotions.clear();
 }
 
 entt::entity BulletPhysicsScene::createPhysicsEntity(
     const Vector3& position,
-    btCollisionShape* collisionShape,
+    ShapeHandle collisionShape,
     float mass,
-    bool hasModel,
-    const Model& model,
+    ModelHandle model,
     const Color& color,
     bool isGround
 ) {
-    // Create entity
-    const auto entity = registry.create();
-    
-    // Add Transform component
-    auto& transform = registry.emplace<Transform>(entity);
-    transform.position = position;
-    transform.rotation = Quaternion{0.0F, 0.0F, 0.0F, 1.0F};  // Identity quaternion (x, y, z, w)
-    transform.scale = Vector3{1.0F, 1.0F, 1.0F};
-    
-    // Setup Bullet Physics transform
-    btTransform bulletTransform;
-    bulletTransform.setIdentity();
-    bulletTransform.setOrigin(btVector3(position.x, position.y, position.z));
-    
-    // Calculate inertia
-    btVector3 localInertia(0.0, 0.0, 0.0);
-    const bool isStatic = (mass == 0.0F);
-    if (!isStatic) {
-        collisionShape->calculateLocalInertia(mass, localInertia);
-    }
-    
-    // Create motion state
-    btDefaultMotionState* motionState = new btDefaultMotionState(bulletTransform);
-    
-    // Create rigid body
-    btRigidBody::btRigidBodyConstructionInfo rigidBodyCI(
-        mass,
-        motionState,
-        collisionShape,
-        localInertia
-    );
-    
-    btRigidBody* rigidBody = new btRigidBody(rigidBodyCI);
-    
-    // Add rigid body to physics world
-    if (dynamicsWorld != nullptr) {
-        dynamicsWorld->addRigidBody(rigidBody);
-    }
-    
-    // Add PhysicsBody component
-    auto& physicsBody = registry.emplace<PhysicsBody>(entity);
-    physicsBody.rigidBody = rigidBody;
-    physicsBody.collisionShape = collisionShape;
-    physicsBody.motionState = motionState;
-    physicsBody.mass = mass;
-    physicsBody.isStatic = isStatic;
+    // Create the entity with Transform and PhysicsBody
+    const auto entity = physicsWorld.createBody(position, std::move(collisionShape), mass);
     
     // Add Renderable component if model is provided
-    if (hasModel) {
+    if (model != nullptr) {
+        // Bounds for culling; world-space bounds are filled by the next BoundsSystem::update
+        registry.emplace<LocalBounds>(entity, assetCache->getModelBounds(model));
+        registry.emplace<BoundsDirty>(entity);
+        
         auto& renderable = registry.emplace<Renderable>(entity);
-        renderable.model = model;
+        renderable.model = std::move(model);
         renderable.color = color;
-        renderable.hasModel = IsModelValid(model);
+        renderable.hasModel = true;
+        
+        // Static bodies never move: merge them instead of drawing them one by one
+        if (mass == 0.0F) {
+            registry.emplace<StaticMesh>(entity);  // Marks the batch dirty (onStaticMeshChanged)
+        }
     }
     
     // Add Ground tag if this is ground
@@ -430,127 +692,222 @@ entt::entity BulletPhysicsScene::createPhysicsEntity(
 }
 
 void BulletPhysicsScene::update() {
-    if (!isInitialized || dynamicsWorld == nullptr) {
+    if (!isInitialized) {
         return;
     }
     
-    // Update physics system (steps simulation and syncs transforms)
-    const float deltaTime = GetFrameTime();
-    PhysicsSystem::update(registry, dynamicsWorld, deltaTime);
+    // Swap placeholders for models that finished streaming in
+    processPendingSpawns();
+    processDebrisRequests();
+    staticBatch.update(registry);
+    promotionCenter = drawnCameraPosition;
+    
+    // Physics, debris, hierarchy and bounds (see registerSystems)
+    frameDeltaTime = GetFrameTime();
+    systemScheduler.run(registry, taskPool);
+    collectDebrisPromotions();
+    spawnPromotedDebris();
+    debris.buildDrawBatches(debrisBatches);
+    collectDebugLines(debugLines);
+    drawFromSnapshot = false;
 }
 
-void BulletPhysicsScene::draw() const {
+void BulletPhysicsScene::updateMainThread() {
     if (!isInitialized) {
         return;
     }
     
-    // Draw ground entities first
-    RenderSystem::drawGround(registry);
+    processPendingSpawns();
+    processDebrisRequests();
+    staticBatch.update(registry);
     
-    // Draw all other renderable entities
-    RenderSystem::draw(registry);
+    // Promotions queued by the last step; the next one promotes around this frame's camera
+    spawnPromotedDebris();
+    promotionCenter = drawnCameraPosition;
+}
+
+void BulletPhysicsScene::simulate(float deltaTime) {
+    if (!isInitialized) {
+        return;
+    }
     
-    // Draw debug markers and direct rendering for characters
-    auto characterView = registry.view<const Transform, const Renderable, const Name>();
-    size_t characterCount = 0;
-    bool hasCharacters = false;
+    frameDeltaTime = deltaTime;
+    systemScheduler.run(registry, taskPool);
+    collectDebrisPromotions();
     
-    for (auto entity : characterView) {
-        hasCharacters = true;
-        characterCount++;
-        const auto& transform = characterView.get<Transform>(entity);
-        const auto& renderable = characterView.get<Renderable>(entity);
-        
-        // Draw a small debug cube at character position (optional - can be removed)
-        // DrawCube(transform.position, 0.2F, 0.2F, 0.2F, BLUE);
-        
-        if (renderable.hasModel) {
-            // Draw bounding box for character
-            const BoundingBox bbox = GetModelBoundingBox(renderable.model);
-            const Vector3 bboxSize = Vector3Subtract(bbox.max, bbox.min);
-            const Vector3 bboxCenter = Vector3Add(bbox.min, Vector3Scale(bboxSize, 0.5F));
-            const Vector3 worldPos = Vector3Add(transform.position, bboxCenter);
-            
-            // Draw bounding box
-            DrawBoundingBox(BoundingBox{
-                Vector3Subtract(worldPos, Vector3Scale(bboxSize, 0.5F)),
-                Vector3Add(worldPos, Vector3Scale(bboxSize, 0.5F))
-            }, YELLOW);
-            
-            // Draw a small debug sphere at character position (optional - can be removed)
-            // DrawSphere(transform.position, 0.1F, RED);
-            
-            // Draw model with normal scale
-            // Use the transform scale if valid, otherwise use 1.0
-            const Vector3 drawScale = (transform.scale.x > 0.0F && transform.scale.y > 0.0F && transform.scale.z > 0.0F)
-                ? transform.scale
-                : Vector3{1.0F, 1.0F, 1.0F};
-            
-            // Draw the model once with proper scale
-            DrawModelEx(
-                renderable.model,
-                transform.position,
-                Vector3{0.0F, 1.0F, 0.0F},  // Y-axis
-                0.0F,  // No rotation
-                drawScale,
-                WHITE
-            );
-        } else {
-            // Model is invalid - draw a warning marker
-            DrawSphere(transform.position, 0.5F, ORANGE);
-        }
+    RenderSnapshot& snapshot = renderSnapshots[1 - frontSnapshot];
+    RenderSystem::captureSnapshot(registry, physicsWorld.getStepState().interpolationAlpha, snapshot);
+    debris.buildDrawBatches(snapshot.debris);
+    collectDebugLines(snapshot.debugLines);
+}
+
+void BulletPhysicsScene::publishFrame() {
+    if (!isInitialized) {
+        return;
     }
     
-    if (!hasCharacters) {
-        // No characters found - draw a test cube at origin to verify rendering works
-        DrawCube(Vector3{0.0F, 0.0F, 0.0F}, 1.0F, 1.0F, 1.0F, MAGENTA);
-        DrawCubeWires(Vector3{0.0F, 0.0F, 0.0F}, 1.0F, 1.0F, 1.0F, RED);
+    // Keep the LOD hysteresis: the levels the last frame drew go back to the registry, and
+    // on to the frame about to be shown, which was captured before that draw picked them
+    if (drawFromSnapshot) {
+        for (const RenderItem& item : renderSnapshots[frontSnapshot].items) {
+            if (item.lod == nullptr || !registry.valid(item.entity)) {
+                continue;
+            }
+            if (auto* lod = registry.try_get<Lod>(item.entity); lod != nullptr) {
+                lod->level = item.lodLevel;
+            }
+        }
     }
     
-    // Draw wireframes for physics objects (optional visual aid)
-    // Skip characters (entities with Name component) to avoid obscuring the model
-    auto view = registry.view<const Transform, const PhysicsBody>(entt::exclude<Ground>);
-    for (auto entity : view) {
-        // Skip entities with Name component (characters)
-        if (registry.all_of<Name>(entity)) {
+    frontSnapshot = 1 - frontSnapshot;
+    drawFromSnapshot = true;
+    
+    for (RenderItem& item : renderSnapshots[frontSnapshot].items) {
+        if (item.lod == nullptr || !registry.valid(item.entity)) {
             continue;
         }
-        
-        const auto& transform = view.get<Transform>(entity);
-        constexpr float kBoxSize = 0.5F;
-        DrawCubeWiresV(
-            transform.position,
-            Vector3{kBoxSize * 2.0F, kBoxSize * 2.0F, kBoxSize * 2.0F},
-            DARKGRAY
-        );
+        if (const auto* lod = registry.try_get<Lod>(item.entity); lod != nullptr) {
+            item.lodLevel = lod->level;
+        }
     }
 }
 
-void BulletPhysicsScene::cleanupPhysicsWorld() {
-    // Delete dynamics world components
-    if (dynamicsWorld != nullptr) {
-        delete dynamicsWorld;
-        dynamicsWorld = nullptr;
+void BulletPhysicsScene::registerSystems() {
+    systemScheduler.clear();
+    
+    // Fixed steps and transform sync
+    systemScheduler.add(
+        "Physics",
+        SystemAccess{}.writes<Transform, PreviousTransform, PhysicsBody>(),
+        [this](entt::registry&) { physicsWorld.update(frameDeltaTime, &taskPool); }
+    );
+    
+    // Crash debris touches no components, so it overlaps the physics step
+    systemScheduler.add(
+        "Debris",
+        SystemAccess{},
+        [this](entt::registry&) { debris.update(frameDeltaTime); }
+    );
+    
+    // Carry moved parents' poses down to their attached parts
+    systemScheduler.add(
+        "Hierarchy",
+        SystemAccess{}
+            .reads<Children>()
+            .writes<Parent, LocalTransform, Transform, PreviousTransform, WorldMatrix, HierarchyRoot, HierarchyDirty, BoundsDirty>(),
+        [](entt::registry& systemRegistry) { HierarchySystem::update(systemRegistry); }
+    );
+    
+    // Refresh culling bounds for new entities and those physics or the hierarchy just moved
+    systemScheduler.add(
+        "Bounds",
+        SystemAccess{}.reads<LocalBounds, Transform, PreviousTransform>().writes<WorldBounds, BoundsDirty>(),
+        [this](entt::registry& systemRegistry) {
+            BoundsSystem::update(systemRegistry, physicsWorld.getMovedEntities(), &taskPool);
+        }
+    );
+}
+
+void BulletPhysicsScene::draw() const {
+    if (!isInitialized) {
+        return;
+    }
+    
+    if (drawFromSnapshot) {
+        drawSnapshot();
+        return;
     }
     
-    if (constraintSolver != nullptr) {
-        delete constraintSolver;
-        constraintSolver = nullptr;
+    // Cull against the camera set up by BeginMode3D
+    cullingStats.reset();
+    instancingStats.reset();
+    const Frustum frustum = Frustum::fromCurrentCamera();
+    const Frustum* cullingFrustum = frustumCullingEnabled ? &frustum : nullptr;
+    LodView lodView = LodView::fromCurrentCamera();
+    lodView.bias = lodBias;
+    drawnCameraPosition = lodView.cameraPosition;
+    
+    // Draw merged static geometry and any ground outside it first
+    staticBatch.draw(cullingFrustum, &cullingStats);
+    RenderSystem::drawGround(registry, cullingFrustum, &cullingStats);
+    
+    // Draw all other renderable entities (batched when instancing is available)
+    RenderSystem::draw(
+        registry,
+        &instancedRenderer,
+        physicsWorld.getStepState().interpolationAlpha,
+        cullingFrustum,
+        &cullingStats,
+        lodEnabled ? &lodView : nullptr
+    );
+    instancingStats.add(instancedRenderer);
+    DebrisSystem::draw(debrisBatches, instancedRenderer);
+    instancingStats.add(instancedRenderer);
+    debugLineRenderer.draw(debugLines);
+}
+
+void BulletPhysicsScene::drawSnapshot() const {
+    cullingStats.reset();
+    instancingStats.reset();
+    const Frustum frustum = Frustum::fromCurrentCamera();
+    LodView lodView = LodView::fromCurrentCamera();
+    lodView.bias = lodBias;
+    drawnCameraPosition = lodView.cameraPosition;
+    
+    // Everything comes from the snapshot; the registry may be mid-step
+    staticBatch.draw(frustumCullingEnabled ? &frustum : nullptr, &cullingStats);
+    RenderSystem::drawSnapshot(
+        renderSnapshots[frontSnapshot],
+        instancedRenderer,
+        frustumCullingEnabled ? &frustum : nullptr,
+        &cullingStats,
+        lodEnabled ? &lodView : nullptr
+    );
+    instancingStats.add(instancedRenderer);
+    DebrisSystem::draw(renderSnapshots[frontSnapshot].debris, instancedRenderer);
+    instancingStats.add(instancedRenderer);
+    debugLineRenderer.draw(renderSnapshots[frontSnapshot].debugLines);
+}
+
+void BulletPhysicsScene::onStaticMeshChanged(entt::registry& /*owner*/, entt::entity /*entity*/) {
+    staticBatch.markDirty();
+}
+
+void BulletPhysicsScene::collectDebugLines(DebugLines& lines) {
+    lines.clear();
+    if (!debugDrawSettings.isAnyEnabled()) {
+        return;
     }
     
-    if (overlappingPairCache != nullptr) {
-        delete overlappingPairCache;
-        overlappingPairCache = nullptr;
+    // Bounds cached by BoundsSystem; named entities (character, car) stand out
+    if (debugDrawSettings.bounds) {
+        auto view = registry.view<const WorldBounds>();
+        for (auto entity : view) {
+            lines.addBox(view.get<WorldBounds>(entity).box, registry.all_of<Name>(entity) ? YELLOW : LIME);
+        }
     }
     
-    if (dispatcher != nullptr) {
-        delete dispatcher;
-        dispatcher = nullptr;
+    if (debugDrawSettings.markers) {
+        constexpr float kMarkerSize = 1.0F;
+        auto view = registry.view<const Transform, const Renderable>();
+        for (auto entity : view) {
+            if (!view.get<Renderable>(entity).hasModel) {
+                lines.addCross(view.get<Transform>(entity).position, kMarkerSize, ORANGE);
+            }
+        }
+        
+        // Nothing named and nothing streaming in: the character and car failed to load
+        if (entityNames.size() == 0 && pendingSpawns.empty()) {
+            const float half = kMarkerSize * 0.5F;
+            lines.addBox(BoundingBox{Vector3{-half, -half, -half}, Vector3{half, half, half}}, MAGENTA);
+        }
     }
     
-    if (collisionConfiguration != nullptr) {
-        delete collisionConfiguration;
-        collisionConfiguration = nullptr;
+    // The real collision shapes, AABBs and contacts, as Bullet sees them
+    if (debugDrawSettings.usesBullet()) {
+        if (btDiscreteDynamicsWorld* world = physicsWorld.getDynamicsWorld(); world != nullptr) {
+            bulletDebugDrawer.collect(*world, debugDrawSettings, lines);
+        }
     }
 }
 
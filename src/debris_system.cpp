@@ -0,0 +1,400 @@
+#include <project/debris_system.hpp>
+#include <project/ecs_components.hpp>
+#include <project/simd_lanes.hpp>
+#include <raymath.h>
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace project {
+
+namespace {
+    using namespace simd;
+
+    constexpr float kStepTime = 1.0F / 60.0F;
+    constexpr int kMaxStepsPerUpdate = 4;  // Slower frames drop debris time rather than spiral
+    constexpr float kMinRadius = 0.01F;
+    constexpr float kSpawnJitter = 0.3F;        // Spread of start positions around the origin
+    constexpr float kMinUpwardComponent = 0.3F;  // Pieces leave at least this steeply
+    constexpr float kMinSpinSpeed = 2.0F;        // Radians per second
+    constexpr float kMaxSpinSpeed = 12.0F;
+    constexpr size_t kFloatsPerMatrix = 16;
+    constexpr float kLastRow[4] = {0.0F, 0.0F, 0.0F, 1.0F};
+
+    static_assert(sizeof(Matrix) == kFloatsPerMatrix * sizeof(float), "Matrix must be 16 packed floats");
+
+    /// Pieces landing slower than this stop bouncing (a step of gravity, twice over)
+    float settleSpeed(float gravity) {
+        return 2.0F * gravity * kStepTime;
+    }
+} // namespace
+
+void DebrisSystem::Group::swapRemove(size_t index) {
+    const size_t last = size() - 1;
+    for (auto& stream : streams) {
+        stream[index] = stream[last];
+        stream.pop_back();
+    }
+}
+
+std::uint32_t DebrisSystem::addType(ModelHandle model, const BoundingBox& bounds) {
+    Group group;
+    group.model = std::move(model);
+    group.bounds = bounds;
+
+    // Tumbling pieces mostly come to rest on their flattest side
+    const Vector3 halfSize = Vector3Scale(Vector3Subtract(bounds.max, bounds.min), 0.5F);
+    group.radius = std::max(std::min({halfSize.x, halfSize.y, halfSize.z}), kMinRadius);
+
+    groups.push_back(std::move(group));
+    return static_cast<std::uint32_t>(groups.size() - 1);
+}
+
+void DebrisSystem::spawnBurst(const Vector3& origin, size_t count, float speed) {
+    if (groups.empty() || count == 0) {
+        return;
+    }
+
+    std::uniform_real_distribution<float> unit(0.0F, 1.0F);
+    std::uniform_real_distribution<float> signedUnit(-1.0F, 1.0F);
+    std::uniform_int_distribution<size_t> type(0, groups.size() - 1);
+
+    for (Group& group : groups) {
+        for (auto& stream : group.streams) {
+            stream.reserve(stream.size() + (count / groups.size()) + 1);
+        }
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        Group& group = groups[type(random)];
+
+        // Mostly upwards, evenly around the vertical axis
+        const float heading = unit(random) * 2.0F * PI;
+        const float upward = kMinUpwardComponent + (unit(random) * (1.0F - kMinUpwardComponent));
+        const float outward = std::sqrt(1.0F - (upward * upward));
+        const float pieceSpeed = speed * (0.5F + (0.5F * unit(random)));
+        const Vector3 velocity{std::cos(heading) * outward * pieceSpeed, upward * pieceSpeed, std::sin(heading) * outward * pieceSpeed};
+
+        const Quaternion rotation = QuaternionFromEuler(signedUnit(random) * PI, signedUnit(random) * PI, signedUnit(random) * PI);
+        Vector3 spinAxis = Vector3Normalize(Vector3{signedUnit(random), signedUnit(random), signedUnit(random)});
+        if (Vector3LengthSqr(spinAxis) == 0.0F) {
+            spinAxis = Vector3{0.0F, 1.0F, 0.0F};
+        }
+        const float spinSpeed = kMinSpinSpeed + (unit(random) * (kMaxSpinSpeed - kMinSpinSpeed));
+        const Quaternion spin = QuaternionFromAxisAngle(spinAxis, spinSpeed * kStepTime);
+
+        auto& streams = group.streams;
+        streams[PositionX].push_back(origin.x + (signedUnit(random) * kSpawnJitter));
+        streams[PositionY].push_back(std::max(origin.y + (unit(random) * kSpawnJitter), settings.groundY + group.radius));
+        streams[PositionZ].push_back(origin.z + (signedUnit(random) * kSpawnJitter));
+        streams[VelocityX].push_back(velocity.x);
+        streams[VelocityY].push_back(velocity.y);
+        streams[VelocityZ].push_back(velocity.z);
+        streams[RotationX].push_back(rotation.x);
+        streams[RotationY].push_back(rotation.y);
+        streams[RotationZ].push_back(rotation.z);
+        streams[RotationW].push_back(rotation.w);
+        streams[SpinX].push_back(spin.x);
+        streams[SpinY].push_back(spin.y);
+        streams[SpinZ].push_back(spin.z);
+        streams[SpinW].push_back(spin.w);
+        streams[Age].push_back(0.0F);
+    }
+}
+
+void DebrisSystem::update(float deltaTime) {
+    accumulator += std::max(deltaTime, 0.0F);
+    const int steps = std::min(static_cast<int>(accumulator / kStepTime), kMaxStepsPerUpdate);
+    accumulator = (steps == kMaxStepsPerUpdate) ? 0.0F : accumulator - (static_cast<float>(steps) * kStepTime);
+    if (steps == 0) {
+        return;
+    }
+
+    for (Group& group : groups) {
+        for (int i = 0; i < steps; ++i) {
+            step(group, kStepTime);
+        }
+
+        // Expire from the back, so swapped-in pieces were already checked
+        const std::vector<float>& ages = group.streams[Age];
+        for (size_t index = group.size(); index > 0; --index) {
+            if (ages[index - 1] > settings.lifetime) {
+                group.swapRemove(index - 1);
+            }
+        }
+    }
+}
+
+void DebrisSystem::step(Group& group, float stepTime) const {
+    auto& streams = group.streams;
+    const size_t count = group.size();
+    const float restingHeight = settings.groundY + group.radius;
+
+    size_t index = 0;
+#if defined(PROJECT_SIMD_SSE2) || defined(PROJECT_SIMD_NEON)
+    const Lanes zero = splat(0.0F);
+    const Lanes one = splat(1.0F);
+    const Lanes dt = splat(stepTime);
+    const Lanes gravityStep = splat(settings.gravity * stepTime);
+    const Lanes rest = splat(restingHeight);
+    const Lanes restitution = splat(-settings.restitution);
+    const Lanes friction = splat(settings.friction);
+    const Lanes settleLanes = splat(settleSpeed(settings.gravity));
+
+    for (; index + kLaneCount <= count; index += kLaneCount) {
+        float* const px = streams[PositionX].data() + index;
+        float* const py = streams[PositionY].data() + index;
+        float* const pz = streams[PositionZ].data() + index;
+        float* const vx = streams[VelocityX].data() + index;
+        float* const vy = streams[VelocityY].data() + index;
+        float* const vz = streams[VelocityZ].data() + index;
+
+        Lanes velocityX = load(vx);
+        Lanes velocityY = sub(load(vy), gravityStep);
+        Lanes velocityZ = load(vz);
+        const Lanes positionY = add(load(py), mul(velocityY, dt));
+        store(add(load(px), mul(velocityX, dt)), px);
+        store(add(load(pz), mul(velocityZ, dt)), pz);
+
+        // Ground contact: clamp to the resting height, bounce, and lose speed to friction
+        const Lanes contact = lessThan(positionY, rest);
+        Lanes bounce = mul(velocityY, restitution);
+        bounce = select(lessThan(bounce, settleLanes), zero, bounce);
+        velocityY = select(contact, bounce, velocityY);
+        velocityX = select(contact, mul(velocityX, friction), velocityX);
+        velocityZ = select(contact, mul(velocityZ, friction), velocityZ);
+        store(max(positionY, rest), py);
+        store(velocityX, vx);
+        store(velocityY, vy);
+        store(velocityZ, vz);
+
+        // Spin slows on contact too: shrink the rotation axis part, then rebuild w
+        float* const spinX = streams[SpinX].data() + index;
+        float* const spinY = streams[SpinY].data() + index;
+        float* const spinZ = streams[SpinZ].data() + index;
+        float* const spinW = streams[SpinW].data() + index;
+        Lanes sx = load(spinX);
+        Lanes sy = load(spinY);
+        Lanes sz = load(spinZ);
+        Lanes sw = load(spinW);
+        const Lanes dampedX = mul(sx, friction);
+        const Lanes dampedY = mul(sy, friction);
+        const Lanes dampedZ = mul(sz, friction);
+        const Lanes dampedW = sqrt(max(sub(one, add(add(mul(dampedX, dampedX), mul(dampedY, dampedY)), mul(dampedZ, dampedZ))), zero));
+        sx = select(contact, dampedX, sx);
+        sy = select(contact, dampedY, sy);
+        sz = select(contact, dampedZ, sz);
+        sw = select(contact, dampedW, sw);
+        store(sx, spinX);
+        store(sy, spinY);
+        store(sz, spinZ);
+        store(sw, spinW);
+
+        // rotation = rotation * spin (spin about the piece's own axes), renormalized
+        float* const rx = streams[RotationX].data() + index;
+        float* const ry = streams[RotationY].data() + index;
+        float* const rz = streams[RotationZ].data() + index;
+        float* const rw = streams[RotationW].data() + index;
+        const Lanes qx = load(rx);
+        const Lanes qy = load(ry);
+        const Lanes qz = load(rz);
+        const Lanes qw = load(rw);
+        Lanes nx = sub(add(add(mul(qw, sx), mul(qx, sw)), mul(qy, sz)), mul(qz, sy));
+        Lanes ny = add(add(sub(mul(qw, sy), mul(qx, sz)), mul(qy, sw)), mul(qz, sx));
+        Lanes nz = add(sub(add(mul(qw, sz), mul(qx, sy)), mul(qy, sx)), mul(qz, sw));
+        Lanes nw = sub(sub(sub(mul(qw, sw), mul(qx, sx)), mul(qy, sy)), mul(qz, sz));
+        const Lanes inverseLength = reciprocalSqrt(add(add(mul(nx, nx), mul(ny, ny)), add(mul(nz, nz), mul(nw, nw))));
+        store(mul(nx, inverseLength), rx);
+        store(mul(ny, inverseLength), ry);
+        store(mul(nz, inverseLength), rz);
+        store(mul(nw, inverseLength), rw);
+
+        float* const age = streams[Age].data() + index;
+        store(add(load(age), dt), age);
+    }
+#endif
+
+    // Remainder (everything on targets without a vector kernel)
+    const float settle = settleSpeed(settings.gravity);
+    for (; index < count; ++index) {
+        float& velocityY = streams[VelocityY][index];
+        velocityY -= settings.gravity * stepTime;
+        streams[PositionX][index] += streams[VelocityX][index] * stepTime;
+        streams[PositionY][index] += velocityY * stepTime;
+        streams[PositionZ][index] += streams[VelocityZ][index] * stepTime;
+
+        Quaternion spin{streams[SpinX][index], streams[SpinY][index], streams[SpinZ][index], streams[SpinW][index]};
+        if (streams[PositionY][index] < restingHeight) {
+            streams[PositionY][index] = restingHeight;
+            const float bounce = -velocityY * settings.restitution;
+            velocityY = (bounce < settle) ? 0.0F : bounce;
+            streams[VelocityX][index] *= settings.friction;
+            streams[VelocityZ][index] *= settings.friction;
+
+            spin.x *= settings.friction;
+            spin.y *= settings.friction;
+            spin.z *= settings.friction;
+            spin.w = std::sqrt(std::max(1.0F - ((spin.x * spin.x) + (spin.y * spin.y) + (spin.z * spin.z)), 0.0F));
+            streams[SpinX][index] = spin.x;
+            streams[SpinY][index] = spin.y;
+            streams[SpinZ][index] = spin.z;
+            streams[SpinW][index] = spin.w;
+        }
+
+        const Quaternion rotation{streams[RotationX][index], streams[RotationY][index], streams[RotationZ][index], streams[RotationW][index]};
+        const Quaternion next = QuaternionNormalize(QuaternionMultiply(rotation, spin));
+        streams[RotationX][index] = next.x;
+        streams[RotationY][index] = next.y;
+        streams[RotationZ][index] = next.z;
+        streams[RotationW][index] = next.w;
+        streams[Age][index] += stepTime;
+    }
+}
+
+void DebrisSystem::promoteNear(const Vector3& center, float radius, size_t maxCount, std::vector<DebrisPromotion>& promotions) {
+    const float radiusSquared = radius * radius;
+    size_t promoted = 0;
+
+    for (size_t type = 0; type < groups.size() && promoted < maxCount; ++type) {
+        Group& group = groups[type];
+        const auto& streams = group.streams;
+        for (size_t index = group.size(); index > 0 && promoted < maxCount; --index) {
+            const size_t piece = index - 1;
+            const Vector3 position{streams[PositionX][piece], streams[PositionY][piece], streams[PositionZ][piece]};
+            if (Vector3DistanceSqr(position, center) > radiusSquared) {
+                continue;
+            }
+
+            DebrisPromotion promotion;
+            promotion.type = static_cast<std::uint32_t>(type);
+            promotion.position = position;
+            promotion.rotation = Quaternion{streams[RotationX][piece], streams[RotationY][piece], streams[RotationZ][piece], streams[RotationW][piece]};
+            promotion.velocity = Vector3{streams[VelocityX][piece], streams[VelocityY][piece], streams[VelocityZ][piece]};
+
+            // Per-step spin about the piece's own axes -> world angular velocity
+            const Vector3 spinAxis{streams[SpinX][piece], streams[SpinY][piece], streams[SpinZ][piece]};
+            const float spinAngle = 2.0F * std::acos(std::clamp(streams[SpinW][piece], -1.0F, 1.0F));
+            if (Vector3LengthSqr(spinAxis) > 0.0F) {
+                const Vector3 worldAxis = Vector3RotateByQuaternion(Vector3Normalize(spinAxis), promotion.rotation);
+                promotion.angularVelocity = Vector3Scale(worldAxis, spinAngle / kStepTime);
+            }
+
+            promotions.push_back(promotion);
+            group.swapRemove(piece);
+            ++promoted;
+        }
+    }
+}
+
+void DebrisSystem::buildDrawBatches(std::vector<DebrisDrawBatch>& batches) const {
+    batches.resize(groups.size());
+    for (size_t type = 0; type < groups.size(); ++type) {
+        const Group& group = groups[type];
+        const auto& streams = group.streams;
+        const size_t count = group.size();
+        DebrisDrawBatch& batch = batches[type];
+        batch.model = group.model;
+        batch.matrices.resize(count);
+
+        size_t index = 0;
+#if defined(PROJECT_SIMD_SSE2) || defined(PROJECT_SIMD_NEON)
+        const Lanes one = splat(1.0F);
+        const Lanes two = splat(2.0F);
+        for (; index + kLaneCount <= count; index += kLaneCount) {
+            const auto stream = [&streams, index](Stream component) { return load(streams[component].data() + index); };
+            const Lanes qx = stream(RotationX);
+            const Lanes qy = stream(RotationY);
+            const Lanes qz = stream(RotationZ);
+            const Lanes qw = stream(RotationW);
+
+            // Same terms as Transform::getMatrix with unit scale, four pieces per instruction
+            const Lanes xx = mul(qx, qx);
+            const Lanes yy = mul(qy, qy);
+            const Lanes zz = mul(qz, qz);
+            const Lanes xy = mul(qx, qy);
+            const Lanes xz = mul(qx, qz);
+            const Lanes yz = mul(qy, qz);
+            const Lanes wx = mul(qw, qx);
+            const Lanes wy = mul(qw, qy);
+            const Lanes wz = mul(qw, qz);
+
+            float* rows = &batch.matrices[index].m0;
+            storeRows(sub(one, mul(two, add(yy, zz))), mul(two, sub(xy, wz)), mul(two, add(xz, wy)), stream(PositionX), rows);
+            storeRows(mul(two, add(xy, wz)), sub(one, mul(two, add(xx, zz))), mul(two, sub(yz, wx)), stream(PositionY), rows + 4);
+            storeRows(mul(two, sub(xz, wy)), mul(two, add(yz, wx)), sub(one, mul(two, add(xx, yy))), stream(PositionZ), rows + 8);
+            for (size_t lane = 0; lane < kLaneCount; ++lane) {
+                storeRow(kLastRow, rows + (lane * kFloatsPerMatrix) + 12);
+            }
+        }
+#endif
+
+        // Remainder (everything on targets without a vector kernel)
+        for (; index < count; ++index) {
+            Transform transform;
+            transform.position = Vector3{streams[PositionX][index], streams[PositionY][index], streams[PositionZ][index]};
+            transform.rotation = Quaternion{streams[RotationX][index], streams[RotationY][index], streams[RotationZ][index], streams[RotationW][index]};
+            batch.matrices[index] = transform.getMatrix();
+        }
+    }
+}
+
+void DebrisSystem::draw(std::span<const DebrisDrawBatch> batches, InstancedRenderer& renderer) {
+    // Without the instancing shader, fall back to a draw per piece and mesh
+    if (!renderer.isInstancingSupported()) {
+        for (const DebrisDrawBatch& batch : batches) {
+            if (batch.model == nullptr) {
+                continue;
+            }
+            const Model& model = *batch.model;
+            for (const Matrix& transform : batch.matrices) {
+                const Matrix worldMatrix = MatrixMultiply(model.transform, transform);
+                for (int i = 0; i < model.meshCount; ++i) {
+                    DrawMesh(model.meshes[i], model.materials[model.meshMaterial[i]], worldMatrix);
+                }
+            }
+        }
+        return;
+    }
+
+    renderer.begin();
+    for (const DebrisDrawBatch& batch : batches) {
+        if (batch.model != nullptr && !batch.matrices.empty()) {
+            renderer.submitInstances(*batch.model, batch.matrices, WHITE);
+        }
+    }
+    renderer.flush();
+}
+
+void DebrisSystem::clearPieces() noexcept {
+    for (Group& group : groups) {
+        for (auto& stream : group.streams) {
+            stream.clear();
+        }
+    }
+    accumulator = 0.0F;
+}
+
+void DebrisSystem::clear() noexcept {
+    groups.clear();
+    accumulator = 0.0F;
+}
+
+size_t DebrisSystem::getPieceCount() const noexcept {
+    size_t count = 0;
+    for (const Group& group : groups) {
+        count += group.size();
+    }
+    return count;
+}
+
+size_t DebrisSystem::getReservedBytes() const noexcept {
+    size_t bytes = groups.capacity() * sizeof(Group);
+    for (const Group& group : groups) {
+        for (const std::vector<float>& stream : group.streams) {
+            bytes += stream.capacity() * sizeof(float);
+        }
+    }
+    return bytes;
+}
+
+} // namespace project
@@ -0,0 +1,285 @@
+#include <project/debug_draw.hpp>
+#include <project/profiler.hpp>
+#include <raymath.h>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iostream>
+
+// rlgl is compiled into raylib, but its header is not shipped with the prebuilt library
+extern "C" unsigned int rlLoadVertexArray();
+extern "C" unsigned int rlLoadVertexBuffer(const void* buffer, int size, bool dynamic);
+extern "C" void rlUpdateVertexBuffer(unsigned int bufferId, const void* data, int dataSize, int offset);
+extern "C" void rlUnloadVertexArray(unsigned int vaoId);
+extern "C" void rlUnloadVertexBuffer(unsigned int vboId);
+extern "C" bool rlEnableVertexArray(unsigned int vaoId);
+extern "C" void rlDisableVertexArray();
+extern "C" void rlSetVertexAttribute(unsigned int index, int compSize, int type, bool normalized, int stride, int offset);
+extern "C" void rlEnableVertexAttribute(unsigned int index);
+extern "C" void rlEnableShader(unsigned int id);
+extern "C" void rlDisableShader();
+extern "C" void rlSetUniformMatrix(int locIndex, Matrix mat);
+extern "C" void rlDrawRenderBatchActive();
+extern "C" bool rlCheckRenderBatchLimit(int vCount);
+extern "C" Matrix rlGetMatrixModelview();
+extern "C" Matrix rlGetMatrixProjection();
+extern "C" void rlBegin(int mode);
+extern "C" void rlEnd();
+extern "C" void rlColor4ub(unsigned char r, unsigned char g, unsigned char b, unsigned char a);
+extern "C" void rlVertex3f(float x, float y, float z);
+
+#if !defined(__EMSCRIPTEN__)
+// GLFW is linked into raylib on desktop platforms; rlgl has no entry point for drawing lines from a buffer
+extern "C" void* glfwGetProcAddress(const char* procname);
+#endif
+
+namespace project {
+
+namespace {
+    constexpr int kGlLines = 0x0001;  // GL_LINES, also RL_LINES
+    constexpr int kGlFloat = 0x1406;
+    constexpr int kGlUnsignedByte = 0x1401;
+
+    // Lines per rlBegin() block in the fallback path, well inside rlgl's default batch
+    constexpr size_t kImmediateBatchLines = 4096;
+
+    constexpr float kContactNormalLength = 0.2F;
+
+    constexpr const char* kLineVertexShader = R"(#version 330
+in vec3 vertexPosition;
+in vec4 vertexColor;
+uniform mat4 mvp;
+out vec4 fragColor;
+
+void main() {
+    fragColor = vertexColor;
+    gl_Position = mvp * vec4(vertexPosition, 1.0);
+}
+)";
+
+    constexpr const char* kLineFragmentShader = R"(#version 330
+in vec4 fragColor;
+out vec4 finalColor;
+
+void main() {
+    finalColor = fragColor;
+}
+)";
+
+    using DrawArraysFunction = void (*)(unsigned int, int, int);
+    DrawArraysFunction drawArrays = nullptr;
+
+    Vector3 toVector3(const btVector3& vector) {
+        return Vector3{vector.x(), vector.y(), vector.z()};
+    }
+
+    Color toColor(const btVector3& color) {
+        const auto channel = [](btScalar value) {
+            return static_cast<unsigned char>(std::clamp(value, btScalar(0.0), btScalar(1.0)) * btScalar(255.0));
+        };
+        return Color{channel(color.x()), channel(color.y()), channel(color.z()), 255};
+    }
+} // namespace
+
+void DebugLines::addLine(const Vector3& from, const Vector3& to, Color color) {
+    vertices.push_back({from, color});
+    vertices.push_back({to, color});
+}
+
+void DebugLines::addBox(const BoundingBox& box, Color color) {
+    const Vector3& low = box.min;
+    const Vector3& high = box.max;
+    const std::array<Vector3, 8> corners{
+        Vector3{low.x, low.y, low.z}, Vector3{high.x, low.y, low.z},
+        Vector3{high.x, low.y, high.z}, Vector3{low.x, low.y, high.z},
+        Vector3{low.x, high.y, low.z}, Vector3{high.x, high.y, low.z},
+        Vector3{high.x, high.y, high.z}, Vector3{low.x, high.y, high.z},
+    };
+    for (size_t i = 0; i < 4; ++i) {
+        addLine(corners[i], corners[(i + 1) % 4], color);          // Bottom
+        addLine(corners[i + 4], corners[(i + 1) % 4 + 4], color);  // Top
+        addLine(corners[i], corners[i + 4], color);                // Sides
+    }
+}
+
+void DebugLines::addCross(const Vector3& center, float size, Color color) {
+    const float half = size * 0.5F;
+    addLine(Vector3{center.x - half, center.y, center.z}, Vector3{center.x + half, center.y, center.z}, color);
+    addLine(Vector3{center.x, center.y - half, center.z}, Vector3{center.x, center.y + half, center.z}, color);
+    addLine(Vector3{center.x, center.y, center.z - half}, Vector3{center.x, center.y, center.z + half}, color);
+}
+
+void BulletDebugDrawer::collect(btCollisionWorld& world, const DebugDrawSettings& settings, DebugLines& lines) {
+    mode = DBG_NoDebug;
+    if (settings.collisionShapes) {
+        mode |= DBG_DrawWireframe;
+    }
+    if (settings.aabbs) {
+        mode |= DBG_DrawAabb;
+    }
+    if (settings.contacts) {
+        mode |= DBG_DrawContactPoints;
+    }
+    if (mode == DBG_NoDebug) {
+        return;
+    }
+
+    // Attached only while drawing, so a rebuilt world never points at a stale drawer
+    target = &lines;
+    world.setDebugDrawer(this);
+    world.debugDrawWorld();
+    world.setDebugDrawer(nullptr);
+    target = nullptr;
+}
+
+void BulletDebugDrawer::drawLine(const btVector3& from, const btVector3& to, const btVector3& color) {
+    if (target != nullptr) {
+        target->addLine(toVector3(from), toVector3(to), toColor(color));
+    }
+}
+
+void BulletDebugDrawer::drawContactPoint(
+    const btVector3& pointOnB,
+    const btVector3& normalOnB,
+    btScalar distance,
+    int lifeTime,
+    const btVector3& color
+) {
+    static_cast<void>(distance);
+    static_cast<void>(lifeTime);
+    const btVector3 normalEnd = pointOnB + normalOnB * btScalar(kContactNormalLength);
+    drawLine(pointOnB, normalEnd, color);
+}
+
+void BulletDebugDrawer::reportErrorWarning(const char* warningString) {
+    std::cerr << "Bullet debug draw: " << warningString << "\n";
+}
+
+void BulletDebugDrawer::draw3dText(const btVector3& location, const char* textString) {
+    // Text would need the 2D pass; nothing in the scene asks Bullet for it
+    static_cast<void>(location);
+    static_cast<void>(textString);
+}
+
+DebugLineRenderer::~DebugLineRenderer() {
+    unload();
+}
+
+void DebugLineRenderer::initialize() {
+    initialized = true;
+
+#if !defined(__EMSCRIPTEN__)
+    if (drawArrays == nullptr) {
+        drawArrays = reinterpret_cast<DrawArraysFunction>(glfwGetProcAddress("glDrawArrays"));
+    }
+#endif
+    if (drawArrays == nullptr) {
+        return;
+    }
+
+    shader = LoadShaderFromMemory(kLineVertexShader, kLineFragmentShader);
+    if (!IsShaderValid(shader) || shader.locs[SHADER_LOC_VERTEX_POSITION] < 0 ||
+        shader.locs[SHADER_LOC_VERTEX_COLOR] < 0 || shader.locs[SHADER_LOC_MATRIX_MVP] < 0) {
+        std::cerr << "Debug line shader unavailable, drawing debug lines through rlgl\n";
+        if (IsShaderValid(shader)) {
+            UnloadShader(shader);
+        }
+        shader = Shader{};
+        return;
+    }
+    supported = true;
+}
+
+bool DebugLineRenderer::reserve(size_t vertexCount) {
+    if (vertexCount <= bufferCapacity) {
+        return true;
+    }
+
+    // Grow geometrically so a slowly growing scene doesn't reallocate every frame
+    const size_t capacity = std::max(vertexCount, bufferCapacity * 2);
+    if (vertexArray != 0) {
+        rlUnloadVertexArray(vertexArray);
+        rlUnloadVertexBuffer(vertexBuffer);
+        vertexArray = 0;
+        vertexBuffer = 0;
+    }
+
+    vertexArray = rlLoadVertexArray();
+    if (vertexArray == 0) {
+        // No vertex array objects (GL 2.1): stay on rlgl's batch
+        bufferCapacity = 0;
+        supported = false;
+        return false;
+    }
+    vertexBuffer = rlLoadVertexBuffer(nullptr, static_cast<int>(capacity * sizeof(DebugVertex)), true);
+    constexpr int kStride = sizeof(DebugVertex);
+    const auto positionLocation = static_cast<unsigned int>(shader.locs[SHADER_LOC_VERTEX_POSITION]);
+    const auto colorLocation = static_cast<unsigned int>(shader.locs[SHADER_LOC_VERTEX_COLOR]);
+    rlSetVertexAttribute(positionLocation, 3, kGlFloat, false, kStride, static_cast<int>(offsetof(DebugVertex, position)));
+    rlEnableVertexAttribute(positionLocation);
+    rlSetVertexAttribute(colorLocation, 4, kGlUnsignedByte, true, kStride, static_cast<int>(offsetof(DebugVertex, color)));
+    rlEnableVertexAttribute(colorLocation);
+    rlDisableVertexArray();
+    bufferCapacity = capacity;
+    return true;
+}
+
+void DebugLineRenderer::draw(const DebugLines& lines) {
+    if (lines.empty()) {
+        return;
+    }
+
+    PROJECT_PROFILE_SCOPE("DebugLineRenderer::draw");
+
+    if (!initialized) {
+        initialize();
+    }
+
+    const std::span<const DebugVertex> vertices = lines.getVertices();
+    if (!supported || !reserve(vertices.size())) {
+        drawImmediate(vertices);
+        return;
+    }
+
+    // Whatever raylib batched so far has to land first to keep the draw order
+    rlDrawRenderBatchActive();
+    rlUpdateVertexBuffer(vertexBuffer, vertices.data(), static_cast<int>(vertices.size_bytes()), 0);
+
+    rlEnableShader(shader.id);
+    rlSetUniformMatrix(shader.locs[SHADER_LOC_MATRIX_MVP], MatrixMultiply(rlGetMatrixModelview(), rlGetMatrixProjection()));
+    rlEnableVertexArray(vertexArray);
+    drawArrays(kGlLines, 0, static_cast<int>(vertices.size()));
+    rlDisableVertexArray();
+    rlDisableShader();
+}
+
+void DebugLineRenderer::drawImmediate(std::span<const DebugVertex> vertices) {
+    for (size_t first = 0; first < vertices.size(); first += kImmediateBatchLines * 2) {
+        const size_t count = std::min(kImmediateBatchLines * 2, vertices.size() - first);
+        rlCheckRenderBatchLimit(static_cast<int>(count));
+        rlBegin(kGlLines);
+        for (const DebugVertex& vertex : vertices.subspan(first, count)) {
+            rlColor4ub(vertex.color.r, vertex.color.g, vertex.color.b, vertex.color.a);
+            rlVertex3f(vertex.position.x, vertex.position.y, vertex.position.z);
+        }
+        rlEnd();
+    }
+}
+
+void DebugLineRenderer::unload() {
+    if (vertexArray != 0) {
+        rlUnloadVertexArray(vertexArray);
+        rlUnloadVertexBuffer(vertexBuffer);
+    }
+    if (IsShaderValid(shader)) {
+        UnloadShader(shader);
+    }
+    shader = Shader{};
+    vertexArray = 0;
+    vertexBuffer = 0;
+    bufferCapacity = 0;
+    initialized = false;
+    supported = false;
+}
+
+} // namespace project
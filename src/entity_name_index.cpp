@@ -0,0 +1,61 @@
+#include <project/entity_name_index.hpp>
+#include <utility>
+
+namespace project {
+
+EntityNameIndex::EntityNameIndex(entt::registry& registry)
+    : registry(&registry) {
+    auto view = registry.view<const Name>();
+    for (const auto entity : view) {
+        entities.insert_or_assign(view.get<const Name>(entity).value, entity);
+    }
+
+    registry.on_construct<Name>().connect<&EntityNameIndex::onNameAssigned>(*this);
+    registry.on_update<Name>().connect<&EntityNameIndex::onNameAssigned>(*this);
+    registry.on_destroy<Name>().connect<&EntityNameIndex::onNameRemoved>(*this);
+}
+
+EntityNameIndex::~EntityNameIndex() {
+    registry->on_construct<Name>().disconnect<&EntityNameIndex::onNameAssigned>(*this);
+    registry->on_update<Name>().disconnect<&EntityNameIndex::onNameAssigned>(*this);
+    registry->on_destroy<Name>().disconnect<&EntityNameIndex::onNameRemoved>(*this);
+}
+
+void EntityNameIndex::assign(entt::entity entity, std::string name) {
+    // on_update only sees the new name, so the old entry goes first
+    if (const Name* previous = registry->try_get<Name>(entity); previous != nullptr) {
+        erase(previous->value, entity);
+    }
+    registry->emplace_or_replace<Name>(entity, std::move(name));
+}
+
+void EntityNameIndex::remove(entt::entity entity) {
+    registry->remove<Name>(entity);
+}
+
+entt::entity EntityNameIndex::find(std::string_view name) const {
+    const auto iterator = entities.find(name);
+    if (iterator == entities.end() || !registry->valid(iterator->second)) {
+        return entt::null;
+    }
+
+    const Name* current = registry->try_get<Name>(iterator->second);
+    return (current != nullptr && current->value == name) ? iterator->second : entt::null;
+}
+
+void EntityNameIndex::erase(std::string_view name, entt::entity entity) {
+    if (const auto iterator = entities.find(name); iterator != entities.end() && iterator->second == entity) {
+        entities.erase(iterator);
+    }
+}
+
+void EntityNameIndex::onNameAssigned(entt::registry& owner, entt::entity entity) {
+    entities.insert_or_assign(owner.get<Name>(entity).value, entity);
+}
+
+void EntityNameIndex::onNameRemoved(entt::registry& owner, entt::entity entity) {
+    // Runs before the component is removed, so the name is still readable
+    erase(owner.get<Name>(entity).value, entity);
+}
+
+} // namespace project
@@ -0,0 +1,15 @@
+#include <project/frustum.hpp>
+#include <raymath.h>
+
+// rlgl is compiled into raylib, but its header is not shipped with the prebuilt library
+extern "C" Matrix rlGetMatrixModelview();
+extern "C" Matrix rlGetMatrixProjection();
+
+namespace project {
+
+Frustum Frustum::fromCurrentCamera() {
+    // Same order rlgl uses to build the mvp it uploads to shaders
+    return fromViewProjection(MatrixMultiply(rlGetMatrixModelview(), rlGetMatrixProjection()));
+}
+
+} // namespace project
@@ -1,4 +1,5 @@
 #include <project/geometric_scene.hpp>
+#include <project/asset_cache.hpp>
 #include <raymath.h>
 #include <cmath>
 #include <numbers>
@@ -27,6 +28,10 @@ void GeometricScene::initialize() {
     isInitialized = true;
 }
 
+size_t GeometricScene::getMemoryEstimate() const {
+    return hasCubeModel ? AssetCache::estimateModelBytes(cubeModel) : 0;
+}
+
 void GeometricScene::cleanup() {
     if (isInitialized) {
         if (hasCubeModel) {
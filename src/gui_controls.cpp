@@ -1,6 +1,12 @@
 #include <project/gui_controls.hpp>
+#include <project/bullet_physics_scene.hpp>
+#include <project/memory_tracker.hpp>
 #include <imgui.h>
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
 
 namespace project {
 
@@ -86,7 +92,7 @@ void GuiControls::renderControlPanel(SceneManager& sceneManager, Camera3D& camer
     ImGui::End();
 }
 
-void GuiControls::renderDebugPanel() {
+void GuiControls::renderDebugPanel(SceneManager& sceneManager) {
     if (!showDebugPanel) {
         return;
     }
@@ -99,6 +105,48 @@ void GuiControls::renderDebugPanel() {
     
     ImGui::Spacing();
     
+    if (auto* physicsScene = dynamic_cast<BulletPhysicsScene*>(sceneManager.getCurrentScene());
+        physicsScene != nullptr && ImGui::CollapsingHeader("Culling", ImGuiTreeNodeFlags_DefaultOpen)) {
+        bool cullingEnabled = physicsScene->isFrustumCullingEnabled();
+        if (ImGui::Checkbox("Frustum Culling", &cullingEnabled)) {
+            physicsScene->setFrustumCullingEnabled(cullingEnabled);
+        }
+        
+        const auto& stats = physicsScene->getCullingStats();
+        const size_t total = stats.drawn + stats.culled;
+        ImGui::Text("Drawn: %zu", stats.drawn);
+        ImGui::Text("Culled: %zu (%.0f%%)", stats.culled,
+                    total > 0 ? 100.0 * static_cast<double>(stats.culled) / static_cast<double>(total) : 0.0);
+        ImGui::Text("Matrix kernel: %s", TransformPool::getKernelName());
+        
+        const auto& staticBatch = physicsScene->getStaticBatch();
+        ImGui::Text("Static batch: %zu entities, %zu meshes in %zu draws",
+                    staticBatch.getEntityCount(), staticBatch.getSourceMeshCount(), staticBatch.getChunkCount());
+        
+        const auto& instancing = physicsScene->getInstancingStats();
+        ImGui::Text("Instanced: %zu instances in %zu draws, %zu state changes",
+                    instancing.instances, instancing.drawCalls, instancing.stateChanges);
+        
+        bool lodEnabled = physicsScene->isLodEnabled();
+        if (ImGui::Checkbox("Level of Detail", &lodEnabled)) {
+            physicsScene->setLodEnabled(lodEnabled);
+        }
+        float lodBias = physicsScene->getLodBias();
+        if (ImGui::SliderFloat("LOD Bias", &lodBias, 0.25F, 4.0F, "%.2f")) {
+            physicsScene->setLodBias(lodBias);
+        }
+    }
+    
+    if (auto* physicsScene = dynamic_cast<BulletPhysicsScene*>(sceneManager.getCurrentScene());
+        physicsScene != nullptr && ImGui::CollapsingHeader("Systems")) {
+        const SystemScheduler& scheduler = physicsScene->getSystemScheduler();
+        ImGui::Text("%zu systems in %zu stages, %zu worker threads",
+                    scheduler.getSystemCount(), scheduler.getStageCount(), physicsScene->getSystemWorkerCount());
+        for (size_t i = 0; i < scheduler.getSystemCount(); ++i) {
+            ImGui::BulletText("Stage %zu: %s", scheduler.getSystemStage(i), scheduler.getSystemName(i).c_str());
+        }
+    }
+    
     if (ImGui::CollapsingHeader("ImGui Metrics")) {
         ImGui::Text("Active Windows: %d", ImGui::GetIO().MetricsRenderWindows);
     }
@@ -123,6 +171,31 @@ void GuiControls::renderSceneInfo(SceneManager& sceneManager) {
         ImGui::Text("No active scene");
     }
     
+    if (ImGui::CollapsingHeader("Residency")) {
+        SceneResidencyPolicy policy = sceneManager.getResidencyPolicy();
+        int maxWarmScenes = static_cast<int>(policy.maxWarmScenes);
+        int budgetMb = static_cast<int>(policy.memoryBudgetBytes / (1024 * 1024));
+        
+        bool changed = ImGui::SliderInt("Warm Scenes", &maxWarmScenes, 0, 4);
+        changed |= ImGui::Checkbox("Preload Next", &policy.preloadNext);
+        changed |= ImGui::InputInt("Budget (MB, 0 = none)", &budgetMb);
+        if (changed) {
+            policy.maxWarmScenes = static_cast<size_t>(std::max(maxWarmScenes, 0));
+            policy.memoryBudgetBytes = static_cast<size_t>(std::max(budgetMb, 0)) * 1024 * 1024;
+            sceneManager.setResidencyPolicy(policy);
+        }
+        
+        constexpr const char* kResidencyNames[] = {"Cold", "Warm", "Active"};
+        for (size_t i = 0; i < sceneManager.getSceneCount(); ++i) {
+            const SceneStrategy* scene = sceneManager.getScene(i);
+            const auto state = static_cast<size_t>(sceneManager.getSceneResidency(i));
+            ImGui::Text("%zu. %s: %s (%.1f MB)", i + 1, scene->getName(), kResidencyNames[state],
+                        static_cast<double>(scene->getMemoryEstimate()) / (1024.0 * 1024.0));
+        }
+        ImGui::Text("Resident: %.1f MB",
+                    static_cast<double>(sceneManager.getResidentMemoryEstimate()) / (1024.0 * 1024.0));
+    }
+    
     ImGui::Spacing();
     
     if (ImGui::Button("Show ImGui Demo")) {
@@ -132,6 +205,333 @@ void GuiControls::renderSceneInfo(SceneManager& sceneManager) {
     ImGui::End();
 }
 
+void GuiControls::renderPhysicsPanel(SceneManager& sceneManager) {
+    if (!showPhysicsPanel) {
+        return;
+    }
+    
+    auto* physicsScene = dynamic_cast<BulletPhysicsScene*>(sceneManager.getCurrentScene());
+    if (physicsScene == nullptr) {
+        return;
+    }
+    
+    ImGui::Begin("Physics", &showPhysicsPanel);
+    
+    if (ImGui::CollapsingHeader("Fixed Timestep", ImGuiTreeNodeFlags_DefaultOpen)) {
+        auto& config = physicsScene->getStepConfig();
+        ImGui::SliderFloat("Step Rate (Hz)", &config.stepRate, 10.0F, 240.0F, "%.0f");
+        ImGui::SliderInt("Max Substeps", &config.maxSubSteps, 1, 10);
+        ImGui::SliderFloat("Budget (ms)", &config.maxSimulationBudgetMs, 1.0F, 33.0F, "%.1f");
+        
+        const auto& state = physicsScene->getStepState();
+        ImGui::Spacing();
+        ImGui::Text("Steps last frame: %d", state.stepsLastFrame);
+        ImGui::Text("Interpolation alpha: %.2f", state.interpolationAlpha);
+        ImGui::Text("Dropped time: %.2f ms", state.droppedTimeLastFrame * 1000.0F);
+    }
+    
+    if (ImGui::CollapsingHeader("Threading", ImGuiTreeNodeFlags_DefaultOpen)) {
+        renderPhysicsThreadingControls(*physicsScene);
+        
+        // Steps frame N + 1 on its own thread while frame N is drawn (one frame of latency)
+        bool pipelined = sceneManager.isPipelined();
+        if (ImGui::Checkbox("Pipelined Simulation", &pipelined)) {
+            sceneManager.setPipelined(pipelined);
+        }
+    }
+    
+    if (ImGui::CollapsingHeader("Stress Test")) {
+        ImGui::SliderInt("Boxes", &spawnBoxCount, 1, 20000);
+        if (ImGui::Button("Spawn Boxes")) {
+            physicsScene->spawnBoxes(static_cast<size_t>(std::max(spawnBoxCount, 1)));
+        }
+        ImGui::SameLine();
+        ImGui::Text("%zu bodies", physicsScene->getBodyCount());
+        
+        // Debris pieces are not bodies; only those promoted near the camera are
+        ImGui::SliderInt("Debris", &spawnDebrisCount, 100, 100000);
+        if (ImGui::Button("Crash Debris")) {
+            constexpr float kDebrisSpeed = 8.0F;
+            physicsScene->spawnDebris(static_cast<size_t>(std::max(spawnDebrisCount, 1)), kDebrisSpeed);
+        }
+        ImGui::SameLine();
+        ImGui::Text("%zu pieces", physicsScene->getDebris().getPieceCount());
+        
+        bool promotion = physicsScene->isDebrisPromotionEnabled();
+        if (ImGui::Checkbox("Promote Debris Near Camera", &promotion)) {
+            physicsScene->setDebrisPromotionEnabled(promotion);
+        }
+        ImGui::SameLine();
+        ImGui::Text("%zu promoted", physicsScene->getPromotedDebrisCount());
+    }
+    
+    // Bullet's categories walk every collision object, so expect a cost with many bodies
+    if (ImGui::CollapsingHeader("Debug Draw")) {
+        DebugDrawSettings& debugDraw = physicsScene->getDebugDrawSettings();
+        ImGui::Checkbox("Bounds", &debugDraw.bounds);
+        ImGui::SameLine();
+        ImGui::Checkbox("Markers", &debugDraw.markers);
+        ImGui::Checkbox("Collision Shapes", &debugDraw.collisionShapes);
+        ImGui::SameLine();
+        ImGui::Checkbox("AABBs", &debugDraw.aabbs);
+        ImGui::SameLine();
+        ImGui::Checkbox("Contacts", &debugDraw.contacts);
+        ImGui::Text("%zu lines", physicsScene->getDebugLineCount());
+    }
+    
+    if (ImGui::CollapsingHeader("Snapshot")) {
+        if (ImGui::Button("Save State")) {
+            physicsScene->saveState();
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("Restore State")) {
+            (void)physicsScene->restoreState();
+        }
+        
+        const auto& snapshot = physicsScene->getSavedState();
+        if (snapshot.isEmpty()) {
+            ImGui::TextDisabled("No saved state");
+        } else {
+            ImGui::Text("Saved: %zu bodies, %zu transforms (%zu bytes)",
+                        snapshot.bodies.size(), snapshot.transforms.size(), snapshot.getSerializedSize());
+        }
+    }
+    
+    ImGui::End();
+}
+
+void GuiControls::renderPhysicsThreadingControls(BulletPhysicsScene& physicsScene) {
+    if (!PhysicsThreading::isAvailable()) {
+        ImGui::TextDisabled("Multithreading not compiled in");
+        ImGui::TextDisabled("(configure with Project_ENABLE_BULLET_MULTITHREADING=ON)");
+        return;
+    }
+    
+    // Switching backend rebuilds the Bullet world (and resets the scene)
+    bool multiThreaded = physicsScene.getPhysicsBackend() == PhysicsBackend::MultiThreaded;
+    if (ImGui::Checkbox("Multithreaded World", &multiThreaded)) {
+        physicsScene.setPhysicsBackend(multiThreaded ? PhysicsBackend::MultiThreaded : PhysicsBackend::SingleThreaded);
+    }
+    
+    int schedulerIndex = static_cast<int>(physicsScene.getTaskScheduler());
+    if (ImGui::Combo("Scheduler", &schedulerIndex, kTaskSchedulerNames.data(), static_cast<int>(kTaskSchedulerNames.size()))) {
+        schedulerUnavailable = !physicsScene.setTaskScheduler(static_cast<TaskSchedulerKind>(schedulerIndex));
+    }
+    if (schedulerUnavailable) {
+        ImGui::TextColored(ImVec4(1.0F, 0.4F, 0.4F, 1.0F), "Scheduler not available in this Bullet build");
+    }
+    
+    if (multiThreaded) {
+        // Applied once the drag ends rather than on every value the slider passes through
+        if (!physicsThreadSliderActive) {
+            physicsThreadCount = PhysicsThreading::getThreadCount();
+        }
+        constexpr int kMaxSliderThreads = 64;
+        const int maxThreads = std::min(PhysicsThreading::getMaxThreadCount(), kMaxSliderThreads);
+        ImGui::SliderInt("Threads", &physicsThreadCount, 1, maxThreads);
+        physicsThreadSliderActive = ImGui::IsItemActive();
+        if (ImGui::IsItemDeactivatedAfterEdit()) {
+            PhysicsThreading::setThreadCount(physicsThreadCount);
+        }
+    }
+}
+
+void GuiControls::renderProfilerPanel(const SceneManager& sceneManager) {
+    if (!showProfilerPanel) {
+        return;
+    }
+    
+    ImGui::Begin("Profiler", &showProfilerPanel);
+    
+    if (!Profiler::isCompiledIn()) {
+        ImGui::TextDisabled("Profiler compiled out (build with Project_ENABLE_PROFILER=ON)");
+        ImGui::End();
+        return;
+    }
+    
+    // Only main-thread scopes are recorded; the step shows up as SceneManager::waitForSimulation
+    if (sceneManager.isCurrentScenePipelined()) {
+        ImGui::TextDisabled("Pipelined: simulation-thread scopes are not recorded");
+    }
+    
+    Profiler& profiler = Profiler::instance();
+    const size_t frameCount = profiler.getFrameCount();
+    if (frameCount == 0) {
+        ImGui::Text("No frames recorded yet");
+        ImGui::End();
+        return;
+    }
+    
+    bool paused = profiler.isPaused();
+    if (ImGui::Checkbox("Pause", &paused)) {
+        profiler.setPaused(paused);
+        profilerFrameAge = 0;
+    }
+    if (paused) {
+        ImGui::SameLine();
+        ImGui::SliderInt("Frame", &profilerFrameAge, 0, static_cast<int>(frameCount) - 1, "%d frames ago");
+    } else {
+        profilerFrameAge = 0;
+    }
+    
+    // Rolling frame time history, oldest on the left
+    float maxFrameMs = 0.0F;
+    for (size_t i = 0; i < frameCount; ++i) {
+        const float frameMs = static_cast<float>(profiler.getFrame(frameCount - 1 - i).frameMs);
+        frameTimeHistory[i] = frameMs;
+        maxFrameMs = std::max(maxFrameMs, frameMs);
+    }
+    
+    constexpr float kHistoryHeight = 60.0F;
+    const ProfileFrame& frame = profiler.getFrame(static_cast<size_t>(profilerFrameAge));
+    char overlay[32];
+    std::snprintf(overlay, sizeof(overlay), "%.2f ms", frame.frameMs);
+    ImGui::PlotLines("##FrameTimes", frameTimeHistory.data(), static_cast<int>(frameCount), 0, overlay,
+                     0.0F, std::max(maxFrameMs, 1.0F), ImVec2(-1.0F, kHistoryHeight));
+    
+    // GPU timings lag a few frames behind because queries are read back without waiting
+    if (ImGui::CollapsingHeader("GPU", ImGuiTreeNodeFlags_DefaultOpen)) {
+        if (!profiler.isGpuTimingSupported()) {
+            ImGui::TextDisabled("GPU timer queries not available");
+        }
+        for (const GpuSample& sample : frame.gpuSamples) {
+            ImGui::Text("%s: %.3f ms", sample.name, sample.durationMs);
+        }
+    }
+    
+    if (ImGui::CollapsingHeader("CPU Flame View", ImGuiTreeNodeFlags_DefaultOpen)) {
+        renderFlameView(frame);
+    }
+    
+    ImGui::End();
+}
+
+void GuiControls::renderMemoryPanel() {
+    if (!showMemoryPanel) {
+        return;
+    }
+    
+    ImGui::Begin("Memory", &showMemoryPanel);
+    
+    constexpr double kBytesPerMb = 1024.0 * 1024.0;
+    MemoryTracker& tracker = MemoryTracker::instance();
+    ImGui::Text("Total: %.1f MB", static_cast<double>(tracker.getTotalLiveBytes()) / kBytesPerMb);
+    
+    constexpr int kColumnCount = 5;
+    if (ImGui::BeginTable("MemoryCategories", kColumnCount, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+        ImGui::TableSetupColumn("Category");
+        ImGui::TableSetupColumn("Live (MB)");
+        ImGui::TableSetupColumn("Peak (MB)");
+        ImGui::TableSetupColumn("Allocs/s");
+        ImGui::TableSetupColumn("Budget (MB, 0 = none)");
+        ImGui::TableHeadersRow();
+        
+        const ImVec4 overBudgetColor(1.0F, 0.35F, 0.35F, 1.0F);
+        for (size_t i = 0; i < kMemoryCategoryCount; ++i) {
+            const auto category = static_cast<MemoryCategory>(i);
+            const MemoryCategoryStats& stats = tracker.getStats(category);
+            ImGui::TableNextRow();
+            
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(MemoryTracker::getCategoryName(category));
+            ImGui::TableNextColumn();
+            if (stats.isOverBudget()) {
+                ImGui::TextColored(overBudgetColor, "%.2f", static_cast<double>(stats.liveBytes) / kBytesPerMb);
+            } else {
+                ImGui::Text("%.2f", static_cast<double>(stats.liveBytes) / kBytesPerMb);
+            }
+            ImGui::TableNextColumn();
+            ImGui::Text("%.2f", static_cast<double>(stats.peakBytes) / kBytesPerMb);
+            
+            // Measured categories only know their size, not individual allocations
+            ImGui::TableNextColumn();
+            if (stats.hooked) {
+                ImGui::Text("%.0f", stats.allocationsPerSecond);
+            } else {
+                ImGui::TextDisabled("-");
+            }
+            
+            ImGui::TableNextColumn();
+            ImGui::PushID(static_cast<int>(i));
+            int budgetMb = static_cast<int>(stats.budgetBytes / (1024 * 1024));
+            if (ImGui::InputInt("##Budget", &budgetMb)) {
+                tracker.setBudget(category, static_cast<size_t>(std::max(budgetMb, 0)) * 1024 * 1024);
+            }
+            ImGui::PopID();
+        }
+        ImGui::EndTable();
+    }
+    
+    if (ImGui::Button("Reset Peaks")) {
+        tracker.resetPeaks();
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Write memory.json")) {
+        memoryReportWritten = tracker.writeJsonFile("memory.json");
+    }
+    if (memoryReportWritten) {
+        ImGui::SameLine();
+        ImGui::TextDisabled("Written");
+    }
+    
+    ImGui::End();
+}
+
+void GuiControls::renderFlameView(const ProfileFrame& frame) {
+    if (frame.frameMs <= 0.0) {
+        return;
+    }
+    
+    std::uint16_t maxDepth = 0;
+    for (const ProfileSample& sample : frame.cpuSamples) {
+        maxDepth = std::max(maxDepth, sample.depth);
+    }
+    
+    const float rowHeight = ImGui::GetTextLineHeightWithSpacing();
+    const ImVec2 origin = ImGui::GetCursorScreenPos();
+    const float width = std::max(ImGui::GetContentRegionAvail().x, 1.0F);
+    const float height = rowHeight * static_cast<float>(maxDepth + 1);
+    const float pixelsPerMs = width / static_cast<float>(frame.frameMs);
+    
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+    drawList->PushClipRect(origin, ImVec2(origin.x + width, origin.y + height), true);
+    
+    const ProfileSample* hovered = nullptr;
+    for (const ProfileSample& sample : frame.cpuSamples) {
+        const ImVec2 min(
+            origin.x + static_cast<float>(sample.startMs) * pixelsPerMs,
+            origin.y + rowHeight * static_cast<float>(sample.depth)
+        );
+        const ImVec2 max(
+            std::max(min.x + static_cast<float>(sample.durationMs) * pixelsPerMs, min.x + 1.0F),
+            min.y + rowHeight - 1.0F
+        );
+        
+        // Stable color per scope name
+        const auto nameHash = static_cast<std::uint32_t>(std::hash<const void*>{}(sample.name));
+        const float hue = static_cast<float>(nameHash % 360U) / 360.0F;
+        const ImU32 color = ImGui::ColorConvertFloat4ToU32(ImVec4(0.35F + 0.5F * hue, 0.55F, 0.85F - 0.5F * hue, 1.0F));
+        drawList->AddRectFilled(min, max, color);
+        
+        // Only label blocks wide enough to hold the name
+        if (max.x - min.x > ImGui::CalcTextSize(sample.name).x + 4.0F) {
+            drawList->AddText(ImVec2(min.x + 2.0F, min.y), IM_COL32(0, 0, 0, 255), sample.name);
+        }
+        
+        if (ImGui::IsMouseHoveringRect(min, max)) {
+            hovered = &sample;
+        }
+    }
+    
+    drawList->PopClipRect();
+    ImGui::Dummy(ImVec2(width, height));
+    
+    if (hovered != nullptr) {
+        ImGui::SetTooltip("%s\n%.3f ms (%.1f%% of frame)", hovered->name, hovered->durationMs,
+                          100.0 * hovered->durationMs / frame.frameMs);
+    }
+}
+
 void GuiControls::showDemoWindow() {
     if (showDemo) {
         ImGui::ShowDemoWindow(&showDemo);
@@ -0,0 +1,90 @@
+#include <project/headless_server.hpp>
+#include <project/profiler.hpp>
+#include <project/string_hash.hpp>
+#include <algorithm>
+
+namespace project {
+
+HeadlessServer::HeadlessServer(const HeadlessServerConfig& config, TaskPool& taskPool)
+    : config(config), taskPool(&taskPool) {
+    shards.reserve(config.worldCount);
+    for (size_t i = 0; i < config.worldCount; ++i) {
+        auto shard = std::make_unique<Shard>();
+        shard->world.initialize();
+        shards.push_back(std::move(shard));
+    }
+}
+
+size_t HeadlessServer::addInputs(const InputStream& inputs) {
+    size_t dropped = 0;
+    for (const InputCommand& command : inputs.commands) {
+        if (command.world >= shards.size() || command.step < stepIndex) {
+            ++dropped;
+            continue;
+        }
+        shards[command.world]->inputs.push_back(command);
+    }
+
+    // Stable, so commands of the same step keep their recorded order
+    for (const auto& shard : shards) {
+        const auto pending = shard->inputs.begin() + static_cast<std::ptrdiff_t>(shard->nextInput);
+        std::ranges::stable_sort(pending, shard->inputs.end(), {}, &InputCommand::step);
+    }
+    return dropped;
+}
+
+void HeadlessServer::writeStreamHeader(std::vector<unsigned char>& bytes) const {
+    StateStreamHeader header;
+    header.worldCount = static_cast<std::uint32_t>(shards.size());
+    header.fullState = config.fullState ? 1 : 0;
+    header.stepRate = shards.empty() ? 0.0F : shards.front()->world.getPhysicsWorld().getStepConfig().stepRate;
+    header.frameInterval = config.frameInterval;
+
+    const auto* begin = reinterpret_cast<const unsigned char*>(&header);
+    bytes.insert(bytes.end(), begin, begin + sizeof(header));
+}
+
+void HeadlessServer::step(std::vector<unsigned char>& frames) {
+    PROJECT_PROFILE_SCOPE("HeadlessServer::step");
+
+    const std::uint32_t runningStep = stepIndex;  // Inputs recorded for this step apply now
+    ++stepIndex;
+    const bool writeFrames = config.frameInterval != 0 && stepIndex % config.frameInterval == 0;
+
+    // One world per task: steps are uneven (a world that just spawned boxes is slower), so
+    // let the pool balance them instead of cutting the worlds into equal ranges
+    taskPool->parallelFor(0, shards.size(), 1, [this, runningStep, writeFrames](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            Shard& shard = *shards[i];
+            while (shard.nextInput < shard.inputs.size() && shard.inputs[shard.nextInput].step <= runningStep) {
+                shard.world.apply(shard.inputs[shard.nextInput]);
+                ++shard.nextInput;
+            }
+
+            shard.world.step();
+            if (writeFrames) {
+                shard.frame.clear();
+                shard.world.writeFrame(static_cast<std::uint32_t>(i), config.fullState, shard.frame);
+            }
+        }
+    });
+
+    if (!writeFrames) {
+        return;
+    }
+    for (const auto& shard : shards) {
+        frames.insert(frames.end(), shard->frame.begin(), shard->frame.end());
+    }
+}
+
+std::uint64_t HeadlessServer::getStateHash() const {
+    // Fold the per-world hashes in world order
+    std::uint64_t hash = kFnv1aOffsetBasis;
+    for (const auto& shard : shards) {
+        const std::uint64_t worldHash = shard->world.getStateHash();
+        hash = fnv1a(&worldHash, sizeof(worldHash), hash);
+    }
+    return hash;
+}
+
+} // namespace project
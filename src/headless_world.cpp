@@ -0,0 +1,190 @@
+#include <project/headless_world.hpp>
+#include <project/scene_layout.hpp>
+#include <project/string_hash.hpp>
+#include <btBulletDynamicsCommon.h>
+#include <cstring>
+
+namespace project {
+
+namespace {
+    constexpr std::uint32_t kInputMagic = 0x4E504E49;  // "INPN"
+    constexpr std::uint32_t kInputVersion = 1;
+
+    struct InputHeader {
+        std::uint32_t magic{kInputMagic};
+        std::uint32_t version{kInputVersion};
+        std::uint32_t commandCount{0};
+        std::uint32_t reserved{0};
+    };
+
+    void appendBytes(std::vector<unsigned char>& bytes, const void* data, size_t size) {
+        const auto* begin = static_cast<const unsigned char*>(data);
+        bytes.insert(bytes.end(), begin, begin + size);
+    }
+} // namespace
+
+size_t InputStream::getSerializedSize() const noexcept {
+    return sizeof(InputHeader) + (commands.size() * sizeof(InputCommand));
+}
+
+void InputStream::writeTo(std::vector<unsigned char>& bytes) const {
+    InputHeader header;
+    header.commandCount = static_cast<std::uint32_t>(commands.size());
+
+    bytes.resize(getSerializedSize());
+    std::memcpy(bytes.data(), &header, sizeof(header));
+    if (!commands.empty()) {
+        std::memcpy(bytes.data() + sizeof(header), commands.data(), commands.size() * sizeof(InputCommand));
+    }
+}
+
+bool InputStream::readFrom(std::span<const unsigned char> bytes) {
+    commands.clear();
+
+    InputHeader header;
+    if (bytes.size() < sizeof(header)) {
+        return false;
+    }
+    std::memcpy(&header, bytes.data(), sizeof(header));
+
+    const size_t commandBytes = static_cast<size_t>(header.commandCount) * sizeof(InputCommand);
+    if (header.magic != kInputMagic || header.version != kInputVersion || bytes.size() != sizeof(header) + commandBytes) {
+        return false;
+    }
+
+    commands.resize(header.commandCount);
+    if (commandBytes != 0) {
+        std::memcpy(commands.data(), bytes.data() + sizeof(header), commandBytes);
+    }
+    return true;
+}
+
+HeadlessWorld::HeadlessWorld()
+    : physicsWorld(registry) {
+    // The multithreaded backend schedules its own work and is not bit-for-bit repeatable
+    physicsWorld.setPhysicsBackend(PhysicsBackend::SingleThreaded);
+}
+
+void HeadlessWorld::initialize() {
+    if (physicsWorld.isInitialized()) {
+        return;
+    }
+
+    physicsWorld.initialize();
+    stepIndex = 0;
+
+    ShapeCache& shapeCache = physicsWorld.getShapeCache();
+    constexpr float kBoxHalfExtent = PhysicsSceneLayout::kBoxHalfExtent;
+    boxShape = shapeCache.acquireBox(Vector3{kBoxHalfExtent, kBoxHalfExtent, kBoxHalfExtent});
+    physicsWorld.createBody(Vector3{0.0F, PhysicsSceneLayout::kGroundY, 0.0F},
+                            shapeCache.acquireBox(PhysicsSceneLayout::kGroundHalfExtents), 0.0F);
+}
+
+void HeadlessWorld::shutdown() {
+    physicsWorld.shutdown();
+    registry.clear();
+    boxes.clear();
+    nextBoxLayer = 0;
+    boxShape.reset();
+    stepIndex = 0;
+}
+
+void HeadlessWorld::apply(const InputCommand& command) {
+    if (!physicsWorld.isInitialized()) {
+        return;
+    }
+
+    switch (command.type) {
+        case InputCommandType::SpawnBoxes:
+            spawnBoxes(command.value);
+            break;
+        case InputCommandType::ApplyImpulse: {
+            if (command.value >= boxes.size()) {
+                break;
+            }
+            const auto* physicsBody = registry.try_get<PhysicsBody>(boxes[command.value]);
+            if (physicsBody == nullptr || physicsBody->rigidBody == nullptr) {
+                break;
+            }
+            physicsBody->rigidBody->activate(true);
+            physicsBody->rigidBody->applyCentralImpulse(btVector3(command.vector[0], command.vector[1], command.vector[2]));
+            break;
+        }
+    }
+}
+
+void HeadlessWorld::step() {
+    if (!physicsWorld.isInitialized()) {
+        return;
+    }
+
+    physicsWorld.step();
+    ++stepIndex;
+}
+
+void HeadlessWorld::captureState(std::vector<BodyState>& states) const {
+    states.resize(boxes.size());
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        BodyState& state = states[i];
+        const auto* physicsBody = registry.try_get<PhysicsBody>(boxes[i]);
+        if (physicsBody == nullptr || physicsBody->rigidBody == nullptr) {
+            state = BodyState{};
+            continue;
+        }
+
+        // Bullet's own transform, not the synced Transform: exact for sleeping and moving bodies alike
+        const btTransform& transform = physicsBody->rigidBody->getWorldTransform();
+        const btVector3& origin = transform.getOrigin();
+        const btQuaternion rotation = transform.getRotation();
+        state.position[0] = origin.x();
+        state.position[1] = origin.y();
+        state.position[2] = origin.z();
+        state.rotation[0] = rotation.x();
+        state.rotation[1] = rotation.y();
+        state.rotation[2] = rotation.z();
+        state.rotation[3] = rotation.w();
+    }
+}
+
+std::uint64_t HeadlessWorld::getStateHash() const {
+    captureState(frameStates);
+    const std::uint64_t hash = fnv1a(&stepIndex, sizeof(stepIndex));
+    return fnv1a(frameStates.data(), frameStates.size() * sizeof(BodyState), hash);
+}
+
+void HeadlessWorld::writeFrame(std::uint32_t worldIndex, bool fullState, std::vector<unsigned char>& bytes) const {
+    StateFrameHeader header;
+    header.step = stepIndex;
+    header.world = worldIndex;
+    header.bodyCount = static_cast<std::uint32_t>(boxes.size());
+    header.stateHash = getStateHash();  // Leaves this step's states in frameStates
+
+    appendBytes(bytes, &header, sizeof(header));
+    if (fullState && !frameStates.empty()) {
+        appendBytes(bytes, frameStates.data(), frameStates.size() * sizeof(BodyState));
+    }
+}
+
+void HeadlessWorld::spawnBoxes(size_t count) {
+    if (count == 0) {
+        return;
+    }
+
+    // Each batch starts on a fresh layer: batches of different sizes lay out their rows
+    // differently, so sharing a layer could put boxes inside each other
+    const size_t rowLength = PhysicsSceneLayout::getBoxRowLength(count);
+    const size_t firstIndex = nextBoxLayer * PhysicsSceneLayout::kLayerSize;
+    spawns.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        spawns[i] = BodySpawn{};
+        spawns[i].position = PhysicsSceneLayout::getBoxPosition(firstIndex + i, rowLength);
+        spawns[i].mass = PhysicsSceneLayout::kBoxMass;
+    }
+    nextBoxLayer += PhysicsSceneLayout::getBoxLayerCount(count);
+
+    const ShapeHandle shapes[] = {boxShape};
+    physicsWorld.createBodies(spawns, shapes, spawned);
+    boxes.insert(boxes.end(), spawned.begin(), spawned.end());
+}
+
+} // namespace project
@@ -1,10 +1,44 @@
 #include <project/imgui_manager.hpp>
+#include <project/memory_tracker.hpp>
+#include <project/profiler.hpp>
 #include <imgui.h>
 #include <imgui_impl_opengl3.h>
 #include <raylib.h>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
 
 namespace project {
 
+namespace {
+    // ImGui's free callback gets no size, so every block starts with it; the header keeps
+    // malloc's alignment for the block that follows
+    constexpr size_t kAllocationHeaderSize = alignof(std::max_align_t);
+
+    void* allocateTracked(size_t size, void* userData) {
+        static_cast<void>(userData);
+        auto* block = static_cast<std::byte*>(std::malloc(size + kAllocationHeaderSize));
+        if (block == nullptr) {
+            return nullptr;
+        }
+        std::memcpy(block, &size, sizeof(size));
+        MemoryTracker::recordAllocation(MemoryCategory::ImGui, size);
+        return block + kAllocationHeaderSize;
+    }
+
+    void freeTracked(void* memory, void* userData) {
+        static_cast<void>(userData);
+        if (memory == nullptr) {
+            return;
+        }
+        std::byte* block = static_cast<std::byte*>(memory) - kAllocationHeaderSize;
+        size_t size = 0;
+        std::memcpy(&size, block, sizeof(size));
+        MemoryTracker::recordDeallocation(MemoryCategory::ImGui, size);
+        std::free(block);
+    }
+} // namespace
+
 ImGuiManager::ImGuiManager() = default;
 
 ImGuiManager::~ImGuiManager() {
@@ -18,6 +52,8 @@ void ImGuiManager::initialize() {
     
     // Setup Dear ImGui context
     IMGUI_CHECKVERSION();
+    // Route ImGui's heap through the memory tracker; must be set before the context allocates
+    ImGui::SetAllocatorFunctions(&allocateTracked, &freeTracked);
     ImGui::CreateContext();
     ImGuiIO& io = ImGui::GetIO();
     (void)io;
@@ -33,29 +69,37 @@ void ImGuiManager::initialize() {
     // Note: raylib initializes OpenGL context, so we can use it directly
     ImGui_ImplOpenGL3_Init("#version 330");
     
-    // Setup input
-    setupInput();
+    // Input comes through ImGui's event queue (see ImGuiRaylibPlatform)
+    platform.initialize();
     
     initialized = true;
 }
 
 void ImGuiManager::beginFrame() {
-    if (!initialized) {
+    PROJECT_PROFILE_SCOPE("ImGuiManager::beginFrame");
+    
+    if (!initialized || idle) {
         return;
     }
     
-    // Update input
-    updateInput();
+    // Submit the input that changed since the last frame
+    platform.newFrame();
     
     // Start the ImGui frame
     ImGui_ImplOpenGL3_NewFrame();
     ImGui::NewFrame();
+    frameActive = true;
 }
 
 void ImGuiManager::endFrame() {
-    if (!initialized) {
+    PROJECT_PROFILE_SCOPE("ImGuiManager::endFrame");
+    
+    if (!frameActive) {
         return;
     }
+    frameActive = false;
+    
+    PROJECT_PROFILE_GPU_SCOPE("ImGui pass");
     
     // Render ImGui
     ImGui::Render();
@@ -73,6 +117,7 @@ void ImGuiManager::shutdown() {
         return;
     }
     
+    platform.shutdown();
     ImGui_ImplOpenGL3_Shutdown();
     ImGui::DestroyContext();
     
@@ -80,7 +125,7 @@ void ImGuiManager::shutdown() {
 }
 
 bool ImGuiManager::wantsCaptureMouse() const {
-    if (!initialized) {
+    if (!frameActive) {
         return false;
     }
     ImGuiIO& io = ImGui::GetIO();
@@ -88,92 +133,12 @@ bool ImGuiManager::wantsCaptureMouse() const {
 }
 
 bool ImGuiManager::wantsCaptureKeyboard() const {
-    if (!initialized) {
+    if (!frameActive) {
         return false;
     }
     ImGuiIO& io = ImGui::GetIO();
     return io.WantCaptureKeyboard;
 }
 
-void ImGuiManager::setupInput() {
-    ImGuiIO& io = ImGui::GetIO();
-    
-    // Setup display size
-    io.DisplaySize = ImVec2(
-        static_cast<float>(GetScreenWidth()),
-        static_cast<float>(GetScreenHeight())
-    );
-    
-    // Setup key map
-    io.KeyMap[ImGuiKey_Tab] = KEY_TAB;
-    io.KeyMap[ImGuiKey_LeftArrow] = KEY_LEFT;
-    io.KeyMap[ImGuiKey_RightArrow] = KEY_RIGHT;
-    io.KeyMap[ImGuiKey_UpArrow] = KEY_UP;
-    io.KeyMap[ImGuiKey_DownArrow] = KEY_DOWN;
-    io.KeyMap[ImGuiKey_PageUp] = KEY_PAGE_UP;
-    io.KeyMap[ImGuiKey_PageDown] = KEY_PAGE_DOWN;
-    io.KeyMap[ImGuiKey_Home] = KEY_HOME;
-    io.KeyMap[ImGuiKey_End] = KEY_END;
-    io.KeyMap[ImGuiKey_Insert] = KEY_INSERT;
-    io.KeyMap[ImGuiKey_Delete] = KEY_DELETE;
-    io.KeyMap[ImGuiKey_Backspace] = KEY_BACKSPACE;
-    io.KeyMap[ImGuiKey_Space] = KEY_SPACE;
-    io.KeyMap[ImGuiKey_Enter] = KEY_ENTER;
-    io.KeyMap[ImGuiKey_Escape] = KEY_ESCAPE;
-    io.KeyMap[ImGuiKey_KeypadEnter] = KEY_KP_ENTER;
-    io.KeyMap[ImGuiKey_A] = KEY_A;
-    io.KeyMap[ImGuiKey_C] = KEY_C;
-    io.KeyMap[ImGuiKey_V] = KEY_V;
-    io.KeyMap[ImGuiKey_X] = KEY_X;
-    io.KeyMap[ImGuiKey_Y] = KEY_Y;
-    io.KeyMap[ImGuiKey_Z] = KEY_Z;
-}
-
-void ImGuiManager::updateInput() {
-    ImGuiIO& io = ImGui::GetIO();
-    
-    // Update display size
-    io.DisplaySize = ImVec2(
-        static_cast<float>(GetScreenWidth()),
-        static_cast<float>(GetScreenHeight())
-    );
-    
-    // Update delta time
-    io.DeltaTime = GetFrameTime();
-    if (io.DeltaTime <= 0.0F) {
-        io.DeltaTime = 0.00001F;
-    }
-    
-    // Update mouse position
-    Vector2 mousePos = GetMousePosition();
-    io.MousePos = ImVec2(mousePos.x, mousePos.y);
-    
-    // Update mouse buttons
-    io.MouseDown[0] = IsMouseButtonDown(MOUSE_BUTTON_LEFT);
-    io.MouseDown[1] = IsMouseButtonDown(MOUSE_BUTTON_RIGHT);
-    io.MouseDown[2] = IsMouseButtonDown(MOUSE_BUTTON_MIDDLE);
-    
-    // Update mouse wheel
-    float wheel = GetMouseWheelMove();
-    io.MouseWheel = wheel;
-    
-    // Update keyboard modifiers
-    io.KeyCtrl = IsKeyDown(KEY_LEFT_CONTROL) || IsKeyDown(KEY_RIGHT_CONTROL);
-    io.KeyShift = IsKeyDown(KEY_LEFT_SHIFT) || IsKeyDown(KEY_RIGHT_SHIFT);
-    io.KeyAlt = IsKeyDown(KEY_LEFT_ALT) || IsKeyDown(KEY_RIGHT_ALT);
-    io.KeySuper = IsKeyDown(KEY_LEFT_SUPER) || IsKeyDown(KEY_RIGHT_SUPER);
-    
-    // Update keyboard keys
-    for (int i = 0; i < IM_ARRAYSIZE(io.KeysDown); ++i) {
-        io.KeysDown[i] = IsKeyDown(i);
-    }
-    
-    // Update text input
-    int key = GetCharPressed();
-    if (key > 0) {
-        io.AddInputCharacter(static_cast<unsigned int>(key));
-    }
-}
-
 } // namespace project
 
@@ -0,0 +1,191 @@
+#include <project/imgui_raylib_platform.hpp>
+#include <imgui.h>
+#include <algorithm>
+
+namespace project {
+
+namespace {
+    constexpr float kMinDeltaTime = 0.00001F;  // ImGui asserts on a zero delta
+
+    /// Map a raylib key to the ImGui key (ImGuiKey_None for keys ImGui doesn't know)
+    ImGuiKey toImGuiKey(int key) {
+        if (key >= KEY_A && key <= KEY_Z) {
+            return static_cast<ImGuiKey>(ImGuiKey_A + (key - KEY_A));
+        }
+        if (key >= KEY_ZERO && key <= KEY_NINE) {
+            return static_cast<ImGuiKey>(ImGuiKey_0 + (key - KEY_ZERO));
+        }
+        if (key >= KEY_F1 && key <= KEY_F12) {
+            return static_cast<ImGuiKey>(ImGuiKey_F1 + (key - KEY_F1));
+        }
+        if (key >= KEY_KP_0 && key <= KEY_KP_9) {
+            return static_cast<ImGuiKey>(ImGuiKey_Keypad0 + (key - KEY_KP_0));
+        }
+
+        switch (key) {
+            case KEY_TAB: return ImGuiKey_Tab;
+            case KEY_LEFT: return ImGuiKey_LeftArrow;
+            case KEY_RIGHT: return ImGuiKey_RightArrow;
+            case KEY_UP: return ImGuiKey_UpArrow;
+            case KEY_DOWN: return ImGuiKey_DownArrow;
+            case KEY_PAGE_UP: return ImGuiKey_PageUp;
+            case KEY_PAGE_DOWN: return ImGuiKey_PageDown;
+            case KEY_HOME: return ImGuiKey_Home;
+            case KEY_END: return ImGuiKey_End;
+            case KEY_INSERT: return ImGuiKey_Insert;
+            case KEY_DELETE: return ImGuiKey_Delete;
+            case KEY_BACKSPACE: return ImGuiKey_Backspace;
+            case KEY_SPACE: return ImGuiKey_Space;
+            case KEY_ENTER: return ImGuiKey_Enter;
+            case KEY_ESCAPE: return ImGuiKey_Escape;
+            case KEY_LEFT_CONTROL: return ImGuiKey_LeftCtrl;
+            case KEY_LEFT_SHIFT: return ImGuiKey_LeftShift;
+            case KEY_LEFT_ALT: return ImGuiKey_LeftAlt;
+            case KEY_LEFT_SUPER: return ImGuiKey_LeftSuper;
+            case KEY_RIGHT_CONTROL: return ImGuiKey_RightCtrl;
+            case KEY_RIGHT_SHIFT: return ImGuiKey_RightShift;
+            case KEY_RIGHT_ALT: return ImGuiKey_RightAlt;
+            case KEY_RIGHT_SUPER: return ImGuiKey_RightSuper;
+            case KEY_KB_MENU: return ImGuiKey_Menu;
+            case KEY_APOSTROPHE: return ImGuiKey_Apostrophe;
+            case KEY_COMMA: return ImGuiKey_Comma;
+            case KEY_MINUS: return ImGuiKey_Minus;
+            case KEY_PERIOD: return ImGuiKey_Period;
+            case KEY_SLASH: return ImGuiKey_Slash;
+            case KEY_SEMICOLON: return ImGuiKey_Semicolon;
+            case KEY_EQUAL: return ImGuiKey_Equal;
+            case KEY_LEFT_BRACKET: return ImGuiKey_LeftBracket;
+            case KEY_BACKSLASH: return ImGuiKey_Backslash;
+            case KEY_RIGHT_BRACKET: return ImGuiKey_RightBracket;
+            case KEY_GRAVE: return ImGuiKey_GraveAccent;
+            case KEY_CAPS_LOCK: return ImGuiKey_CapsLock;
+            case KEY_SCROLL_LOCK: return ImGuiKey_ScrollLock;
+            case KEY_NUM_LOCK: return ImGuiKey_NumLock;
+            case KEY_PRINT_SCREEN: return ImGuiKey_PrintScreen;
+            case KEY_PAUSE: return ImGuiKey_Pause;
+            case KEY_KP_DECIMAL: return ImGuiKey_KeypadDecimal;
+            case KEY_KP_DIVIDE: return ImGuiKey_KeypadDivide;
+            case KEY_KP_MULTIPLY: return ImGuiKey_KeypadMultiply;
+            case KEY_KP_SUBTRACT: return ImGuiKey_KeypadSubtract;
+            case KEY_KP_ADD: return ImGuiKey_KeypadAdd;
+            case KEY_KP_ENTER: return ImGuiKey_KeypadEnter;
+            case KEY_KP_EQUAL: return ImGuiKey_KeypadEqual;
+            default: return ImGuiKey_None;
+        }
+    }
+} // namespace
+
+void ImGuiRaylibPlatform::initialize() {
+    if (initialized) {
+        return;
+    }
+
+    ImGuiIO& io = ImGui::GetIO();
+    io.BackendPlatformName = "imgui_impl_raylib (project)";
+    heldKeys.clear();
+    mouseButtonsDown.fill(false);
+    lastMousePosition = Vector2{-1.0F, -1.0F};
+    focused = true;
+    initialized = true;
+}
+
+void ImGuiRaylibPlatform::shutdown() {
+    if (!initialized) {
+        return;
+    }
+
+    releaseHeldKeys();
+    ImGui::GetIO().BackendPlatformName = nullptr;
+    initialized = false;
+}
+
+void ImGuiRaylibPlatform::newFrame() {
+    ImGuiIO& io = ImGui::GetIO();
+    io.DisplaySize = ImVec2(static_cast<float>(GetScreenWidth()), static_cast<float>(GetScreenHeight()));
+    io.DeltaTime = std::max(GetFrameTime(), kMinDeltaTime);
+
+    // Keys held while the window loses focus never report their release
+    if (const bool windowFocused = IsWindowFocused(); windowFocused != focused) {
+        focused = windowFocused;
+        io.AddFocusEvent(focused);
+        if (!focused) {
+            releaseHeldKeys();
+        }
+    }
+
+    // Releases: only the keys ImGui holds need checking
+    const size_t heldBefore = heldKeys.size();
+    std::erase_if(heldKeys, [&io](int key) {
+        if (IsKeyDown(key)) {
+            return false;
+        }
+        io.AddKeyEvent(toImGuiKey(key), false);
+        return true;
+    });
+    bool modifiersChanged = heldKeys.size() != heldBefore;
+
+    // Presses: raylib queues every key pressed since the last frame
+    for (int key = GetKeyPressed(); key != 0; key = GetKeyPressed()) {
+        const ImGuiKey imguiKey = toImGuiKey(key);
+        if (imguiKey == ImGuiKey_None || std::ranges::find(heldKeys, key) != heldKeys.end()) {
+            continue;
+        }
+        io.AddKeyEvent(imguiKey, true);
+        heldKeys.push_back(key);
+        modifiersChanged = true;
+    }
+    if (modifiersChanged) {
+        updateModifiers();
+    }
+
+    // The whole character queue, so fast typing doesn't drop characters
+    for (int character = GetCharPressed(); character > 0; character = GetCharPressed()) {
+        io.AddInputCharacter(static_cast<unsigned int>(character));
+    }
+
+    const Vector2 mousePosition = GetMousePosition();
+    if (mousePosition.x != lastMousePosition.x || mousePosition.y != lastMousePosition.y) {
+        io.AddMousePosEvent(mousePosition.x, mousePosition.y);
+        lastMousePosition = mousePosition;
+    }
+
+    // raylib and ImGui number the buttons alike (left, right, middle, side, extra)
+    for (size_t button = 0; button < kMouseButtonCount; ++button) {
+        const bool down = IsMouseButtonDown(static_cast<int>(button));
+        if (down != mouseButtonsDown[button]) {
+            io.AddMouseButtonEvent(static_cast<int>(button), down);
+            mouseButtonsDown[button] = down;
+        }
+    }
+
+    if (const Vector2 wheel = GetMouseWheelMoveV(); wheel.x != 0.0F || wheel.y != 0.0F) {
+        io.AddMouseWheelEvent(wheel.x, wheel.y);
+    }
+}
+
+void ImGuiRaylibPlatform::releaseHeldKeys() {
+    if (heldKeys.empty()) {
+        return;
+    }
+
+    ImGuiIO& io = ImGui::GetIO();
+    for (const int key : heldKeys) {
+        io.AddKeyEvent(toImGuiKey(key), false);
+    }
+    heldKeys.clear();
+    updateModifiers();
+}
+
+void ImGuiRaylibPlatform::updateModifiers() const {
+    const auto held = [this](int left, int right) {
+        return std::ranges::find(heldKeys, left) != heldKeys.end() || std::ranges::find(heldKeys, right) != heldKeys.end();
+    };
+
+    ImGuiIO& io = ImGui::GetIO();
+    io.AddKeyEvent(ImGuiMod_Ctrl, held(KEY_LEFT_CONTROL, KEY_RIGHT_CONTROL));
+    io.AddKeyEvent(ImGuiMod_Shift, held(KEY_LEFT_SHIFT, KEY_RIGHT_SHIFT));
+    io.AddKeyEvent(ImGuiMod_Alt, held(KEY_LEFT_ALT, KEY_RIGHT_ALT));
+    io.AddKeyEvent(ImGuiMod_Super, held(KEY_LEFT_SUPER, KEY_RIGHT_SUPER));
+}
+
+} // namespace project
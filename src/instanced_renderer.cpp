@@ -0,0 +1,218 @@
+#include <project/instanced_renderer.hpp>
+#include <raymath.h>
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <tuple>
+
+namespace project {
+
+namespace {
+    // Same inputs/uniforms as raylib's default shader, plus a per-instance model matrix
+    constexpr const char* kInstancingVertexShader = R"(#version 330
+in vec3 vertexPosition;
+in vec2 vertexTexCoord;
+in vec4 vertexColor;
+in mat4 instanceTransform;
+
+uniform mat4 mvp;
+
+out vec2 fragTexCoord;
+out vec4 fragColor;
+
+void main()
+{
+    fragTexCoord = vertexTexCoord;
+    fragColor = vertexColor;
+    gl_Position = mvp * instanceTransform * vec4(vertexPosition, 1.0);
+}
+)";
+
+    constexpr const char* kInstancingFragmentShader = R"(#version 330
+in vec2 fragTexCoord;
+in vec4 fragColor;
+
+uniform sampler2D texture0;
+uniform vec4 colDiffuse;
+uniform float alphaCutoff;
+
+out vec4 finalColor;
+
+void main()
+{
+    // Only the texture is alpha-tested, so translucent tints still blend
+    vec4 texel = texture(texture0, fragTexCoord);
+    if (texel.a < alphaCutoff) discard;
+
+    finalColor = texel * colDiffuse * fragColor;
+}
+)";
+
+    /// Batches smaller than this are drawn with DrawMesh; the instanced path re-uploads
+    /// a transform buffer per call, which only pays off for several instances
+    constexpr size_t kMinInstancesForInstancing = 2;
+
+    /// Alpha-tested materials always use the instancing shader: DrawMesh would bind the
+    /// default shader, which draws (and writes depth for) the texels meant to be cut out
+    bool drawsInstanced(const Material& material, size_t count) {
+        return count >= kMinInstancesForInstancing || material.params[kMaterialAlphaCutoffParam] > 0.0F;
+    }
+
+    bool isIdentity(const Matrix& matrix) {
+        const Matrix identity = MatrixIdentity();
+        return std::memcmp(&matrix, &identity, sizeof(Matrix)) == 0;
+    }
+
+    Color multiplyColors(Color lhs, Color rhs) {
+        constexpr int kChannelMax = 255;
+        return Color{
+            static_cast<unsigned char>((lhs.r * rhs.r) / kChannelMax),
+            static_cast<unsigned char>((lhs.g * rhs.g) / kChannelMax),
+            static_cast<unsigned char>((lhs.b * rhs.b) / kChannelMax),
+            static_cast<unsigned char>((lhs.a * rhs.a) / kChannelMax)
+        };
+    }
+} // namespace
+
+InstancedRenderer::~InstancedRenderer() {
+    shutdown();
+}
+
+void InstancedRenderer::initialize() {
+    if (instancingSupported) {
+        return;
+    }
+    
+    instancingShader = LoadShaderFromMemory(kInstancingVertexShader, kInstancingFragmentShader);
+    if (!IsShaderValid(instancingShader)) {
+        std::cerr << "InstancedRenderer: instancing shader unavailable, using per-entity draws\n";
+        instancingShader = Shader{};
+        return;
+    }
+    
+    // DrawMeshInstanced binds the instance matrices to the model-matrix location
+    instancingShader.locs[SHADER_LOC_MATRIX_MODEL] = GetShaderLocationAttrib(instancingShader, "instanceTransform");
+    alphaCutoffLocation = GetShaderLocation(instancingShader, "alphaCutoff");
+    appliedAlphaCutoff = -1.0F;
+    instancingSupported = true;
+}
+
+void InstancedRenderer::shutdown() {
+    if (instancingSupported) {
+        UnloadShader(instancingShader);
+        instancingShader = Shader{};
+        instancingSupported = false;
+    }
+    batches.clear();
+    transformPool.clear();
+}
+
+void InstancedRenderer::begin() {
+    for (auto& [key, batch] : batches) {
+        batch.transforms.clear();
+    }
+    drawCallCount = 0;
+    instanceCount = 0;
+    stateChangeCount = 0;
+}
+
+void InstancedRenderer::submit(const Model& model, const Matrix& transform, Color tint) {
+    // Same composition as DrawModelEx: the model's own transform, then the instance transform
+    // Generated meshes (and most glTF roots) have an identity transform, so skip the product then
+    const Matrix worldMatrix = isIdentity(model.transform) ? transform : MatrixMultiply(model.transform, transform);
+    const auto packedTint = static_cast<std::uint32_t>(ColorToInt(tint));
+    
+    for (int i = 0; i < model.meshCount; ++i) {
+        const BatchKey key{
+            &model.meshes[i],
+            &model.materials[model.meshMaterial[i]],
+            packedTint
+        };
+        batches[key].transforms.push_back(worldMatrix);
+    }
+}
+
+void InstancedRenderer::submitInstances(const Model& model, std::span<const Matrix> transforms, Color tint) {
+    const bool identity = isIdentity(model.transform);
+    const auto packedTint = static_cast<std::uint32_t>(ColorToInt(tint));
+    
+    for (int i = 0; i < model.meshCount; ++i) {
+        const BatchKey key{
+            &model.meshes[i],
+            &model.materials[model.meshMaterial[i]],
+            packedTint
+        };
+        std::vector<Matrix>& batchTransforms = batches[key].transforms;
+        if (identity) {
+            batchTransforms.insert(batchTransforms.end(), transforms.begin(), transforms.end());
+            continue;
+        }
+        batchTransforms.reserve(batchTransforms.size() + transforms.size());
+        for (const Matrix& transform : transforms) {
+            batchTransforms.push_back(MatrixMultiply(model.transform, transform));
+        }
+    }
+}
+
+void InstancedRenderer::flush() {
+    drawOrder.clear();
+    for (const auto& entry : batches) {
+        if (!entry.second.transforms.empty()) {
+            drawOrder.push_back(&entry);
+        }
+    }
+    
+    // Group by the state each draw binds: instancing shader or the material's, then texture
+    const auto drawState = [this](const std::pair<const BatchKey, Batch>* entry) {
+        const Material& material = *entry->first.material;
+        const bool instanced = drawsInstanced(material, entry->second.transforms.size());
+        return std::tuple(instanced ? instancingShader.id : material.shader.id, material.maps[MATERIAL_MAP_ALBEDO].texture.id);
+    };
+    std::ranges::sort(drawOrder, [&drawState](const auto* lhs, const auto* rhs) {
+        return std::tuple_cat(drawState(lhs), std::tuple(lhs->first.mesh)) < std::tuple_cat(drawState(rhs), std::tuple(rhs->first.mesh));
+    });
+    
+    for (size_t i = 0; i < drawOrder.size(); ++i) {
+        if (i > 0 && drawState(drawOrder[i]) != drawState(drawOrder[i - 1])) {
+            ++stateChangeCount;
+        }
+        drawBatch(drawOrder[i]->first, drawOrder[i]->second);
+    }
+}
+
+void InstancedRenderer::drawBatch(const BatchKey& key, const Batch& batch) {
+    // Material maps are shared with the model, so tint in place and restore afterwards
+    Material material = *key.material;
+    MaterialMap& diffuseMap = material.maps[MATERIAL_MAP_DIFFUSE];
+    const Color originalColor = diffuseMap.color;
+    diffuseMap.color = multiplyColors(originalColor, GetColor(static_cast<unsigned int>(key.tint)));
+    
+    const size_t count = batch.transforms.size();
+    if (!drawsInstanced(*key.material, count)) {
+        DrawMesh(*key.mesh, material, batch.transforms.front());
+    } else {
+        // Most materials leave the cutoff at 0 and draw every texel
+        const float alphaCutoff = key.material->params[kMaterialAlphaCutoffParam];
+        if (alphaCutoff != appliedAlphaCutoff && alphaCutoffLocation >= 0) {
+            SetShaderValue(instancingShader, alphaCutoffLocation, &alphaCutoff, SHADER_UNIFORM_FLOAT);
+            appliedAlphaCutoff = alphaCutoff;
+        }
+        material.shader = instancingShader;
+        DrawMeshInstanced(*key.mesh, material, batch.transforms.data(), static_cast<int>(count));
+    }
+    
+    diffuseMap.color = originalColor;
+    
+    ++drawCallCount;
+    instanceCount += count;
+}
+
+size_t InstancedRenderer::BatchKeyHash::operator()(const BatchKey& key) const noexcept {
+    const size_t meshHash = std::hash<const Mesh*>{}(key.mesh);
+    const size_t materialHash = std::hash<const Material*>{}(key.material);
+    const size_t tintHash = std::hash<std::uint32_t>{}(key.tint);
+    return meshHash ^ (materialHash << 1U) ^ (tintHash << 2U);
+}
+
+} // namespace project
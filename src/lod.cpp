@@ -0,0 +1,401 @@
+#include <project/lod.hpp>
+#include <project/instanced_renderer.hpp>
+#include <raymath.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <unordered_map>
+
+// rlgl is compiled into raylib, but its header is not shipped with the prebuilt library
+extern "C" Matrix rlGetMatrixModelview();
+extern "C" Matrix rlGetMatrixProjection();
+
+namespace project {
+
+namespace {
+    // Texture coordinates are snapped to this grid before clustering; Kenney models sample
+    // a flat-color palette, so vertices only merge when they pick the same swatch
+    constexpr float kTexCoordQuantization = 64.0F;
+
+    // raylib draws meshes with 16-bit indices
+    constexpr size_t kMaxVerticesPerMesh = std::numeric_limits<unsigned short>::max();
+
+    // Impostor views are rendered this far outside the bounding sphere
+    constexpr float kImpostorCameraMargin = 1.0F;
+
+    // Instanced impostors discard texels below this alpha (the background around the views)
+    constexpr float kImpostorAlphaCutoff = 0.5F;
+
+    struct ClusterKey {
+        int x;
+        int y;
+        int z;
+        int u;
+        int v;
+
+        bool operator==(const ClusterKey&) const = default;
+    };
+
+    struct ClusterKeyHash {
+        size_t operator()(const ClusterKey& key) const noexcept {
+            size_t hash = std::hash<int>{}(key.x);
+            for (const int value : {key.y, key.z, key.u, key.v}) {
+                hash ^= std::hash<int>{}(value) + 0x9E3779B9U + (hash << 6U) + (hash >> 2U);
+            }
+            return hash;
+        }
+    };
+
+    template <typename T>
+    T* allocateArray(size_t count) {
+        return static_cast<T*>(MemAlloc(static_cast<unsigned int>(count * sizeof(T))));
+    }
+
+    /// Merge the vertices of a mesh that fall into the same grid cell and use the same
+    /// texel, keeping the first one of each cell, and drop triangles that collapse
+    /// @param cellSize Edge length of a grid cell in model space
+    /// @param simplified Receives the CPU arrays of the simplified mesh (not uploaded)
+    /// @return False if the mesh has no CPU vertices, collapses entirely or grows too large
+    bool clusterMesh(const Mesh& mesh, float cellSize, Mesh& simplified) {
+        if (mesh.vertices == nullptr || mesh.vertexCount <= 0) {
+            return false;
+        }
+
+        const size_t indexCount = static_cast<size_t>(mesh.triangleCount) * 3;
+        const auto sourceIndex = [&mesh](size_t corner) -> size_t {
+            return (mesh.indices != nullptr) ? mesh.indices[corner] : corner;
+        };
+
+        std::unordered_map<ClusterKey, unsigned short, ClusterKeyHash> clusters;
+        std::vector<size_t> representatives;  // Source vertex of each cluster
+        std::vector<unsigned short> remap(static_cast<size_t>(mesh.vertexCount));
+        clusters.reserve(static_cast<size_t>(mesh.vertexCount));
+
+        const float inverseCell = 1.0F / cellSize;
+        for (size_t vertex = 0; vertex < static_cast<size_t>(mesh.vertexCount); ++vertex) {
+            const float* position = mesh.vertices + (vertex * 3);
+            ClusterKey key{
+                static_cast<int>(std::floor(position[0] * inverseCell)),
+                static_cast<int>(std::floor(position[1] * inverseCell)),
+                static_cast<int>(std::floor(position[2] * inverseCell)),
+                0,
+                0
+            };
+            if (mesh.texcoords != nullptr) {
+                key.u = static_cast<int>(std::floor(mesh.texcoords[vertex * 2] * kTexCoordQuantization));
+                key.v = static_cast<int>(std::floor(mesh.texcoords[(vertex * 2) + 1] * kTexCoordQuantization));
+            }
+
+            const auto [clusterIt, inserted] = clusters.try_emplace(key, static_cast<unsigned short>(representatives.size()));
+            if (inserted) {
+                if (representatives.size() >= kMaxVerticesPerMesh) {
+                    return false;
+                }
+                representatives.push_back(vertex);
+            }
+            remap[vertex] = clusterIt->second;
+        }
+
+        std::vector<unsigned short> indices;
+        indices.reserve(indexCount);
+        for (size_t corner = 0; corner + 2 < indexCount; corner += 3) {
+            const unsigned short a = remap[sourceIndex(corner)];
+            const unsigned short b = remap[sourceIndex(corner + 1)];
+            const unsigned short c = remap[sourceIndex(corner + 2)];
+            if (a != b && b != c && a != c) {
+                indices.insert(indices.end(), {a, b, c});
+            }
+        }
+        if (indices.empty()) {
+            return false;
+        }
+
+        const size_t vertexCount = representatives.size();
+        simplified = Mesh{};
+        simplified.vertexCount = static_cast<int>(vertexCount);
+        simplified.triangleCount = static_cast<int>(indices.size() / 3);
+        simplified.vertices = allocateArray<float>(vertexCount * 3);
+        simplified.indices = allocateArray<unsigned short>(indices.size());
+        std::memcpy(simplified.indices, indices.data(), indices.size() * sizeof(unsigned short));
+        if (mesh.normals != nullptr) {
+            simplified.normals = allocateArray<float>(vertexCount * 3);
+        }
+        if (mesh.texcoords != nullptr) {
+            simplified.texcoords = allocateArray<float>(vertexCount * 2);
+        }
+        if (mesh.colors != nullptr) {
+            simplified.colors = allocateArray<unsigned char>(vertexCount * 4);
+        }
+
+        for (size_t cluster = 0; cluster < vertexCount; ++cluster) {
+            const size_t source = representatives[cluster];
+            std::memcpy(simplified.vertices + (cluster * 3), mesh.vertices + (source * 3), 3 * sizeof(float));
+            if (simplified.normals != nullptr) {
+                std::memcpy(simplified.normals + (cluster * 3), mesh.normals + (source * 3), 3 * sizeof(float));
+            }
+            if (simplified.texcoords != nullptr) {
+                std::memcpy(simplified.texcoords + (cluster * 2), mesh.texcoords + (source * 2), 2 * sizeof(float));
+            }
+            if (simplified.colors != nullptr) {
+                std::memcpy(simplified.colors + (cluster * 4), mesh.colors + (source * 4), 4);
+            }
+        }
+        return true;
+    }
+
+    /// Build a simplified copy of every mesh of a model, sharing its materials
+    /// @return The level, or nullptr if it would not drop any vertices or loses a whole mesh
+    ModelHandle buildSimplifiedLevel(const ModelHandle& source, float cellSize) {
+        const Model& model = *source;
+        std::vector<Mesh> meshes(static_cast<size_t>(model.meshCount));
+
+        const auto releaseMeshes = [&meshes](size_t count) {
+            for (size_t i = 0; i < count; ++i) {
+                UnloadMesh(meshes[i]);
+            }
+        };
+
+        int sourceVertices = 0;
+        int simplifiedVertices = 0;
+        for (size_t i = 0; i < meshes.size(); ++i) {
+            if (!clusterMesh(model.meshes[i], cellSize, meshes[i])) {
+                releaseMeshes(i);
+                return nullptr;
+            }
+            sourceVertices += model.meshes[i].vertexCount;
+            simplifiedVertices += meshes[i].vertexCount;
+        }
+        if (simplifiedVertices >= sourceVertices) {
+            releaseMeshes(meshes.size());
+            return nullptr;
+        }
+
+        Model level{};
+        level.transform = model.transform;
+        level.meshCount = model.meshCount;
+        level.meshes = allocateArray<Mesh>(meshes.size());
+        level.meshMaterial = allocateArray<int>(meshes.size());
+        for (size_t i = 0; i < meshes.size(); ++i) {
+            UploadMesh(&meshes[i], false);
+            level.meshes[i] = meshes[i];
+            level.meshMaterial[i] = (model.meshMaterial != nullptr) ? model.meshMaterial[i] : 0;
+        }
+        level.materialCount = model.materialCount;
+        level.materials = model.materials;
+
+        // Materials belong to the source model, which the deleter keeps alive
+        return ModelHandle(new Model(level), [source](const Model* cached) {
+            for (int i = 0; i < cached->meshCount; ++i) {
+                UnloadMesh(cached->meshes[i]);
+            }
+            MemFree(cached->meshes);
+            MemFree(cached->meshMaterial);
+            delete cached;
+        });
+    }
+
+    /// Render one orthographic view of a model, centered on its bounding sphere
+    Image captureView(const Model& model, Vector3 center, float radius, Vector3 direction, int resolution) {
+        RenderTexture2D target = LoadRenderTexture(resolution, resolution);
+
+        Camera3D camera{};
+        camera.position = Vector3Add(center, Vector3Scale(direction, radius + kImpostorCameraMargin));
+        camera.target = center;
+        camera.up = Vector3{0.0F, 1.0F, 0.0F};
+        camera.fovy = radius * 2.0F;  // View height for orthographic cameras
+        camera.projection = CAMERA_ORTHOGRAPHIC;
+
+        BeginTextureMode(target);
+        ClearBackground(BLANK);
+        BeginMode3D(camera);
+        DrawModel(model, Vector3{0.0F, 0.0F, 0.0F}, 1.0F, WHITE);
+        EndMode3D();
+        EndTextureMode();
+
+        // Render textures are stored bottom-up
+        Image view = LoadImageFromTexture(target.texture);
+        ImageFlipVertical(&view);
+        UnloadRenderTexture(target);
+        return view;
+    }
+
+    /// Build the impostor level: two crossed, double-sided quads through the bounding sphere,
+    /// textured with a front (+Z) and side (+X) view of the model
+    ModelHandle buildImpostorLevel(const Model& model, Vector3 center, float radius, int resolution) {
+        const Image front = captureView(model, center, radius, Vector3{0.0F, 0.0F, 1.0F}, resolution);
+        const Image side = captureView(model, center, radius, Vector3{1.0F, 0.0F, 0.0F}, resolution);
+
+        Image atlas = GenImageColor(resolution * 2, resolution, BLANK);
+        const auto size = static_cast<float>(resolution);
+        ImageDraw(&atlas, front, Rectangle{0.0F, 0.0F, size, size}, Rectangle{0.0F, 0.0F, size, size}, WHITE);
+        ImageDraw(&atlas, side, Rectangle{0.0F, 0.0F, size, size}, Rectangle{size, 0.0F, size, size}, WHITE);
+        const Texture2D texture = LoadTextureFromImage(atlas);
+        UnloadImage(front);
+        UnloadImage(side);
+        UnloadImage(atlas);
+
+        // Corners of each quad (top-left, top-right, bottom-right, bottom-left as seen by its
+        // capture camera) and the atlas half it samples
+        const float left = center.x - radius;
+        const float right = center.x + radius;
+        const float top = center.y + radius;
+        const float bottom = center.y - radius;
+        const float nearZ = center.z + radius;
+        const float farZ = center.z - radius;
+        struct Quad {
+            Vector3 corners[4];
+            Vector3 normal;
+            float u0;
+            float u1;
+        };
+        const Quad quads[] = {
+            {{{left, top, center.z}, {right, top, center.z}, {right, bottom, center.z}, {left, bottom, center.z}}, {0.0F, 0.0F, 1.0F}, 0.0F, 0.5F},
+            {{{center.x, top, nearZ}, {center.x, top, farZ}, {center.x, bottom, farZ}, {center.x, bottom, nearZ}}, {1.0F, 0.0F, 0.0F}, 0.5F, 1.0F},
+        };
+
+        constexpr size_t kVerticesPerQuad = 4;
+        constexpr size_t kSidesPerQuad = 2;
+        const size_t vertexCount = std::size(quads) * kSidesPerQuad * kVerticesPerQuad;
+
+        Mesh mesh{};
+        mesh.vertexCount = static_cast<int>(vertexCount);
+        mesh.triangleCount = static_cast<int>(vertexCount / 2);
+        mesh.vertices = allocateArray<float>(vertexCount * 3);
+        mesh.normals = allocateArray<float>(vertexCount * 3);
+        mesh.texcoords = allocateArray<float>(vertexCount * 2);
+        mesh.indices = allocateArray<unsigned short>(static_cast<size_t>(mesh.triangleCount) * 3);
+
+        size_t vertex = 0;
+        size_t index = 0;
+        for (const Quad& quad : quads) {
+            const float texcoords[4][2] = {{quad.u0, 0.0F}, {quad.u1, 0.0F}, {quad.u1, 1.0F}, {quad.u0, 1.0F}};
+            for (size_t sideIndex = 0; sideIndex < kSidesPerQuad; ++sideIndex) {
+                const float facing = (sideIndex == 0) ? 1.0F : -1.0F;
+                const auto first = static_cast<unsigned short>(vertex);
+                for (size_t corner = 0; corner < kVerticesPerQuad; ++corner) {
+                    std::memcpy(mesh.vertices + (vertex * 3), &quad.corners[corner], 3 * sizeof(float));
+                    mesh.normals[(vertex * 3)] = quad.normal.x * facing;
+                    mesh.normals[(vertex * 3) + 1] = quad.normal.y * facing;
+                    mesh.normals[(vertex * 3) + 2] = quad.normal.z * facing;
+                    mesh.texcoords[vertex * 2] = texcoords[corner][0];
+                    mesh.texcoords[(vertex * 2) + 1] = texcoords[corner][1];
+                    ++vertex;
+                }
+
+                // Counter-clockwise towards the capture camera, reversed for the back face
+                constexpr std::array<unsigned short, 6> kFrontFace{0, 3, 2, 0, 2, 1};
+                constexpr std::array<unsigned short, 6> kBackFace{0, 1, 2, 0, 2, 3};
+                for (const unsigned short offset : (sideIndex == 0) ? kFrontFace : kBackFace) {
+                    mesh.indices[index++] = static_cast<unsigned short>(first + offset);
+                }
+            }
+        }
+        UploadMesh(&mesh, false);
+
+        Model impostor{};
+        impostor.transform = MatrixIdentity();
+        impostor.meshCount = 1;
+        impostor.meshes = allocateArray<Mesh>(1);
+        impostor.meshes[0] = mesh;
+        impostor.materialCount = 1;
+        impostor.materials = allocateArray<Material>(1);
+        impostor.materials[0] = LoadMaterialDefault();
+        impostor.materials[0].maps[MATERIAL_MAP_ALBEDO].texture = texture;
+        impostor.materials[0].params[kMaterialAlphaCutoffParam] = kImpostorAlphaCutoff;
+        impostor.meshMaterial = allocateArray<int>(1);
+        impostor.meshMaterial[0] = 0;
+
+        return ModelHandle(new Model(impostor), [](const Model* cached) {
+            UnloadMesh(cached->meshes[0]);
+            UnloadTexture(cached->materials[0].maps[MATERIAL_MAP_ALBEDO].texture);
+            MemFree(cached->materials[0].maps);
+            MemFree(cached->materials);
+            MemFree(cached->meshes);
+            MemFree(cached->meshMaterial);
+            delete cached;
+        });
+    }
+} // namespace
+
+size_t LodModel::selectLevel(float screenSize, size_t currentLevel) const noexcept {
+    const size_t lastLevel = levels.empty() ? 0 : levels.size() - 1;
+    size_t level = std::min(currentLevel, lastLevel);
+
+    // Coarser once clearly below the threshold to the next level, finer once clearly above
+    // the threshold to the current one
+    while (level < lastLevel && level < screenSizes.size() && screenSize < screenSizes[level] * (1.0F - kHysteresis)) {
+        ++level;
+    }
+    while (level > 0 && screenSize > screenSizes[level - 1] * (1.0F + kHysteresis)) {
+        --level;
+    }
+    return level;
+}
+
+LodView LodView::fromCurrentCamera() {
+    // The camera sits at the translation of the inverse view matrix
+    const Matrix inverseView = MatrixInvert(rlGetMatrixModelview());
+    const Matrix projection = rlGetMatrixProjection();
+
+    LodView view;
+    view.cameraPosition = Vector3{inverseView.m12, inverseView.m13, inverseView.m14};
+    view.projectionScale = projection.m5;
+    return view;
+}
+
+float LodView::getScreenSize(const Vector3& center, float radius) const noexcept {
+    const float distance = Vector3Distance(cameraPosition, center);
+    if (distance <= radius) {
+        return std::numeric_limits<float>::max();
+    }
+    // Projected diameter over the viewport height (2 in normalized device coordinates)
+    return (radius * projectionScale * bias) / distance;
+}
+
+LodHandle buildLodModel(
+    const ModelHandle& model,
+    const BoundingBox& bounds,
+    const LodSettings& settings
+) {
+    auto lod = std::make_shared<LodModel>();
+    lod->levels.push_back(model);
+    lod->center = Vector3Scale(Vector3Add(bounds.min, bounds.max), 0.5F);
+    lod->radius = Vector3Length(Vector3Subtract(bounds.max, bounds.min)) * 0.5F;
+    if (model == nullptr || lod->radius <= 0.0F) {
+        return lod;
+    }
+
+    const Vector3 size = Vector3Subtract(bounds.max, bounds.min);
+    const float longestAxis = std::max({size.x, size.y, size.z});
+    for (const int resolution : settings.simplifyResolutions) {
+        if (resolution <= 0) {
+            continue;
+        }
+        if (ModelHandle level = buildSimplifiedLevel(model, longestAxis / static_cast<float>(resolution)); level != nullptr) {
+            lod->levels.push_back(std::move(level));
+        }
+    }
+
+    if (settings.impostor && settings.impostorResolution > 0) {
+        lod->levels.push_back(buildImpostorLevel(*model, lod->center, lod->radius, settings.impostorResolution));
+        lod->hasImpostor = true;
+    }
+
+    // One threshold per transition; missing ones reuse the last (or never switch)
+    const size_t transitions = lod->levels.size() - 1;
+    for (size_t i = 0; i < transitions; ++i) {
+        if (i < settings.screenSizes.size()) {
+            lod->screenSizes.push_back(settings.screenSizes[i]);
+        } else {
+            lod->screenSizes.push_back(settings.screenSizes.empty() ? 0.0F : settings.screenSizes.back() * 0.5F);
+        }
+    }
+    return lod;
+}
+
+} // namespace project
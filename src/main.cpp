@@ -1,11 +1,14 @@
 #include <raylib.h>
 #include <raymath.h>
+#include <project/asset_cache.hpp>
 #include <project/scene_manager.hpp>
 #include <project/tree_scene.hpp>
 #include <project/geometric_scene.hpp>
 #include <project/bullet_physics_scene.hpp>
 #include <project/imgui_manager.hpp>
 #include <project/gui_controls.hpp>
+#include <project/memory_tracker.hpp>
+#include <project/profiler.hpp>
 #include <iostream>
 #include <memory>
 
@@ -47,6 +50,14 @@ namespace {
         
         #pragma unroll
         while (!WindowShouldClose()) {
+            PROJECT_PROFILE_BEGIN_FRAME();
+            
+            // F1 shows or hides every panel; with none open, ImGui is skipped for the frame
+            if (IsKeyPressed(KEY_F1)) {
+                guiControls.setPanelsVisible(!guiControls.hasVisiblePanels());
+            }
+            imguiManager.setIdle(!guiControls.hasVisiblePanels());
+            
             // Begin ImGui frame
             imguiManager.beginFrame();
             
@@ -89,33 +100,62 @@ namespace {
             // Update current scene
             sceneManager.update();
             
-            // Draw
-            BeginDrawing();
-            ClearBackground(SKYBLUE);
+            // Measure memory while no simulation step is in flight, before the panels show it
+            {
+                PROJECT_PROFILE_SCOPE("Memory sample");
+                project::MemoryTracker& memoryTracker = project::MemoryTracker::instance();
+                memoryTracker.beginSample();
+                sceneManager.reportMemory(memoryTracker);
+                memoryTracker.endSample(GetFrameTime());
+            }
             
-            BeginMode3D(camera);
+            // Build the GUI while no simulation step is in flight: its widgets edit the scene
+            if (imguiManager.isFrameActive()) {
+                guiControls.renderControlPanel(sceneManager, camera);
+                guiControls.renderDebugPanel(sceneManager);
+                guiControls.renderSceneInfo(sceneManager);
+                guiControls.renderPhysicsPanel(sceneManager);
+                guiControls.renderProfilerPanel(sceneManager);
+                guiControls.renderMemoryPanel();
+                guiControls.showDemoWindow();
+            }
             
-            // Draw the current scene
-            sceneManager.draw();
+            // Pipelined mode: step the next frame on the simulation thread while this one is drawn
+            sceneManager.startSimulation();
             
-            // Draw a grid for reference
-            DrawGrid(kGridSlices, kGridSpacing);
+            // Draw
+            BeginDrawing();
+            ClearBackground(SKYBLUE);
             
-            EndMode3D();
+            {
+                // EndMode3D flushes raylib's batch, so it has to be inside the GPU scope
+                PROJECT_PROFILE_SCOPE("3D pass");
+                PROJECT_PROFILE_GPU_SCOPE("3D pass");
+                
+                BeginMode3D(camera);
+                
+                // Draw the current scene
+                sceneManager.draw();
+                
+                // Draw a grid for reference
+                DrawGrid(kGridSlices, kGridSpacing);
+                
+                EndMode3D();
+            }
             
             // Draw raylib UI (FPS counter)
             DrawFPS(kFpsPosX, kFpsPosY);
             
-            // Render ImGui GUI
-            guiControls.renderControlPanel(sceneManager, camera);
-            guiControls.renderDebugPanel();
-            guiControls.renderSceneInfo(sceneManager);
-            guiControls.showDemoWindow();
-            
             // End ImGui frame (renders ImGui)
             imguiManager.endFrame();
             
-            EndDrawing();
+            {
+                // Includes buffer swap and the frame limiter wait
+                PROJECT_PROFILE_SCOPE("EndDrawing");
+                EndDrawing();
+            }
+            
+            PROJECT_PROFILE_END_FRAME();
         }
         
         // Restore cursor state
@@ -133,25 +173,34 @@ int main() {
         return 1;
     }
     
-    // Initialize ImGui
-    project::ImGuiManager imguiManager;
-    imguiManager.initialize();
-    
-    // Create GUI controls
-    project::GuiControls guiControls;
-    
-    // Set up 3D camera
-    Camera3D camera = createCamera();
-    
-    // Create scene manager to handle multiple scenes (Strategy pattern)
-    project::SceneManager sceneManager;
-    
-    // Register only the Bullet Physics scene
-    auto bulletPhysicsScene = std::make_unique<project::BulletPhysicsScene>();
-    sceneManager.registerScene(std::move(bulletPhysicsScene));
-    std::cout << "Registered Bullet Physics Scene\n";
-    
-    runGameLoop(camera, sceneManager, imguiManager, guiControls);
+    // Scope GPU-owning objects so they are released before the window (and GL context) closes
+    {
+        // Initialize ImGui
+        project::ImGuiManager imguiManager;
+        imguiManager.initialize();
+        
+        // Create GUI controls
+        project::GuiControls guiControls;
+        
+        // Set up 3D camera
+        Camera3D camera = createCamera();
+        
+        // Shared model/texture cache (declared before the scenes so it outlives them)
+        project::AssetCache assetCache;
+        
+        // Create scene manager to handle multiple scenes (Strategy pattern)
+        project::SceneManager sceneManager(&assetCache);
+        
+        // Register only the Bullet Physics scene
+        auto bulletPhysicsScene = std::make_unique<project::BulletPhysicsScene>(assetCache);
+        sceneManager.registerScene(std::move(bulletPhysicsScene));
+        std::cout << "Registered Bullet Physics Scene\n";
+        
+        runGameLoop(camera, sceneManager, imguiManager, guiControls);
+        
+        // Timer queries belong to the GL context
+        project::Profiler::instance().shutdownGpu();
+    }
     
     // Cleanup
     CloseWindow();
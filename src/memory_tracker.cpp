@@ -0,0 +1,157 @@
+#include <project/memory_tracker.hpp>
+#include <project/bullet_allocator.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+namespace project {
+
+namespace {
+
+    struct HookCounters {
+        std::atomic<size_t> liveBytes{0};
+        std::atomic<std::uint64_t> allocations{0};
+        std::atomic<bool> used{false};
+    };
+
+    // Intentionally leaked: hooked allocators may free blocks while statics are destroyed
+    std::array<HookCounters, kMemoryCategoryCount>& getHookCounters() {
+        static auto* counters = new std::array<HookCounters, kMemoryCategoryCount>();
+        return *counters;
+    }
+
+    constexpr std::array<const char*, kMemoryCategoryCount> kCategoryNames{
+        "ECS", "Physics", "Assets (CPU)", "Assets (GPU)", "Debris", "ImGui"
+    };
+
+    // Keys of the JSON dump
+    constexpr std::array<const char*, kMemoryCategoryCount> kCategoryKeys{
+        "ecs", "physics", "assets_cpu", "assets_gpu", "debris", "imgui"
+    };
+
+} // namespace
+
+MemoryTracker& MemoryTracker::instance() {
+    static MemoryTracker tracker;
+    return tracker;
+}
+
+void MemoryTracker::recordAllocation(MemoryCategory category, size_t bytes) noexcept {
+    HookCounters& counters = getHookCounters()[static_cast<size_t>(category)];
+    counters.liveBytes.fetch_add(bytes, std::memory_order_relaxed);
+    counters.allocations.fetch_add(1, std::memory_order_relaxed);
+    counters.used.store(true, std::memory_order_relaxed);
+}
+
+void MemoryTracker::recordDeallocation(MemoryCategory category, size_t bytes) noexcept {
+    getHookCounters()[static_cast<size_t>(category)].liveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+void MemoryTracker::beginSample() noexcept {
+    measuredBytes.fill(0);
+}
+
+void MemoryTracker::addMeasured(MemoryCategory category, size_t bytes) noexcept {
+    measuredBytes[static_cast<size_t>(category)] += bytes;
+}
+
+void MemoryTracker::endSample(float deltaTime) {
+    const std::array<HookCounters, kMemoryCategoryCount>& counters = getHookCounters();
+    windowElapsed += deltaTime;
+    const bool windowDone = windowElapsed >= kRateWindow;
+
+    for (size_t i = 0; i < kMemoryCategoryCount; ++i) {
+        MemoryCategoryStats& category = stats[i];
+        size_t hookedBytes = counters[i].liveBytes.load(std::memory_order_relaxed);
+        std::uint64_t allocations = counters[i].allocations.load(std::memory_order_relaxed);
+        bool hooked = counters[i].used.load(std::memory_order_relaxed);
+
+        // BulletAllocator keeps its own counters; Bullet's hook has room for only one allocator
+        if (static_cast<MemoryCategory>(i) == MemoryCategory::Physics && BulletAllocator::isInstalled()) {
+            const BulletAllocator::Stats bullet = BulletAllocator::getStats();
+            hookedBytes += bullet.bytesInUse;
+            allocations += bullet.totalAllocations;
+            hooked = true;
+        }
+
+        const bool wasOverBudget = category.isOverBudget();
+        category.liveBytes = measuredBytes[i] + hookedBytes;
+        category.peakBytes = std::max(category.peakBytes, category.liveBytes);
+        category.allocations = allocations;
+        category.hooked = hooked;
+
+        if (windowDone) {
+            category.allocationsPerSecond =
+                static_cast<float>(allocations - windowStartAllocations[i]) / windowElapsed;
+            windowStartAllocations[i] = allocations;
+        }
+
+        if (category.isOverBudget() && !wasOverBudget) {
+            constexpr double kBytesPerMb = 1024.0 * 1024.0;
+            char usage[64];
+            std::snprintf(usage, sizeof(usage), "%.1f of %.1f MB", static_cast<double>(category.liveBytes) / kBytesPerMb,
+                          static_cast<double>(category.budgetBytes) / kBytesPerMb);
+            std::cerr << "Memory budget exceeded: " << kCategoryNames[i] << " uses " << usage << "\n";
+        }
+    }
+
+    if (windowDone) {
+        windowElapsed = 0.0F;
+    }
+}
+
+size_t MemoryTracker::getTotalLiveBytes() const noexcept {
+    size_t total = 0;
+    for (const MemoryCategoryStats& category : stats) {
+        total += category.liveBytes;
+    }
+    return total;
+}
+
+void MemoryTracker::setBudget(MemoryCategory category, size_t bytes) noexcept {
+    stats[static_cast<size_t>(category)].budgetBytes = bytes;
+}
+
+void MemoryTracker::resetPeaks() noexcept {
+    for (MemoryCategoryStats& category : stats) {
+        category.peakBytes = category.liveBytes;
+    }
+}
+
+void MemoryTracker::writeJson(std::ostream& output) const {
+    output << "{\n";
+    output << "  \"total_live_bytes\": " << getTotalLiveBytes() << ",\n";
+    output << "  \"categories\": [\n";
+    for (size_t i = 0; i < kMemoryCategoryCount; ++i) {
+        const MemoryCategoryStats& category = stats[i];
+        output << "    {\"name\": \"" << kCategoryKeys[i] << "\", \"live_bytes\": " << category.liveBytes
+               << ", \"peak_bytes\": " << category.peakBytes << ", \"budget_bytes\": " << category.budgetBytes
+               << ", \"over_budget\": " << (category.isOverBudget() ? "true" : "false");
+        if (category.hooked) {
+            output << ", \"allocations\": " << category.allocations
+                   << ", \"allocations_per_second\": " << category.allocationsPerSecond;
+        }
+        output << "}" << (i + 1 < kMemoryCategoryCount ? "," : "") << "\n";
+    }
+    output << "  ]\n";
+    output << "}\n";
+}
+
+bool MemoryTracker::writeJsonFile(const std::string& path) const {
+    std::ofstream file(path);
+    if (!file) {
+        std::cerr << "Failed to write memory report: " << path << "\n";
+        return false;
+    }
+    writeJson(file);
+    return static_cast<bool>(file);
+}
+
+const char* MemoryTracker::getCategoryName(MemoryCategory category) noexcept {
+    const auto index = static_cast<size_t>(category);
+    return index < kMemoryCategoryCount ? kCategoryNames[index] : "Unknown";
+}
+
+} // namespace project
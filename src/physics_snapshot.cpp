@@ -0,0 +1,72 @@
+#include <project/physics_snapshot.hpp>
+#include <cstring>
+
+namespace project {
+
+namespace {
+    constexpr std::uint32_t kSnapshotMagic = 0x504E5350;  // "PSNP"
+    constexpr std::uint32_t kSnapshotVersion = 1;
+
+    struct SnapshotHeader {
+        std::uint32_t magic{kSnapshotMagic};
+        std::uint32_t version{kSnapshotVersion};
+        std::uint32_t bodyCount{0};
+        std::uint32_t transformCount{0};
+        float accumulator{0.0F};
+    };
+} // namespace
+
+size_t PhysicsSnapshot::getSerializedSize() const noexcept {
+    return sizeof(SnapshotHeader) + (bodies.size() * sizeof(BodySnapshot)) + (transforms.size() * sizeof(TransformSnapshot));
+}
+
+void PhysicsSnapshot::writeTo(std::vector<unsigned char>& bytes) const {
+    SnapshotHeader header;
+    header.bodyCount = static_cast<std::uint32_t>(bodies.size());
+    header.transformCount = static_cast<std::uint32_t>(transforms.size());
+    header.accumulator = accumulator;
+
+    // Records are plain data, so the body is a straight copy of both arrays
+    bytes.resize(getSerializedSize());
+    unsigned char* cursor = bytes.data();
+    std::memcpy(cursor, &header, sizeof(header));
+    cursor += sizeof(header);
+    if (!bodies.empty()) {
+        std::memcpy(cursor, bodies.data(), bodies.size() * sizeof(BodySnapshot));
+        cursor += bodies.size() * sizeof(BodySnapshot);
+    }
+    if (!transforms.empty()) {
+        std::memcpy(cursor, transforms.data(), transforms.size() * sizeof(TransformSnapshot));
+    }
+}
+
+bool PhysicsSnapshot::readFrom(std::span<const unsigned char> bytes) {
+    clear();
+
+    SnapshotHeader header;
+    if (bytes.size() < sizeof(header)) {
+        return false;
+    }
+    std::memcpy(&header, bytes.data(), sizeof(header));
+
+    const size_t bodyBytes = static_cast<size_t>(header.bodyCount) * sizeof(BodySnapshot);
+    const size_t transformBytes = static_cast<size_t>(header.transformCount) * sizeof(TransformSnapshot);
+    if (header.magic != kSnapshotMagic || header.version != kSnapshotVersion ||
+        bytes.size() != sizeof(header) + bodyBytes + transformBytes) {
+        return false;
+    }
+
+    const unsigned char* cursor = bytes.data() + sizeof(header);
+    bodies.resize(header.bodyCount);
+    if (bodyBytes > 0) {
+        std::memcpy(bodies.data(), cursor, bodyBytes);
+    }
+    transforms.resize(header.transformCount);
+    if (transformBytes > 0) {
+        std::memcpy(transforms.data(), cursor + bodyBytes, transformBytes);
+    }
+    accumulator = header.accumulator;
+    return true;
+}
+
+} // namespace project
@@ -0,0 +1,274 @@
+#include <project/physics_threading.hpp>
+
+#if defined(PROJECT_BULLET_MULTITHREADING)
+#include <LinearMath/btThreads.h>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <semaphore>
+#include <stop_token>
+#include <thread>
+#include <vector>
+#endif
+
+namespace project {
+
+#if defined(PROJECT_BULLET_MULTITHREADING)
+
+namespace {
+
+    /// Bullet task scheduler backed by a fixed pool of std::jthread workers
+    /// The calling thread takes part in every parallelFor, so N threads means N - 1 active workers
+    ///
+    /// Bullet hands every thread that enters it a slot in its per-thread arrays, from a counter
+    /// that never goes back. The workers are therefore started once, on the first request for
+    /// more than one thread, and changing the thread count only changes how many of them are
+    /// woken for a job; threads are never re-created.
+    class ThreadPoolTaskScheduler final : public btITaskScheduler {
+    public:
+        ThreadPoolTaskScheduler() : btITaskScheduler("ThreadPool") {}
+
+        ~ThreadPoolTaskScheduler() override {
+            for (const auto& worker : workers) {
+                worker->thread.request_stop();
+                worker->wake.release();
+            }
+            workers.clear();  // jthread joins on destruction
+        }
+
+        ThreadPoolTaskScheduler(const ThreadPoolTaskScheduler&) = delete;
+        ThreadPoolTaskScheduler& operator=(const ThreadPoolTaskScheduler&) = delete;
+        ThreadPoolTaskScheduler(ThreadPoolTaskScheduler&&) = delete;
+        ThreadPoolTaskScheduler& operator=(ThreadPoolTaskScheduler&&) = delete;
+
+        int getMaxNumThreads() const override {
+            // One slot stays free for a second calling thread (the simulation thread in pipelined mode)
+            return BT_MAX_THREAD_COUNT - 1;
+        }
+
+        int getNumThreads() const override {
+            return numThreads;
+        }
+
+        void setNumThreads(int threadCount) override {
+            numThreads = std::clamp(threadCount, 1, getMaxNumThreads());
+            if (numThreads > 1 && workers.empty()) {
+                startWorkers();
+            }
+        }
+
+        void parallelFor(int iBegin, int iEnd, int grainSize, const btIParallelForBody& body) override {
+            runChunks(iBegin, iEnd, grainSize, [&body](int chunkBegin, int chunkEnd) {
+                body.forLoop(chunkBegin, chunkEnd);
+            });
+        }
+
+        btScalar parallelSum(int iBegin, int iEnd, int grainSize, const btIParallelSumBody& body) override {
+            std::mutex sumMutex;
+            btScalar total = 0.0F;
+            runChunks(iBegin, iEnd, grainSize, [&](int chunkBegin, int chunkEnd) {
+                const btScalar partial = body.sumLoop(chunkBegin, chunkEnd);
+                const std::scoped_lock lock(sumMutex);
+                total += partial;
+            });
+            return total;
+        }
+
+    private:
+        using ChunkFunction = std::function<void(int, int)>;
+
+        /// Worker thread, woken through its own semaphore so idle workers stay asleep
+        struct Worker {
+            std::binary_semaphore wake{0};
+            std::jthread thread;
+        };
+
+        std::vector<std::unique_ptr<Worker>> workers;
+        int numThreads{1};
+
+        // Current job, published under jobMutex
+        std::mutex jobMutex;
+        std::condition_variable jobFinished;
+        const ChunkFunction* job{nullptr};
+        int jobEnd{0};
+        int jobGrain{1};
+        std::atomic<int> nextIndex{0};
+        int busyWorkers{0};
+
+        // Bullet may call parallelFor from inside a running body; such calls run inline
+        static inline thread_local bool insideParallelRegion = false;
+
+        void startWorkers() {
+            const int workerCount = getMaxNumThreads() - 1;
+            workers.reserve(static_cast<size_t>(workerCount));
+            for (int i = 0; i < workerCount; ++i) {
+                auto worker = std::make_unique<Worker>();
+                Worker& self = *worker;
+                worker->thread = std::jthread([this, &self](std::stop_token stopToken) { workerLoop(stopToken, self); });
+                workers.push_back(std::move(worker));
+            }
+        }
+
+        void runChunks(int iBegin, int iEnd, int grainSize, const ChunkFunction& function) {
+            if (iBegin >= iEnd) {
+                return;
+            }
+
+            const int grain = std::max(grainSize, 1);
+            const int activeWorkers = std::min(numThreads - 1, static_cast<int>(workers.size()));
+            if (activeWorkers <= 0 || insideParallelRegion || iEnd - iBegin <= grain) {
+                function(iBegin, iEnd);
+                return;
+            }
+
+            {
+                const std::scoped_lock lock(jobMutex);
+                job = &function;
+                jobEnd = iEnd;
+                jobGrain = grain;
+                nextIndex.store(iBegin, std::memory_order_relaxed);
+                busyWorkers = activeWorkers;
+            }
+            for (int i = 0; i < activeWorkers; ++i) {
+                workers[static_cast<size_t>(i)]->wake.release();
+            }
+
+            // The caller works on the job too
+            processChunks(function, iEnd, grain);
+
+            std::unique_lock lock(jobMutex);
+            jobFinished.wait(lock, [this] { return busyWorkers == 0; });
+            job = nullptr;
+        }
+
+        void processChunks(const ChunkFunction& function, int end, int grain) {
+            insideParallelRegion = true;
+            for (;;) {
+                const int chunkBegin = nextIndex.fetch_add(grain, std::memory_order_relaxed);
+                if (chunkBegin >= end) {
+                    break;
+                }
+                function(chunkBegin, std::min(chunkBegin + grain, end));
+            }
+            insideParallelRegion = false;
+        }
+
+        void workerLoop(const std::stop_token& stopToken, Worker& self) {
+            for (;;) {
+                self.wake.acquire();
+                if (stopToken.stop_requested()) {
+                    return;
+                }
+
+                // Woken only for a published job, which stays set until every woken worker is done
+                const ChunkFunction* currentJob = nullptr;
+                int end = 0;
+                int grain = 1;
+                {
+                    const std::scoped_lock lock(jobMutex);
+                    currentJob = job;
+                    end = jobEnd;
+                    grain = jobGrain;
+                }
+
+                processChunks(*currentJob, end, grain);
+
+                {
+                    const std::scoped_lock lock(jobMutex);
+                    --busyWorkers;
+                }
+                jobFinished.notify_one();
+            }
+        }
+    };
+
+    TaskSchedulerKind activeKind{TaskSchedulerKind::ThreadPool};
+    btITaskScheduler* customScheduler{nullptr};
+
+    ThreadPoolTaskScheduler& getThreadPoolScheduler() {
+        static ThreadPoolTaskScheduler scheduler;
+        return scheduler;
+    }
+
+    btITaskScheduler* findTaskScheduler(TaskSchedulerKind kind) {
+        switch (kind) {
+            case TaskSchedulerKind::ThreadPool: return &getThreadPoolScheduler();
+            case TaskSchedulerKind::BulletDefault: {
+                // btCreateDefaultTaskScheduler allocates a new scheduler each call; create it once
+                static const std::unique_ptr<btITaskScheduler> defaultScheduler(btCreateDefaultTaskScheduler());
+                return defaultScheduler.get();
+            }
+            case TaskSchedulerKind::OpenMP: return btGetOpenMPTaskScheduler();
+            case TaskSchedulerKind::TBB: return btGetTBBTaskScheduler();
+            case TaskSchedulerKind::PPL: return btGetPPLTaskScheduler();
+            case TaskSchedulerKind::Custom: return customScheduler;
+        }
+        return nullptr;
+    }
+
+} // namespace
+
+bool PhysicsThreading::activateTaskScheduler(TaskSchedulerKind kind, int threadCount) {
+    btITaskScheduler* scheduler = findTaskScheduler(kind);
+    if (scheduler == nullptr) {
+        return false;
+    }
+
+    scheduler->setNumThreads(std::clamp(threadCount, 1, scheduler->getMaxNumThreads()));
+    btSetTaskScheduler(scheduler);
+    activeKind = kind;
+    return true;
+}
+
+TaskSchedulerKind PhysicsThreading::getActiveTaskScheduler() noexcept {
+    return activeKind;
+}
+
+void PhysicsThreading::setThreadCount(int threadCount) {
+    if (btITaskScheduler* scheduler = btGetTaskScheduler(); scheduler != nullptr) {
+        scheduler->setNumThreads(std::clamp(threadCount, 1, scheduler->getMaxNumThreads()));
+    }
+}
+
+int PhysicsThreading::getThreadCount() {
+    const btITaskScheduler* scheduler = btGetTaskScheduler();
+    return (scheduler != nullptr) ? scheduler->getNumThreads() : 1;
+}
+
+int PhysicsThreading::getMaxThreadCount() {
+    const btITaskScheduler* scheduler = btGetTaskScheduler();
+    return (scheduler != nullptr) ? scheduler->getMaxNumThreads() : 1;
+}
+
+void PhysicsThreading::setCustomTaskScheduler(btITaskScheduler* scheduler) noexcept {
+    customScheduler = scheduler;
+}
+
+#else
+
+bool PhysicsThreading::activateTaskScheduler(TaskSchedulerKind /*kind*/, int /*threadCount*/) {
+    return false;
+}
+
+TaskSchedulerKind PhysicsThreading::getActiveTaskScheduler() noexcept {
+    return TaskSchedulerKind::ThreadPool;
+}
+
+void PhysicsThreading::setThreadCount(int /*threadCount*/) {
+}
+
+int PhysicsThreading::getThreadCount() {
+    return 1;
+}
+
+int PhysicsThreading::getMaxThreadCount() {
+    return 1;
+}
+
+#endif
+
+} // namespace project
@@ -0,0 +1,419 @@
+#include <project/physics_world.hpp>
+#include <project/bullet_allocator.hpp>
+#include <btBulletDynamicsCommon.h>
+#if defined(PROJECT_BULLET_MULTITHREADING)
+#include <BulletCollision/CollisionDispatch/btCollisionDispatcherMt.h>
+#include <BulletDynamics/ConstraintSolver/btSequentialImpulseConstraintSolverMt.h>
+#include <BulletDynamics/Dynamics/btDiscreteDynamicsWorldMt.h>
+#include <algorithm>
+#include <thread>
+#endif
+#include <iostream>
+#include <utility>
+
+namespace project {
+
+PhysicsWorld::PhysicsWorld(entt::registry& registry)
+    : registry(&registry) {
+    // Route Bullet's internal allocations to the size-class allocator before the world exists
+    BulletAllocator::install();
+}
+
+PhysicsWorld::~PhysicsWorld() {
+    shutdown();
+}
+
+void PhysicsWorld::initialize() {
+    if (dynamicsWorld != nullptr) {
+        return;
+    }
+
+    if (physicsBackend == PhysicsBackend::MultiThreaded && PhysicsThreading::isAvailable()) {
+        setupMultiThreadedWorld();
+    } else {
+        setupSingleThreadedWorld();
+    }
+
+    // Set gravity (Y-axis up in raylib, Y-axis up in Bullet by default)
+    constexpr float kGravity = -9.8F;
+    dynamicsWorld->setGravity(btVector3(0.0F, kGravity, 0.0F));
+
+    stepState = PhysicsStepState{};
+    syncState.reset();
+}
+
+void PhysicsWorld::shutdown() {
+    if (dynamicsWorld == nullptr) {
+        return;
+    }
+
+    // Remove all rigid bodies from the physics world, then destroy them with their components
+    auto physicsView = registry->view<PhysicsBody>();
+    for (auto entity : physicsView) {
+        const auto& physicsBody = physicsView.get<PhysicsBody>(entity);
+        if (physicsBody.rigidBody != nullptr) {
+            dynamicsWorld->removeRigidBody(physicsBody.rigidBody);
+        }
+    }
+    registry->clear<PhysicsBody>();
+    syncState.reset();
+
+    // Every body is gone now, so the pooled chunks can be released in one go
+    bodyPool.releaseMemory();
+
+    destroyWorld();
+}
+
+void PhysicsWorld::update(float deltaTime, TaskPool* taskPool) {
+    if (dynamicsWorld == nullptr) {
+        return;
+    }
+
+    PhysicsSystem::update(*registry, dynamicsWorld, deltaTime, stepConfig, stepState, syncState, taskPool);
+}
+
+void PhysicsWorld::step() {
+    if (dynamicsWorld == nullptr || stepConfig.stepRate <= 0.0F) {
+        return;
+    }
+
+    // maxSubSteps = 0 makes Bullet take exactly one step of the given size
+    syncState.beginFrame();
+    dynamicsWorld->stepSimulation(1.0F / stepConfig.stepRate, 0);
+    PhysicsSystem::syncTransforms(*registry, syncState);
+
+    stepState.stepsLastFrame = 1;
+    stepState.droppedTimeLastFrame = 0.0F;
+}
+
+entt::entity PhysicsWorld::createBody(const Vector3& position, ShapeHandle collisionShape, float mass) {
+    const auto entity = registry->create();
+
+    // Calculate inertia
+    btVector3 localInertia(0.0, 0.0, 0.0);
+    if (mass != 0.0F) {
+        collisionShape->calculateLocalInertia(mass, localInertia);
+    }
+
+    attachBody(entity, BodySpawn{position, Quaternion{0.0F, 0.0F, 0.0F, 1.0F}, 0, mass}, collisionShape, localInertia);
+    return entity;
+}
+
+void PhysicsWorld::createBodies(std::span<const BodySpawn> spawns, std::span<const ShapeHandle> shapes, std::vector<entt::entity>& entities) {
+    // Beyond this many bodies, one top-down rebuild beats the tree incremental inserts leave behind
+    constexpr size_t kBroadphaseRebuildThreshold = 256;
+
+    entities.resize(spawns.size());
+    if (spawns.empty()) {
+        return;
+    }
+
+    registry->create(entities.begin(), entities.end());
+
+    size_t dynamicCount = 0;
+    for (const BodySpawn& spawn : spawns) {
+        dynamicCount += (spawn.mass != 0.0F) ? 1 : 0;
+    }
+    registry->storage<Transform>().reserve(registry->storage<Transform>().size() + spawns.size());
+    registry->storage<PhysicsBody>().reserve(registry->storage<PhysicsBody>().size() + spawns.size());
+    registry->storage<PreviousTransform>().reserve(registry->storage<PreviousTransform>().size() + dynamicCount);
+    bodyPool.rigidBodies.reserve(spawns.size());
+    bodyPool.motionStates.reserve(spawns.size());
+
+    // Bullet's inertia is linear in mass for every convex shape, so compute it once per shape
+    std::vector<btVector3> unitInertia(shapes.size(), btVector3(0.0, 0.0, 0.0));
+    for (size_t i = 0; i < shapes.size(); ++i) {
+        if (shapes[i] != nullptr) {
+            shapes[i]->calculateLocalInertia(1.0F, unitInertia[i]);
+        }
+    }
+
+    size_t skipped = 0;
+    for (size_t i = 0; i < spawns.size(); ++i) {
+        const BodySpawn& spawn = spawns[i];
+        if (spawn.shapeIndex >= shapes.size() || shapes[spawn.shapeIndex] == nullptr) {
+            registry->destroy(entities[i]);
+            entities[i] = entt::null;
+            ++skipped;
+            continue;
+        }
+        const btVector3 localInertia = (spawn.mass != 0.0F) ? unitInertia[spawn.shapeIndex] * spawn.mass : btVector3(0.0, 0.0, 0.0);
+        attachBody(entities[i], spawn, shapes[spawn.shapeIndex], localInertia);
+    }
+    if (skipped != 0) {
+        std::cout << "ERROR: Skipped " << skipped << " body spawns without a valid shape (of " << shapes.size()
+                  << " shapes)" << std::endl;
+    }
+
+    if (overlappingPairCache != nullptr && spawns.size() >= kBroadphaseRebuildThreshold) {
+        overlappingPairCache->optimize();
+    }
+}
+
+void PhysicsWorld::attachBody(entt::entity entity, const BodySpawn& spawn, const ShapeHandle& collisionShape, const btVector3& localInertia) {
+    // Add Transform component
+    auto& transform = registry->emplace<Transform>(entity);
+    transform.position = spawn.position;
+    transform.rotation = spawn.rotation;
+    transform.scale = Vector3{1.0F, 1.0F, 1.0F};
+
+    // Setup Bullet Physics transform
+    const btTransform bulletTransform(
+        btQuaternion(spawn.rotation.x, spawn.rotation.y, spawn.rotation.z, spawn.rotation.w),
+        btVector3(spawn.position.x, spawn.position.y, spawn.position.z)
+    );
+    const bool isStatic = (spawn.mass == 0.0F);
+
+    // Create motion state; it reports the entity to the sync list whenever Bullet moves the body
+    EntityMotionState* motionState = bodyPool.motionStates.create(bulletTransform, entity, &syncState.movedBodies);
+
+    // Create rigid body
+    btRigidBody::btRigidBodyConstructionInfo rigidBodyCI(
+        spawn.mass,
+        motionState,
+        collisionShape.get(),
+        localInertia
+    );
+
+    btRigidBody* rigidBody = bodyPool.rigidBodies.create(rigidBodyCI);
+
+    // Queries map hits back through the user index; entt::null is -1, Bullet's "unset" value
+    rigidBody->setUserIndex(static_cast<int>(entt::to_integral(entity)));
+
+    // Add rigid body to physics world
+    if (dynamicsWorld != nullptr) {
+        dynamicsWorld->addRigidBody(rigidBody);
+    }
+
+    // Add PhysicsBody component
+    auto& physicsBody = registry->emplace<PhysicsBody>(entity);
+    physicsBody.rigidBody = rigidBody;
+    physicsBody.collisionShape = collisionShape;
+    physicsBody.motionState = motionState;
+    physicsBody.pool = &bodyPool;
+    physicsBody.mass = spawn.mass;
+    physicsBody.isStatic = isStatic;
+
+    // Dynamic bodies are drawn interpolated between fixed steps
+    if (!isStatic) {
+        registry->emplace<PreviousTransform>(entity, transform.position, transform.rotation);
+    }
+}
+
+void PhysicsWorld::captureSnapshot(PhysicsSnapshot& snapshot) const {
+    snapshot.clear();
+    snapshot.accumulator = stepState.accumulator;
+
+    // Static bodies never move, so only dynamic ones carry state
+    auto physicsView = registry->view<const PhysicsBody>();
+    for (auto entity : physicsView) {
+        const auto& physicsBody = physicsView.get<const PhysicsBody>(entity);
+        if (physicsBody.isStatic || physicsBody.rigidBody == nullptr) {
+            continue;
+        }
+
+        const btRigidBody& body = *physicsBody.rigidBody;
+        const btTransform& worldTransform = body.getWorldTransform();
+        const btQuaternion rotation = worldTransform.getRotation();
+        const btVector3& linearVelocity = body.getLinearVelocity();
+        const btVector3& angularVelocity = body.getAngularVelocity();
+
+        BodySnapshot& state = snapshot.bodies.emplace_back();
+        state.entity = entity;
+        state.activationState = body.getActivationState();
+        state.deactivationTime = body.getDeactivationTime();
+        for (int axis = 0; axis < 3; ++axis) {
+            state.position[axis] = worldTransform.getOrigin().m_floats[axis];
+            state.linearVelocity[axis] = linearVelocity.m_floats[axis];
+            state.angularVelocity[axis] = angularVelocity.m_floats[axis];
+        }
+        state.rotation[0] = rotation.x();
+        state.rotation[1] = rotation.y();
+        state.rotation[2] = rotation.z();
+        state.rotation[3] = rotation.w();
+    }
+
+    auto transformView = registry->view<const Transform>();
+    for (auto entity : transformView) {
+        TransformSnapshot& state = snapshot.transforms.emplace_back();
+        state.entity = entity;
+        state.transform = transformView.get<const Transform>(entity);
+        if (const auto* previous = registry->try_get<PreviousTransform>(entity); previous != nullptr) {
+            state.previous = *previous;
+            state.hasPrevious = 1;
+        }
+    }
+}
+
+void PhysicsWorld::restoreSnapshot(const PhysicsSnapshot& snapshot) {
+    for (const BodySnapshot& state : snapshot.bodies) {
+        const auto* physicsBody = registry->valid(state.entity) ? registry->try_get<PhysicsBody>(state.entity) : nullptr;
+        if (physicsBody == nullptr || physicsBody->rigidBody == nullptr) {
+            continue;
+        }
+
+        btRigidBody& body = *physicsBody->rigidBody;
+        const btTransform worldTransform(
+            btQuaternion(state.rotation[0], state.rotation[1], state.rotation[2], state.rotation[3]),
+            btVector3(state.position[0], state.position[1], state.position[2])
+        );
+        const btVector3 linearVelocity(state.linearVelocity[0], state.linearVelocity[1], state.linearVelocity[2]);
+        const btVector3 angularVelocity(state.angularVelocity[0], state.angularVelocity[1], state.angularVelocity[2]);
+
+        body.setWorldTransform(worldTransform);
+        body.setInterpolationWorldTransform(worldTransform);
+        body.setLinearVelocity(linearVelocity);
+        body.setAngularVelocity(angularVelocity);
+        body.setInterpolationLinearVelocity(linearVelocity);
+        body.setInterpolationAngularVelocity(angularVelocity);
+        body.clearForces();
+        body.forceActivationState(state.activationState);
+        body.setDeactivationTime(state.deactivationTime);
+
+        // Write the motion state directly: the ECS transform is restored below, so the
+        // entity must not be queued for a sync that would happen anyway
+        if (physicsBody->motionState != nullptr) {
+            physicsBody->motionState->m_graphicsWorldTrans = worldTransform;
+        }
+        if (dynamicsWorld != nullptr) {
+            dynamicsWorld->updateSingleAabb(&body);
+        }
+    }
+
+    for (const TransformSnapshot& state : snapshot.transforms) {
+        if (!registry->valid(state.entity) || !registry->all_of<Transform>(state.entity)) {
+            continue;
+        }
+        registry->get<Transform>(state.entity) = state.transform;
+        if (state.hasPrevious != 0) {
+            if (auto* previous = registry->try_get<PreviousTransform>(state.entity); previous != nullptr) {
+                *previous = state.previous;
+            }
+        }
+        registry->emplace_or_replace<BoundsDirty>(state.entity);
+    }
+
+    stepState.accumulator = snapshot.accumulator;
+}
+
+SpatialQuery PhysicsWorld::getSpatialQuery() const noexcept {
+    return SpatialQuery(dynamicsWorld);
+}
+
+void PhysicsWorld::setPhysicsBackend(PhysicsBackend backend) noexcept {
+    physicsBackend = PhysicsThreading::isAvailable() ? backend : PhysicsBackend::SingleThreaded;
+}
+
+bool PhysicsWorld::setTaskScheduler(TaskSchedulerKind kind) {
+    if (physicsBackend == PhysicsBackend::MultiThreaded && dynamicsWorld != nullptr) {
+        if (!PhysicsThreading::activateTaskScheduler(kind, PhysicsThreading::getThreadCount())) {
+            return false;
+        }
+    } else if (!PhysicsThreading::isAvailable()) {
+        return false;
+    }
+
+    taskScheduler = kind;
+    return true;
+}
+
+void PhysicsWorld::setupSingleThreadedWorld() {
+    // Create collision configuration
+    collisionConfiguration = new btDefaultCollisionConfiguration();
+
+    // Create dispatcher
+    dispatcher = new btCollisionDispatcher(collisionConfiguration);
+
+    // Create broadphase
+    overlappingPairCache = new btDbvtBroadphase();
+
+    // Create constraint solver
+    constraintSolver = new btSequentialImpulseConstraintSolver();
+
+    // Create dynamics world
+    dynamicsWorld = new btDiscreteDynamicsWorld(
+        dispatcher,
+        overlappingPairCache,
+        constraintSolver,
+        collisionConfiguration
+    );
+}
+
+void PhysicsWorld::setupMultiThreadedWorld() {
+#if defined(PROJECT_BULLET_MULTITHREADING)
+    // Install the scheduler first: the solver pool is sized from its thread limit
+    const int hardwareThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    if (!PhysicsThreading::activateTaskScheduler(taskScheduler, hardwareThreads)) {
+        std::cout << "Task scheduler " << kTaskSchedulerNames.at(static_cast<size_t>(taskScheduler))
+                  << " unavailable, using thread pool" << std::endl;
+        taskScheduler = TaskSchedulerKind::ThreadPool;
+        PhysicsThreading::activateTaskScheduler(taskScheduler, hardwareThreads);
+    }
+
+    // Larger pools avoid contention on the shared allocators when many pairs are created in parallel
+    constexpr int kManifoldPoolSize = 80000;
+    constexpr int kAlgorithmPoolSize = 80000;
+    btDefaultCollisionConstructionInfo constructionInfo;
+    constructionInfo.m_defaultMaxPersistentManifoldPoolSize = kManifoldPoolSize;
+    constructionInfo.m_defaultMaxCollisionAlgorithmPoolSize = kAlgorithmPoolSize;
+    collisionConfiguration = new btDefaultCollisionConfiguration(constructionInfo);
+
+    // Narrowphase runs in parallel over pair batches of this size
+    constexpr int kDispatcherGrainSize = 40;
+    dispatcher = new btCollisionDispatcherMt(collisionConfiguration, kDispatcherGrainSize);
+
+    overlappingPairCache = new btDbvtBroadphase();
+
+    // One solver per thread solves islands in parallel; the Mt solver handles very large islands
+    auto* threadSolverPool = new btConstraintSolverPoolMt(PhysicsThreading::getMaxThreadCount());
+    solverPool = threadSolverPool;
+    constraintSolver = new btSequentialImpulseConstraintSolverMt();
+
+    dynamicsWorld = new btDiscreteDynamicsWorldMt(
+        dispatcher,
+        overlappingPairCache,
+        threadSolverPool,
+        constraintSolver,
+        collisionConfiguration
+    );
+
+    std::cout << "Physics backend: multithreaded (" << PhysicsThreading::getThreadCount() << " threads)" << std::endl;
+#else
+    setupSingleThreadedWorld();
+#endif
+}
+
+void PhysicsWorld::destroyWorld() {
+    // Delete dynamics world components
+    if (dynamicsWorld != nullptr) {
+        delete dynamicsWorld;
+        dynamicsWorld = nullptr;
+    }
+
+    if (constraintSolver != nullptr) {
+        delete constraintSolver;
+        constraintSolver = nullptr;
+    }
+
+    if (solverPool != nullptr) {
+        delete solverPool;
+        solverPool = nullptr;
+    }
+
+    if (overlappingPairCache != nullptr) {
+        delete overlappingPairCache;
+        overlappingPairCache = nullptr;
+    }
+
+    if (dispatcher != nullptr) {
+        delete dispatcher;
+        dispatcher = nullptr;
+    }
+
+    if (collisionConfiguration != nullptr) {
+        delete collisionConfiguration;
+        collisionConfiguration = nullptr;
+    }
+}
+
+} // namespace project
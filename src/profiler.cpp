@@ -0,0 +1,266 @@
+#include <project/profiler.hpp>
+#include <algorithm>
+#include <iostream>
+
+#if !defined(__EMSCRIPTEN__)
+// GLFW is linked into raylib on desktop platforms; we only need its loader entry point
+extern "C" void* glfwGetProcAddress(const char* procname);
+#endif
+
+namespace project {
+
+namespace {
+
+#if !defined(__EMSCRIPTEN__)
+    // Timer query entry points (core since OpenGL 3.3 / ARB_timer_query)
+    constexpr unsigned int kGlTimeElapsed = 0x88BF;
+    constexpr unsigned int kGlQueryResult = 0x8866;
+    constexpr unsigned int kGlQueryResultAvailable = 0x8867;
+
+    using GenQueriesFunction = void (*)(int, unsigned int*);
+    using DeleteQueriesFunction = void (*)(int, const unsigned int*);
+    using BeginQueryFunction = void (*)(unsigned int, unsigned int);
+    using EndQueryFunction = void (*)(unsigned int);
+    using GetQueryObjectivFunction = void (*)(unsigned int, unsigned int, int*);
+    using GetQueryObjectui64vFunction = void (*)(unsigned int, unsigned int, std::uint64_t*);
+
+    struct TimerQueryApi {
+        GenQueriesFunction genQueries{nullptr};
+        DeleteQueriesFunction deleteQueries{nullptr};
+        BeginQueryFunction beginQuery{nullptr};
+        EndQueryFunction endQuery{nullptr};
+        GetQueryObjectivFunction getQueryObjectiv{nullptr};
+        GetQueryObjectui64vFunction getQueryObjectui64v{nullptr};
+
+        [[nodiscard]] bool isComplete() const noexcept {
+            return genQueries != nullptr && deleteQueries != nullptr && beginQuery != nullptr &&
+                   endQuery != nullptr && getQueryObjectiv != nullptr && getQueryObjectui64v != nullptr;
+        }
+    };
+
+    TimerQueryApi timerQueries;
+
+    template <typename Function>
+    Function loadGlFunction(const char* name) {
+        return reinterpret_cast<Function>(glfwGetProcAddress(name));
+    }
+#endif
+
+} // namespace
+
+Profiler& Profiler::instance() {
+    static Profiler profiler;
+    return profiler;
+}
+
+// GPU queries are not deleted here: the GL context is gone by the time statics are destroyed
+Profiler::~Profiler() = default;
+
+void Profiler::beginFrame() {
+    if (mainThread == std::thread::id{}) {
+        mainThread = std::this_thread::get_id();
+    }
+    if (!isRecordingThread()) {
+        return;
+    }
+
+    frameStart = Clock::now();
+    current.cpuSamples.clear();
+    current.gpuSamples.clear();
+    openScopes.clear();
+    frameOpen = !paused;
+}
+
+void Profiler::endFrame() {
+    if (!isRecordingThread() || !frameOpen) {
+        return;
+    }
+
+    // Close scopes left open by early returns so the frame stays well-formed
+    while (!openScopes.empty()) {
+        endScope();
+    }
+    if (openGpuScope != nullptr) {
+        endGpuScope();
+    }
+
+    current.frameMs = elapsedMs();
+
+    if (gpuInitialized) {
+        collectGpuResults();
+        for (size_t i = 0; i < gpuScopeCount; ++i) {
+            current.gpuSamples.push_back(GpuSample{gpuScopes[i].name, gpuScopes[i].lastDurationMs});
+        }
+        gpuFrameSlot = (gpuFrameSlot + 1) % kGpuLatency;
+    }
+
+    // Swap into the ring buffer so both sides keep their vector capacity
+    newestFrame = (frameCount == 0) ? 0 : (newestFrame + 1) % kHistorySize;
+    std::swap(history[newestFrame], current);
+    frameCount = std::min(frameCount + 1, kHistorySize);
+    frameOpen = false;
+}
+
+void Profiler::beginScope(const char* name) {
+    if (!frameOpen || !isRecordingThread()) {
+        return;
+    }
+
+    ProfileSample sample;
+    sample.name = name;
+    sample.parent = openScopes.empty() ? -1 : openScopes.back();
+    sample.depth = static_cast<std::uint16_t>(openScopes.size());
+    sample.startMs = elapsedMs();
+
+    openScopes.push_back(static_cast<std::int32_t>(current.cpuSamples.size()));
+    current.cpuSamples.push_back(sample);
+}
+
+void Profiler::endScope() {
+    if (!frameOpen || !isRecordingThread() || openScopes.empty()) {
+        return;
+    }
+
+    ProfileSample& sample = current.cpuSamples[static_cast<size_t>(openScopes.back())];
+    sample.durationMs = elapsedMs() - sample.startMs;
+    openScopes.pop_back();
+}
+
+void Profiler::beginGpuScope(const char* name) {
+    if (!frameOpen || !isRecordingThread() || openGpuScope != nullptr) {
+        return;
+    }
+
+    if (!gpuInitialized) {
+        initializeGpu();
+    }
+    if (!gpuTimingSupported) {
+        return;
+    }
+
+#if !defined(__EMSCRIPTEN__)
+    GpuScope* scope = findGpuScope(name);
+    if (scope == nullptr) {
+        return;
+    }
+
+    // The query from kGpuLatency frames ago is still in flight; skip rather than stall
+    if (scope->pending[gpuFrameSlot]) {
+        return;
+    }
+
+    timerQueries.beginQuery(kGlTimeElapsed, scope->queries[gpuFrameSlot]);
+    openGpuScope = scope;
+#endif
+}
+
+void Profiler::endGpuScope() {
+    if (openGpuScope == nullptr) {
+        return;
+    }
+
+#if !defined(__EMSCRIPTEN__)
+    timerQueries.endQuery(kGlTimeElapsed);
+    openGpuScope->pending[gpuFrameSlot] = true;
+#endif
+    openGpuScope = nullptr;
+}
+
+void Profiler::shutdownGpu() {
+#if !defined(__EMSCRIPTEN__)
+    if (gpuTimingSupported) {
+        for (size_t i = 0; i < gpuScopeCount; ++i) {
+            timerQueries.deleteQueries(static_cast<int>(kGpuLatency), gpuScopes[i].queries.data());
+        }
+    }
+#endif
+    gpuScopes = {};
+    gpuScopeCount = 0;
+    openGpuScope = nullptr;
+    gpuInitialized = false;
+    gpuTimingSupported = false;
+}
+
+const ProfileFrame& Profiler::getFrame(size_t age) const {
+    const size_t clampedAge = std::min(age, (frameCount == 0) ? 0 : frameCount - 1);
+    return history[(newestFrame + kHistorySize - clampedAge) % kHistorySize];
+}
+
+bool Profiler::isRecordingThread() const noexcept {
+    return std::this_thread::get_id() == mainThread;
+}
+
+double Profiler::elapsedMs() const noexcept {
+    return std::chrono::duration<double, std::milli>(Clock::now() - frameStart).count();
+}
+
+void Profiler::initializeGpu() {
+    gpuInitialized = true;
+
+#if defined(__EMSCRIPTEN__)
+    // WebGL 2 only exposes timer queries through an optional, often disabled extension
+    gpuTimingSupported = false;
+#else
+    timerQueries.genQueries = loadGlFunction<GenQueriesFunction>("glGenQueries");
+    timerQueries.deleteQueries = loadGlFunction<DeleteQueriesFunction>("glDeleteQueries");
+    timerQueries.beginQuery = loadGlFunction<BeginQueryFunction>("glBeginQuery");
+    timerQueries.endQuery = loadGlFunction<EndQueryFunction>("glEndQuery");
+    timerQueries.getQueryObjectiv = loadGlFunction<GetQueryObjectivFunction>("glGetQueryObjectiv");
+    timerQueries.getQueryObjectui64v = loadGlFunction<GetQueryObjectui64vFunction>("glGetQueryObjectui64v");
+    gpuTimingSupported = timerQueries.isComplete();
+
+    if (!gpuTimingSupported) {
+        std::cout << "Profiler: GPU timer queries unavailable, GPU timing disabled" << std::endl;
+    }
+#endif
+}
+
+void Profiler::collectGpuResults() {
+#if !defined(__EMSCRIPTEN__)
+    if (!gpuTimingSupported) {
+        return;
+    }
+
+    constexpr double kNanosecondsPerMs = 1.0e6;
+    for (size_t i = 0; i < gpuScopeCount; ++i) {
+        GpuScope& scope = gpuScopes[i];
+        for (size_t slot = 0; slot < kGpuLatency; ++slot) {
+            if (!scope.pending[slot]) {
+                continue;
+            }
+
+            int available = 0;
+            timerQueries.getQueryObjectiv(scope.queries[slot], kGlQueryResultAvailable, &available);
+            if (available == 0) {
+                continue;
+            }
+
+            std::uint64_t elapsedNs = 0;
+            timerQueries.getQueryObjectui64v(scope.queries[slot], kGlQueryResult, &elapsedNs);
+            scope.lastDurationMs = static_cast<double>(elapsedNs) / kNanosecondsPerMs;
+            scope.pending[slot] = false;
+        }
+    }
+#endif
+}
+
+Profiler::GpuScope* Profiler::findGpuScope(const char* name) {
+    for (size_t i = 0; i < gpuScopeCount; ++i) {
+        if (gpuScopes[i].name == name) {
+            return &gpuScopes[i];
+        }
+    }
+
+    if (gpuScopeCount == kMaxGpuScopes) {
+        return nullptr;
+    }
+
+    GpuScope& scope = gpuScopes[gpuScopeCount++];
+    scope.name = name;
+#if !defined(__EMSCRIPTEN__)
+    timerQueries.genQueries(static_cast<int>(kGpuLatency), scope.queries.data());
+#endif
+    return &scope;
+}
+
+} // namespace project
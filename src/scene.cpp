@@ -1,5 +1,5 @@
 #include <project/scene.hpp>
-#include <algorithm>
+#include <utility>
 
 namespace project {
 
@@ -30,7 +30,9 @@ void SceneObject::draw() const {
     }
     
     const auto scaleVec = Vector3{scale, scale, scale};
-    DrawModelEx(model, position, rotationAxis, rotationAngle, scaleVec, tint);
+    if (model != nullptr) {
+        DrawModelEx(*model, position, rotationAxis, rotationAngle, scaleVec, tint);
+    }
 }
 
 Matrix SceneObject::getTransformMatrix() const {
@@ -50,66 +52,157 @@ Scene::~Scene() {
     clear();
 }
 
-size_t Scene::addObject(Model model, Vector3 position, float scale, const std::string& name) {
+SceneObjectHandle Scene::addObject(ModelHandle model, Vector3 position, float scale, std::string_view name) {
     SceneObject obj;
-    obj.model = model;
+    obj.model = std::move(model);
     obj.position = position;
     obj.scale = scale;
-    obj.name = name;
-    objects.push_back(obj);
-    return objects.size() - 1;
+    return insert(std::move(obj), name);
 }
 
-size_t Scene::addObject(Model model, Vector3 position, Vector3 rotation, 
-                       float scale, const std::string& name) {
+SceneObjectHandle Scene::addObject(ModelHandle model, Vector3 position, Vector3 rotation, 
+                                   float scale, std::string_view name) {
     SceneObject obj;
-    obj.model = model;
+    obj.model = std::move(model);
     obj.position = position;
     obj.rotation = rotation;
     obj.scale = scale;
-    obj.name = name;
-    objects.push_back(obj);
-    return objects.size() - 1;
+    return insert(std::move(obj), name);
+}
+
+SceneObjectHandle Scene::insert(SceneObject object, std::string_view name) {
+    std::uint32_t slotIndex = 0;
+    if (freeSlots.empty()) {
+        slotIndex = static_cast<std::uint32_t>(slots.size());
+        slots.emplace_back();
+    } else {
+        slotIndex = freeSlots.back();
+        freeSlots.pop_back();
+    }
+    
+    Slot& slot = slots[slotIndex];
+    slot.denseIndex = static_cast<std::uint32_t>(objects.size());
+    const SceneObjectHandle handle{slotIndex, slot.generation};
+    
+    objects.push_back(std::move(object));
+    objectSlots.push_back(slotIndex);
+    indexName(handle, objects.back(), name);
+    return handle;
 }
 
-SceneObject& Scene::getObject(size_t index) {
-    return objects.at(index);
+bool Scene::contains(SceneObjectHandle handle) const noexcept {
+    return handle.index < slots.size() && slots[handle.index].generation == handle.generation &&
+           slots[handle.index].denseIndex != SceneObjectHandle::kInvalidIndex;
 }
 
-const SceneObject& Scene::getObject(size_t index) const {
-    return objects.at(index);
+SceneObject* Scene::getObject(SceneObjectHandle handle) {
+    return contains(handle) ? &objects[slots[handle.index].denseIndex] : nullptr;
 }
 
-SceneObject* Scene::findObjectByName(const std::string& name) {
-    auto iterator = std::find_if(objects.begin(), objects.end(), 
-        [&name](const SceneObject& obj) { return obj.name == name; });
-    return (iterator != objects.end()) ? &(*iterator) : nullptr;
+const SceneObject* Scene::getObject(SceneObjectHandle handle) const {
+    return contains(handle) ? &objects[slots[handle.index].denseIndex] : nullptr;
 }
 
-const SceneObject* Scene::findObjectByName(const std::string& name) const {
-    auto iterator = std::find_if(objects.begin(), objects.end(), 
-        [&name](const SceneObject& obj) { return obj.name == name; });
-    return (iterator != objects.end()) ? &(*iterator) : nullptr;
+SceneObjectHandle Scene::findHandleByName(std::string_view name) const {
+    const auto iterator = nameIndex.find(name);
+    return (iterator != nameIndex.end()) ? iterator->second.handle : SceneObjectHandle{};
 }
 
-void Scene::removeObject(size_t index) {
-    if (index < objects.size()) {
-        UnloadModel(objects[index].model);
-        const auto offset = static_cast<std::ptrdiff_t>(index);
-        objects.erase(objects.begin() + offset);
+SceneObject* Scene::findObjectByName(std::string_view name) {
+    return getObject(findHandleByName(name));
+}
+
+const SceneObject* Scene::findObjectByName(std::string_view name) const {
+    return getObject(findHandleByName(name));
+}
+
+bool Scene::renameObject(SceneObjectHandle handle, std::string_view name) {
+    SceneObject* object = getObject(handle);
+    if (object == nullptr) {
+        return false;
+    }
+    if (object->name == name) {
+        return true;
     }
+    
+    // Index the new name first: name may view the old interned string
+    const std::string_view previousName = object->name;
+    indexName(handle, *object, name);
+    unindexName(handle, previousName);
+    return true;
 }
 
-bool Scene::removeObjectByName(const std::string& name) {
-    auto iterator = std::find_if(objects.begin(), objects.end(), 
-        [&name](const SceneObject& obj) { return obj.name == name; });
+bool Scene::removeObject(SceneObjectHandle handle) {
+    if (!contains(handle)) {
+        return false;
+    }
     
-    if (iterator != objects.end()) {
-        UnloadModel(iterator->model);
-        objects.erase(iterator);
-        return true;
+    Slot& slot = slots[handle.index];
+    const std::uint32_t denseIndex = slot.denseIndex;
+    unindexName(handle, objects[denseIndex].name);
+    
+    // Swap-and-pop: the last object fills the gap, and its slot follows it
+    const std::uint32_t lastIndex = static_cast<std::uint32_t>(objects.size() - 1);
+    if (denseIndex != lastIndex) {
+        objects[denseIndex] = std::move(objects[lastIndex]);
+        objectSlots[denseIndex] = objectSlots[lastIndex];
+        slots[objectSlots[denseIndex]].denseIndex = denseIndex;
+    }
+    objects.pop_back();
+    objectSlots.pop_back();
+    
+    // A new generation invalidates every handle to the removed object
+    slot.denseIndex = SceneObjectHandle::kInvalidIndex;
+    ++slot.generation;
+    freeSlots.push_back(handle.index);
+    return true;
+}
+
+bool Scene::removeObjectByName(std::string_view name) {
+    return removeObject(findHandleByName(name));
+}
+
+void Scene::indexName(SceneObjectHandle handle, SceneObject& object, std::string_view name) {
+    if (name.empty()) {
+        object.name = {};
+        return;
+    }
+    
+    auto iterator = nameIndex.find(name);
+    if (iterator == nameIndex.end()) {
+        iterator = nameIndex.emplace(std::string(name), NameEntry{handle, 0}).first;
+    }
+    ++iterator->second.count;
+    object.name = iterator->first;
+}
+
+void Scene::unindexName(SceneObjectHandle handle, std::string_view name) {
+    if (name.empty()) {
+        return;
+    }
+    
+    const auto iterator = nameIndex.find(name);
+    if (iterator == nameIndex.end()) {
+        return;
+    }
+    NameEntry& entry = iterator->second;
+    if (--entry.count == 0) {
+        nameIndex.erase(iterator);
+        return;
+    }
+    if (entry.handle != handle) {
+        return;
+    }
+    
+    // The indexed object is leaving but others share the name; interned names compare by address
+    const char* interned = iterator->first.data();
+    for (size_t i = 0; i < objects.size(); ++i) {
+        const SceneObjectHandle other{objectSlots[i], slots[objectSlots[i]].generation};
+        if (objects[i].name.data() == interned && other != handle) {
+            entry.handle = other;
+            return;
+        }
     }
-    return false;
 }
 
 void Scene::draw() const {
@@ -119,11 +212,18 @@ void Scene::draw() const {
 }
 
 void Scene::clear() {
-    for (auto& obj : objects) {
-        UnloadModel(obj.model);
-    }
+    // Objects only hold model references; the AssetCache owns the GPU data
     objects.clear();
+    objectSlots.clear();
+    nameIndex.clear();
+    
+    // Slots keep their generations, so handles from before the clear stay invalid
+    freeSlots.clear();
+    for (size_t i = slots.size(); i > 0; --i) {
+        slots[i - 1].denseIndex = SceneObjectHandle::kInvalidIndex;
+        ++slots[i - 1].generation;
+        freeSlots.push_back(static_cast<std::uint32_t>(i - 1));
+    }
 }
 
 } // namespace project
-
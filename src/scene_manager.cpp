@@ -1,17 +1,31 @@
 #include <project/scene_manager.hpp>
+#include <project/memory_tracker.hpp>
+#include <project/profiler.hpp>
+#include <algorithm>
 #include <stdexcept>
 #include <iostream>
 
 namespace project {
 
+namespace {
+    // GPU upload time granted to streamed assets per frame; the rest of the frame stays interactive
+    constexpr double kAssetUploadBudgetMs = 4.0;
+} // namespace
+
 SceneManager::SceneManager() = default;
 
+SceneManager::SceneManager(AssetCache* assetCache)
+    : assetCache(assetCache) {
+}
+
 void SceneManager::registerScene(std::unique_ptr<SceneStrategy> scene) {
     if (!scene) {
         return;
     }
     
     scenes.push_back(std::move(scene));
+    residency.push_back(SceneResidency::Cold);
+    lastActivated.push_back(0);
     
     // If this is the first scene, activate it
     if (scenes.size() == 1) {
@@ -70,39 +84,147 @@ const SceneStrategy* SceneManager::getCurrentScene() const noexcept {
 }
 
 void SceneManager::update() {
-    if (auto* scene = getCurrentScene()) {
+    PROJECT_PROFILE_SCOPE("SceneManager::update");
+    
+    // Finish background loads before the scene looks at its pending requests
+    // (a step still in flight is fine: simulation never touches the cache)
+    if (assetCache != nullptr) {
+        PROJECT_PROFILE_SCOPE("AssetCache::processPendingUploads");
+        assetCache->processPendingUploads(kAssetUploadBudgetMs);
+    }
+    
+    auto* scene = getCurrentScene();
+    if (scene == nullptr) {
+        return;
+    }
+    
+    if (!isCurrentScenePipelined()) {
         scene->update();
+        return;
+    }
+    
+    // The fence: the step started last frame must be done before its frame is shown
+    // and before anything here touches the scene again
+    waitForSimulation();
+    if (publishedScene != scene) {
+        // First pipelined frame of this scene: capture the current state inline so draw()
+        // has a frame to show while the first threaded step runs
+        scene->simulate(0.0F);
+        publishedScene = scene;
+    }
+    scene->publishFrame();
+    scene->updateMainThread();
+}
+
+void SceneManager::startSimulation() {
+    auto* scene = getCurrentScene();
+    
+    // A scene switched to during this frame has not published a frame yet; it starts next frame
+    if (scene == nullptr || !isCurrentScenePipelined() || publishedScene != scene) {
+        return;
+    }
+    
+    if (!simulationThread) {
+        simulationThread = std::make_unique<SimulationThread>();
+    }
+    const float deltaTime = GetFrameTime();
+    simulationThread->start([scene, deltaTime] { scene->simulate(deltaTime); });
+}
+
+void SceneManager::setPipelined(bool enabled) {
+    if (enabled == pipelined) {
+        return;
+    }
+    
+    waitForSimulation();
+    pipelined = enabled;
+    publishedScene = nullptr;
+}
+
+bool SceneManager::isCurrentScenePipelined() const noexcept {
+    const auto* scene = getCurrentScene();
+    return pipelined && scene != nullptr && scene->supportsPipelining();
+}
+
+void SceneManager::waitForSimulation() const {
+    if (simulationThread) {
+        // The simulation thread's own scopes are not recorded; this is where its step shows up
+        PROJECT_PROFILE_SCOPE("SceneManager::waitForSimulation");
+        simulationThread->wait();
     }
 }
 
 void SceneManager::draw() const {
+    PROJECT_PROFILE_SCOPE("SceneManager::draw");
+    
     if (const auto* scene = getCurrentScene()) {
         scene->draw();
     }
 }
 
+const SceneStrategy* SceneManager::getScene(size_t index) const noexcept {
+    return (index < scenes.size()) ? scenes[index].get() : nullptr;
+}
+
+SceneResidency SceneManager::getSceneResidency(size_t index) const noexcept {
+    return (index < residency.size()) ? residency[index] : SceneResidency::Cold;
+}
+
+void SceneManager::setResidencyPolicy(const SceneResidencyPolicy& policy) {
+    residencyPolicy = policy;
+    enforceResidencyPolicy();
+    
+    if (assetCache != nullptr) {
+        assetCache->releaseUnused();
+    }
+}
+
+size_t SceneManager::getResidentMemoryEstimate() const {
+    size_t total = 0;
+    for (size_t i = 0; i < scenes.size(); ++i) {
+        if (residency[i] != SceneResidency::Cold && scenes[i]) {
+            total += scenes[i]->getMemoryEstimate();
+        }
+    }
+    return total;
+}
+
+void SceneManager::reportMemory(MemoryTracker& tracker) {
+    for (size_t i = 0; i < scenes.size(); ++i) {
+        if (residency[i] != SceneResidency::Cold && scenes[i]) {
+            scenes[i]->reportMemory(tracker);
+        }
+    }
+    
+    if (assetCache != nullptr) {
+        const AssetCache::MemoryUsage usage = assetCache->getMemoryUsage();
+        tracker.addMeasured(MemoryCategory::AssetsCpu, usage.cpuBytes);
+        tracker.addMeasured(MemoryCategory::AssetsGpu, usage.gpuBytes);
+    }
+}
+
 void SceneManager::activateScene(size_t index) {
     if (index >= scenes.size()) {
         return;
     }
     
-    // Only cleanup if we have a valid current scene and it's different from the target
+    // Scenes only change between simulation steps; the incoming one publishes its own first frame
+    waitForSimulation();
+    publishedScene = nullptr;
+    
+    // The outgoing scene stays initialized (warm) and simply stops being updated;
+    // the residency policy decides below whether it has to go
     if (currentSceneIndex < scenes.size() && 
         currentSceneIndex != index && 
-        scenes[currentSceneIndex]) {
-        try {
-            scenes[currentSceneIndex]->cleanup();
-        } catch (...) {
-            // If cleanup throws, continue anyway to prevent crash
-            // This can happen if Bullet Physics cleanup fails
-        }
+        residency[currentSceneIndex] == SceneResidency::Active) {
+        residency[currentSceneIndex] = SceneResidency::Warm;
     }
     
     // Update index
     currentSceneIndex = index;
     
-    // Initialize new scene
-    if (scenes[currentSceneIndex]) {
+    // Initialize new scene unless it is still warm
+    if (residency[currentSceneIndex] == SceneResidency::Cold && scenes[currentSceneIndex]) {
         try {
             scenes[currentSceneIndex]->initialize();
         } catch (...) {
@@ -110,6 +232,72 @@ void SceneManager::activateScene(size_t index) {
             // The scene will just be in an uninitialized state
         }
     }
+    residency[currentSceneIndex] = SceneResidency::Active;
+    lastActivated[currentSceneIndex] = ++activationCounter;
+    
+    enforceResidencyPolicy();
+    
+    // Start streaming the next scene's assets so switching to it is quick as well
+    if (residencyPolicy.preloadNext && scenes.size() > 1) {
+        const size_t nextIndex = (currentSceneIndex + 1) % scenes.size();
+        if (residency[nextIndex] == SceneResidency::Cold && scenes[nextIndex]) {
+            scenes[nextIndex]->preload();
+        }
+    }
+    
+    // Unload assets only evicted scenes used; assets shared with the incoming
+    // scene were re-acquired during initialize() and stay resident
+    if (assetCache != nullptr) {
+        const size_t released = assetCache->releaseUnused();
+        if (released > 0) {
+            std::cout << "Released " << released << " unused assets\n";
+        }
+    }
+}
+
+void SceneManager::enforceResidencyPolicy() {
+    const auto findLeastRecentlyUsedWarm = [this]() {
+        size_t found = scenes.size();
+        for (size_t i = 0; i < scenes.size(); ++i) {
+            if (residency[i] == SceneResidency::Warm &&
+                (found == scenes.size() || lastActivated[i] < lastActivated[found])) {
+                found = i;
+            }
+        }
+        return found;
+    };
+    
+    const auto countWarm = [this]() {
+        return static_cast<size_t>(std::ranges::count(residency, SceneResidency::Warm));
+    };
+    
+    while (countWarm() > residencyPolicy.maxWarmScenes) {
+        evictScene(findLeastRecentlyUsedWarm());
+    }
+    
+    if (residencyPolicy.memoryBudgetBytes == 0) {
+        return;
+    }
+    
+    // The active scene is never evicted, even if it alone exceeds the budget
+    while (getResidentMemoryEstimate() > residencyPolicy.memoryBudgetBytes) {
+        const size_t victim = findLeastRecentlyUsedWarm();
+        if (victim == scenes.size()) {
+            break;
+        }
+        evictScene(victim);
+    }
+}
+
+void SceneManager::evictScene(size_t index) {
+    std::cout << "Evicting scene " << index << " (" << scenes[index]->getName() << ")\n";
+    try {
+        scenes[index]->cleanup();
+    } catch (...) {
+        // If cleanup throws, continue anyway to prevent crash
+        // This can happen if Bullet Physics cleanup fails
+    }
+    residency[index] = SceneResidency::Cold;
 }
 
 } // namespace project
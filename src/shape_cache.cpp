@@ -0,0 +1,155 @@
+#include <project/shape_cache.hpp>
+#include <project/string_hash.hpp>
+#include <btBulletDynamicsCommon.h>
+#include <BulletCollision/CollisionShapes/btShapeHull.h>
+#include <raymath.h>
+#include <bit>
+#include <iostream>
+#include <vector>
+
+namespace project {
+
+namespace {
+    /// Pack two floats into one key word (exact bit patterns, so 0.5 and 0.5000001 differ)
+    std::uint64_t packFloats(float low, float high) noexcept {
+        return static_cast<std::uint64_t>(std::bit_cast<std::uint32_t>(low)) |
+               (static_cast<std::uint64_t>(std::bit_cast<std::uint32_t>(high)) << 32U);
+    }
+} // namespace
+
+size_t ShapeCache::ShapeKeyHash::operator()(const ShapeKey& key) const noexcept {
+    std::uint64_t hash = fnv1a(&key.type, sizeof(key.type));
+    hash = fnv1a(key.parameters, sizeof(key.parameters), hash);
+    return static_cast<size_t>(hash);
+}
+
+ShapeHandle ShapeCache::acquireBox(const Vector3& halfExtents) {
+    const ShapeKey key{ShapeType::Box, {packFloats(halfExtents.x, halfExtents.y), packFloats(halfExtents.z, 0.0F)}};
+    if (const auto iterator = shapes.find(key); iterator != shapes.end()) {
+        return iterator->second;
+    }
+
+    ShapeHandle shape(new btBoxShape(btVector3(halfExtents.x, halfExtents.y, halfExtents.z)));
+    shapes.emplace(key, shape);
+    return shape;
+}
+
+ShapeHandle ShapeCache::acquireCapsule(float radius, float height) {
+    const ShapeKey key{ShapeType::Capsule, {packFloats(radius, height), 0}};
+    if (const auto iterator = shapes.find(key); iterator != shapes.end()) {
+        return iterator->second;
+    }
+
+    ShapeHandle shape(new btCapsuleShape(static_cast<btScalar>(radius), static_cast<btScalar>(height)));
+    shapes.emplace(key, shape);
+    return shape;
+}
+
+ShapeHandle ShapeCache::acquireSphere(float radius) {
+    const ShapeKey key{ShapeType::Sphere, {packFloats(radius, 0.0F), 0}};
+    if (const auto iterator = shapes.find(key); iterator != shapes.end()) {
+        return iterator->second;
+    }
+
+    ShapeHandle shape(new btSphereShape(static_cast<btScalar>(radius)));
+    shapes.emplace(key, shape);
+    return shape;
+}
+
+ShapeHandle ShapeCache::acquireConvexHull(const Model& model) {
+    const ShapeKey key{ShapeType::ConvexHull, {hashModelGeometry(model), 0}};
+    if (const auto iterator = shapes.find(key); iterator != shapes.end()) {
+        return iterator->second;
+    }
+
+    // Gather every vertex in model space (the renderer applies model.transform as well)
+    std::vector<btVector3> points;
+    for (int meshIndex = 0; meshIndex < model.meshCount; ++meshIndex) {
+        const Mesh& mesh = model.meshes[meshIndex];
+        if (mesh.vertices == nullptr) {
+            continue;
+        }
+        for (int vertex = 0; vertex < mesh.vertexCount; ++vertex) {
+            const Vector3 point = Vector3Transform(
+                Vector3{mesh.vertices[vertex * 3], mesh.vertices[vertex * 3 + 1], mesh.vertices[vertex * 3 + 2]},
+                model.transform
+            );
+            points.emplace_back(point.x, point.y, point.z);
+        }
+    }
+
+    if (points.empty()) {
+        std::cerr << "ShapeCache: model has no CPU-side vertices, cannot build a convex hull\n";
+        return nullptr;
+    }
+
+    // A hull over thousands of render vertices is slow in narrowphase; reduce it once here
+    const btConvexHullShape rawHull(points.front().m_floats, static_cast<int>(points.size()), sizeof(btVector3));
+    btShapeHull simplifier(&rawHull);
+    simplifier.buildHull(rawHull.getMargin());
+
+    auto* hull = new btConvexHullShape(
+        simplifier.getVertexPointer()->m_floats,
+        simplifier.numVertices(),
+        sizeof(btVector3)
+    );
+    hull->optimizeConvexHull();
+
+    std::cout << "ShapeCache: convex hull built from " << points.size() << " vertices ("
+              << simplifier.numVertices() << " hull points)" << std::endl;
+
+    ShapeHandle shape(hull);
+    shapes.emplace(key, shape);
+    return shape;
+}
+
+ShapeHandle ShapeCache::acquireConvexHull(std::span<const Vector3> hullPoints) {
+    if (hullPoints.empty()) {
+        return nullptr;
+    }
+
+    const ShapeKey key{ShapeType::ConvexHull, {fnv1a(hullPoints.data(), hullPoints.size_bytes()), 0}};
+    if (const auto iterator = shapes.find(key); iterator != shapes.end()) {
+        return iterator->second;
+    }
+
+    auto* hull = new btConvexHullShape();
+    for (const Vector3& point : hullPoints) {
+        hull->addPoint(btVector3(point.x, point.y, point.z), false);
+    }
+    hull->recalcLocalAabb();
+
+    ShapeHandle shape(hull);
+    shapes.emplace(key, shape);
+    return shape;
+}
+
+size_t ShapeCache::releaseUnused() {
+    size_t released = 0;
+    for (auto iterator = shapes.begin(); iterator != shapes.end();) {
+        if (iterator->second.use_count() <= 1) {
+            iterator = shapes.erase(iterator);
+            ++released;
+        } else {
+            ++iterator;
+        }
+    }
+    return released;
+}
+
+void ShapeCache::clear() {
+    shapes.clear();
+}
+
+std::uint64_t ShapeCache::hashModelGeometry(const Model& model) {
+    std::uint64_t hash = fnv1a(&model.transform, sizeof(model.transform));
+    for (int meshIndex = 0; meshIndex < model.meshCount; ++meshIndex) {
+        const Mesh& mesh = model.meshes[meshIndex];
+        if (mesh.vertices != nullptr) {
+            hash = fnv1a(mesh.vertices, static_cast<size_t>(mesh.vertexCount) * 3 * sizeof(float), hash);
+        }
+    }
+    return hash;
+}
+
+} // namespace project
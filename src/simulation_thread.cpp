@@ -0,0 +1,55 @@
+#include <project/simulation_thread.hpp>
+#include <utility>
+
+namespace project {
+
+SimulationThread::SimulationThread()
+    : thread([this](std::stop_token stopToken) { threadLoop(stopToken); }) {
+}
+
+SimulationThread::~SimulationThread() {
+    wait();
+    thread.request_stop();
+
+    // Wake the thread without a job; it sees the stop request and exits
+    submitted.fetch_add(1, std::memory_order_release);
+    submitted.notify_one();
+}
+
+void SimulationThread::start(Job job) {
+    wait();
+    pendingJob = std::move(job);
+    submitted.fetch_add(1, std::memory_order_release);
+    submitted.notify_one();
+}
+
+void SimulationThread::wait() const {
+    const std::uint64_t target = submitted.load(std::memory_order_relaxed);
+    for (std::uint64_t done = completed.load(std::memory_order_acquire); done < target; done = completed.load(std::memory_order_acquire)) {
+        completed.wait(done, std::memory_order_acquire);
+    }
+}
+
+bool SimulationThread::isBusy() const noexcept {
+    return completed.load(std::memory_order_acquire) != submitted.load(std::memory_order_relaxed);
+}
+
+void SimulationThread::threadLoop(std::stop_token stopToken) {
+    std::uint64_t done = 0;
+    while (true) {
+        submitted.wait(done, std::memory_order_acquire);
+        if (stopToken.stop_requested()) {
+            return;
+        }
+
+        pendingJob();
+        pendingJob = nullptr;
+        ++done;
+
+        // Release: everything the job wrote is visible to the thread that sees the new count
+        completed.store(done, std::memory_order_release);
+        completed.notify_all();
+    }
+}
+
+} // namespace project
@@ -0,0 +1,189 @@
+#include <project/spatial_query.hpp>
+#include <btBulletDynamicsCommon.h>
+#include <LinearMath/btThreads.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+
+namespace project {
+
+namespace {
+    // Rays per scheduler task; one ray is far too little work to hand to another thread
+    constexpr int kRayBatchGrainSize = 64;
+
+    btVector3 toBullet(const Vector3& vector) {
+        return btVector3(vector.x, vector.y, vector.z);
+    }
+
+    Vector3 toRaylib(const btVector3& vector) {
+        return Vector3{vector.x(), vector.y(), vector.z()};
+    }
+
+    /// Entity stored on the body by PhysicsWorld::createBody (entt::null for foreign bodies)
+    entt::entity getEntity(const btCollisionObject* object) {
+        return static_cast<entt::entity>(static_cast<std::uint32_t>(object->getUserIndex()));
+    }
+
+    /// Collects every broadphase proxy whose AABB passes a filter
+    template <typename Filter>
+    struct AabbCollector : btBroadphaseAabbCallback {
+        explicit AabbCollector(Filter filter) : filter(filter) {}
+
+        bool process(const btBroadphaseProxy* proxy) override {
+            const auto* object = static_cast<const btCollisionObject*>(proxy->m_clientObject);
+            const entt::entity entity = getEntity(object);
+            if (entity != entt::null && filter(*proxy, *object)) {
+                entities.push_back(entity);
+            }
+            return true;  // Keep walking
+        }
+
+        Filter filter;
+        std::vector<entt::entity> entities;
+    };
+
+    template <typename Filter>
+    std::vector<entt::entity> collectAabb(btCollisionWorld* world, const btVector3& min, const btVector3& max, Filter filter) {
+        AabbCollector<Filter> collector(filter);
+        world->getBroadphase()->aabbTest(min, max, collector);
+        return std::move(collector.entities);
+    }
+
+    /// Squared distance from a point to an AABB (0 inside)
+    float distanceSquaredToAabb(const btVector3& point, const btVector3& min, const btVector3& max) {
+        float distanceSquared = 0.0F;
+        for (int axis = 0; axis < 3; ++axis) {
+            const float value = point.m_floats[axis];
+            const float clamped = std::clamp(value, min.m_floats[axis], max.m_floats[axis]);
+            distanceSquared += (value - clamped) * (value - clamped);
+        }
+        return distanceSquared;
+    }
+
+    /// Scheduler task casting a slice of a ray batch
+    class RayBatchBody final : public btIParallelForBody {
+    public:
+        RayBatchBody(const SpatialQuery& query, std::span<const RaySegment> rays, std::vector<RayHit>& hits)
+            : query(query)
+            , rays(rays)
+            , hits(hits) {
+        }
+
+        void forLoop(int iBegin, int iEnd) const override {
+            // Every task writes a disjoint range of hits
+            for (int i = iBegin; i < iEnd; ++i) {
+                const auto index = static_cast<size_t>(i);
+                hits[index] = query.raycast(rays[index].from, rays[index].to);
+            }
+        }
+
+    private:
+        const SpatialQuery& query;
+        std::span<const RaySegment> rays;
+        std::vector<RayHit>& hits;
+    };
+} // namespace
+
+RayHit SpatialQuery::raycast(const Vector3& from, const Vector3& to) const {
+    RayHit result;
+    if (world == nullptr) {
+        return result;
+    }
+
+    const btVector3 rayFrom = toBullet(from);
+    const btVector3 rayTo = toBullet(to);
+    btCollisionWorld::ClosestRayResultCallback callback(rayFrom, rayTo);
+    world->rayTest(rayFrom, rayTo, callback);
+    if (!callback.hasHit()) {
+        return result;
+    }
+
+    result.entity = getEntity(callback.m_collisionObject);
+    result.point = toRaylib(callback.m_hitPointWorld);
+    result.normal = toRaylib(callback.m_hitNormalWorld);
+    result.fraction = callback.m_closestHitFraction;
+    result.hit = true;
+    return result;
+}
+
+void SpatialQuery::raycastBatch(std::span<const RaySegment> rays, std::vector<RayHit>& hits) const {
+    hits.assign(rays.size(), RayHit{});
+    if (world == nullptr || rays.empty()) {
+        return;
+    }
+
+    // Runs inline with the sequential scheduler (single-threaded Bullet builds); the
+    // broadphase keeps a ray stack per scheduler thread in thread-safe builds
+    const RayBatchBody body(*this, rays, hits);
+    btParallelFor(0, static_cast<int>(rays.size()), kRayBatchGrainSize, body);
+}
+
+std::vector<entt::entity> SpatialQuery::overlapSphere(const Vector3& center, float radius) const {
+    if (world == nullptr) {
+        return {};
+    }
+
+    const btVector3 point = toBullet(center);
+    const btVector3 extent(radius, radius, radius);
+    const float radiusSquared = radius * radius;
+    return collectAabb(world, point - extent, point + extent,
+        [point, radiusSquared](const btBroadphaseProxy& proxy, const btCollisionObject&) {
+            return distanceSquaredToAabb(point, proxy.m_aabbMin, proxy.m_aabbMax) <= radiusSquared;
+        });
+}
+
+std::vector<entt::entity> SpatialQuery::overlapBox(const Vector3& center, const Vector3& halfExtents) const {
+    if (world == nullptr) {
+        return {};
+    }
+
+    // The broadphase already culls by AABB, which is exactly this test
+    const btVector3 point = toBullet(center);
+    const btVector3 extent = toBullet(halfExtents);
+    return collectAabb(world, point - extent, point + extent,
+        [](const btBroadphaseProxy&, const btCollisionObject&) { return true; });
+}
+
+std::vector<NearestHit> SpatialQuery::nearest(const Vector3& point, size_t count, float maxDistance) const {
+    std::vector<NearestHit> results;
+    if (world == nullptr || count == 0) {
+        return results;
+    }
+
+    const btVector3 origin = toBullet(point);
+    const btVector3 extent(maxDistance, maxDistance, maxDistance);
+    const float maxDistanceSquared = maxDistance * maxDistance;
+
+    struct NearestCollector : btBroadphaseAabbCallback {
+        bool process(const btBroadphaseProxy* proxy) override {
+            const auto* object = static_cast<const btCollisionObject*>(proxy->m_clientObject);
+            const entt::entity entity = getEntity(object);
+            const float distanceSquared = (object->getWorldTransform().getOrigin() - origin).length2();
+            if (entity != entt::null && distanceSquared <= maxDistanceSquared) {
+                hits->push_back(NearestHit{entity, distanceSquared});
+            }
+            return true;
+        }
+
+        btVector3 origin;
+        float maxDistanceSquared{0.0F};
+        std::vector<NearestHit>* hits{nullptr};
+    } collector;
+    collector.origin = origin;
+    collector.maxDistanceSquared = maxDistanceSquared;
+    collector.hits = &results;
+    world->getBroadphase()->aabbTest(origin - extent, origin + extent, collector);
+
+    // Distances are squared until the survivors are known
+    const auto byDistance = [](const NearestHit& a, const NearestHit& b) { return a.distance < b.distance; };
+    const size_t kept = std::min(count, results.size());
+    std::partial_sort(results.begin(), results.begin() + static_cast<std::ptrdiff_t>(kept), results.end(), byDistance);
+    results.resize(kept);
+    for (NearestHit& hit : results) {
+        hit.distance = std::sqrt(hit.distance);
+    }
+    return results;
+}
+
+} // namespace project
@@ -0,0 +1,255 @@
+#include <project/static_batch.hpp>
+#include <project/profiler.hpp>
+#include <raymath.h>
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <unordered_map>
+
+namespace project {
+
+namespace {
+    // raylib meshes use 16-bit indices
+    constexpr size_t kMaxChunkVertices = 65535;
+
+    /// Vertex streams of a chunk being filled
+    struct ChunkBuilder {
+        Material material{};
+        std::vector<float> positions;
+        std::vector<float> normals;
+        std::vector<float> texcoords;
+        std::vector<unsigned char> colors;
+        std::vector<unsigned short> indices;
+        BoundingBox bounds{};
+
+        [[nodiscard]] size_t getVertexCount() const noexcept { return positions.size() / 3; }
+    };
+
+    /// GPU state a chunk binds; meshes agreeing on it can share a draw
+    struct GroupKey {
+        unsigned int shaderId{0};
+        unsigned int textureId{0};
+
+        bool operator==(const GroupKey&) const = default;
+    };
+
+    struct GroupKeyHash {
+        size_t operator()(const GroupKey& key) const noexcept {
+            return std::hash<unsigned int>{}(key.shaderId) ^ (std::hash<unsigned int>{}(key.textureId) << 1U);
+        }
+    };
+
+    /// A source mesh placed in the world
+    struct MeshInstance {
+        const Mesh* mesh{nullptr};
+        Matrix world{};
+        Matrix normalMatrix{};  // Inverse transpose of world
+        Color color{WHITE};     // Material color times entity tint
+    };
+
+    /// Copy a stream into memory raylib frees with RL_FREE in UnloadMesh
+    template <typename T>
+    T* copyStream(const std::vector<T>& stream) {
+        auto* data = static_cast<T*>(RL_MALLOC(stream.size() * sizeof(T)));
+        std::memcpy(data, stream.data(), stream.size() * sizeof(T));
+        return data;
+    }
+
+    /// Append one vertex of a source mesh, transformed to world space
+    void appendVertex(ChunkBuilder& builder, const MeshInstance& instance, size_t vertex) {
+        const Mesh& mesh = *instance.mesh;
+
+        const float* source = &mesh.vertices[vertex * 3];
+        const Vector3 position = Vector3Transform(Vector3{source[0], source[1], source[2]}, instance.world);
+        if (builder.positions.empty()) {
+            builder.bounds = BoundingBox{position, position};
+        } else {
+            builder.bounds.min = Vector3Min(builder.bounds.min, position);
+            builder.bounds.max = Vector3Max(builder.bounds.max, position);
+        }
+        builder.positions.insert(builder.positions.end(), {position.x, position.y, position.z});
+
+        Vector3 normal{0.0F, 1.0F, 0.0F};
+        if (mesh.normals != nullptr) {
+            const float* sourceNormal = &mesh.normals[vertex * 3];
+            // The inverse transpose of an affine matrix has no translation, so this only rotates and scales
+            normal = Vector3Normalize(Vector3Transform(Vector3{sourceNormal[0], sourceNormal[1], sourceNormal[2]}, instance.normalMatrix));
+        }
+        builder.normals.insert(builder.normals.end(), {normal.x, normal.y, normal.z});
+
+        if (mesh.texcoords != nullptr) {
+            builder.texcoords.insert(builder.texcoords.end(), {mesh.texcoords[vertex * 2], mesh.texcoords[(vertex * 2) + 1]});
+        } else {
+            builder.texcoords.insert(builder.texcoords.end(), {0.0F, 0.0F});
+        }
+
+        Color color = instance.color;
+        if (mesh.colors != nullptr) {
+            const unsigned char* sourceColor = &mesh.colors[vertex * 4];
+            color = ColorTint(Color{sourceColor[0], sourceColor[1], sourceColor[2], sourceColor[3]}, instance.color);
+        }
+        builder.colors.insert(builder.colors.end(), {color.r, color.g, color.b, color.a});
+    }
+
+    /// Append a source mesh, calling flush whenever the chunk would overflow
+    void appendMesh(ChunkBuilder& builder, const MeshInstance& instance, const std::function<void(ChunkBuilder&)>& flush) {
+        const Mesh& mesh = *instance.mesh;
+        const auto vertexCount = static_cast<size_t>(mesh.vertexCount);
+        if (vertexCount == 0 || mesh.vertices == nullptr) {
+            return;
+        }
+
+        if (vertexCount <= kMaxChunkVertices) {
+            if (builder.getVertexCount() + vertexCount > kMaxChunkVertices) {
+                flush(builder);
+            }
+            const size_t base = builder.getVertexCount();
+            for (size_t vertex = 0; vertex < vertexCount; ++vertex) {
+                appendVertex(builder, instance, vertex);
+            }
+            const size_t indexCount = (mesh.indices != nullptr) ? static_cast<size_t>(mesh.triangleCount) * 3 : vertexCount;
+            for (size_t i = 0; i < indexCount; ++i) {
+                const size_t vertex = (mesh.indices != nullptr) ? mesh.indices[i] : i;
+                builder.indices.push_back(static_cast<unsigned short>(base + vertex));
+            }
+            return;
+        }
+
+        // Too large for one chunk: split it triangle by triangle
+        for (size_t triangle = 0; triangle < static_cast<size_t>(mesh.triangleCount); ++triangle) {
+            if (builder.getVertexCount() + 3 > kMaxChunkVertices) {
+                flush(builder);
+            }
+            for (size_t corner = 0; corner < 3; ++corner) {
+                const size_t i = (triangle * 3) + corner;
+                builder.indices.push_back(static_cast<unsigned short>(builder.getVertexCount()));
+                appendVertex(builder, instance, (mesh.indices != nullptr) ? mesh.indices[i] : i);
+            }
+        }
+    }
+} // namespace
+
+StaticBatch::~StaticBatch() {
+    clear();
+}
+
+void StaticBatch::build(const entt::registry& registry) {
+    PROJECT_PROFILE_SCOPE("StaticBatch::build");
+
+    clear();
+    dirty = false;
+
+    const auto flush = [this](ChunkBuilder& builder) {
+        if (builder.positions.empty()) {
+            return;
+        }
+
+        Chunk& chunk = chunks.emplace_back();
+        chunk.material = builder.material;
+        chunk.bounds = builder.bounds;
+
+        Mesh& mesh = chunk.mesh;
+        mesh.vertexCount = static_cast<int>(builder.getVertexCount());
+        mesh.triangleCount = static_cast<int>(builder.indices.size() / 3);
+        mesh.vertices = copyStream(builder.positions);
+        mesh.normals = copyStream(builder.normals);
+        mesh.texcoords = copyStream(builder.texcoords);
+        mesh.colors = copyStream(builder.colors);
+        mesh.indices = copyStream(builder.indices);
+        UploadMesh(&mesh, false);
+
+        builder.positions.clear();
+        builder.normals.clear();
+        builder.texcoords.clear();
+        builder.colors.clear();
+        builder.indices.clear();
+    };
+
+    std::unordered_map<GroupKey, ChunkBuilder, GroupKeyHash> builders;
+    auto view = registry.view<const Transform, const Renderable, const StaticMesh>();
+    for (auto entity : view) {
+        const auto& renderable = view.get<Renderable>(entity);
+        if (!renderable.hasModel) {
+            continue;
+        }
+        if (std::ranges::find(sourceModels, renderable.model) == sourceModels.end()) {
+            sourceModels.push_back(renderable.model);
+        }
+        ++entityCount;
+
+        // Same placement RenderSystem::draw uses, including its fallback for an invalid scale
+        const Transform& transform = view.get<Transform>(entity);
+        const bool validScale = transform.scale.x > 0.0F && transform.scale.y > 0.0F && transform.scale.z > 0.0F;
+        const Matrix entityMatrix = validScale
+            ? transform.getMatrix()
+            : MatrixTranslate(transform.position.x, transform.position.y, transform.position.z);
+
+        const Model& model = *renderable.model;
+        MeshInstance instance;
+        instance.world = MatrixMultiply(model.transform, entityMatrix);
+        instance.normalMatrix = MatrixTranspose(MatrixInvert(instance.world));
+
+        for (int i = 0; i < model.meshCount; ++i) {
+            const Material& material = model.materials[model.meshMaterial[i]];
+            const GroupKey key{material.shader.id, material.maps[MATERIAL_MAP_ALBEDO].texture.id};
+            auto [builderIt, inserted] = builders.try_emplace(key);
+            if (inserted) {
+                builderIt->second.material = material;
+            }
+
+            instance.mesh = &model.meshes[i];
+            instance.color = ColorTint(material.maps[MATERIAL_MAP_DIFFUSE].color, renderable.color);
+            appendMesh(builderIt->second, instance, flush);
+            ++sourceMeshCount;
+        }
+    }
+
+    for (auto& [key, builder] : builders) {
+        flush(builder);
+    }
+}
+
+void StaticBatch::clear() {
+    for (Chunk& chunk : chunks) {
+        UnloadMesh(chunk.mesh);
+    }
+    chunks.clear();
+    sourceModels.clear();
+    entityCount = 0;
+    sourceMeshCount = 0;
+    dirty = true;
+}
+
+size_t StaticBatch::getMeshBytes() const noexcept {
+    // Position, normal and texcoord floats plus RGBA8 colors per vertex, 16-bit indices
+    constexpr size_t kBytesPerVertex = (3 + 3 + 2) * sizeof(float) + 4;
+    size_t bytes = 0;
+    for (const Chunk& chunk : chunks) {
+        bytes += static_cast<size_t>(chunk.mesh.vertexCount) * kBytesPerVertex;
+        bytes += static_cast<size_t>(chunk.mesh.triangleCount) * 3 * sizeof(unsigned short);
+    }
+    return bytes;
+}
+
+void StaticBatch::draw(const Frustum* frustum, CullingStats* stats) const {
+    PROJECT_PROFILE_SCOPE("StaticBatch::draw");
+
+    for (const Chunk& chunk : chunks) {
+        const bool visible = (frustum == nullptr) || frustum->intersects(chunk.bounds);
+        if (stats != nullptr) {
+            ++(visible ? stats->drawn : stats->culled);
+        }
+        if (!visible) {
+            continue;
+        }
+
+        // Colors are baked into the vertices; the material is shared, so restore it afterwards
+        Color& diffuseColor = chunk.material.maps[MATERIAL_MAP_DIFFUSE].color;
+        const Color originalColor = diffuseColor;
+        diffuseColor = WHITE;
+        DrawMesh(chunk.mesh, chunk.material, MatrixIdentity());
+        diffuseColor = originalColor;
+    }
+}
+
+} // namespace project
@@ -0,0 +1,74 @@
+#include <project/system_scheduler.hpp>
+#include <project/profiler.hpp>
+
+namespace project {
+
+bool SystemAccess::conflictsWith(const SystemAccess& other) const {
+    if (isExclusive || other.isExclusive) {
+        return true;
+    }
+    return intersects(writeSet, other.writeSet) || intersects(writeSet, other.readSet) || intersects(readSet, other.writeSet);
+}
+
+void SystemAccess::prepare(entt::registry& registry) const {
+    for (const auto& entry : readSet) {
+        entry.createStorage(registry);
+    }
+    for (const auto& entry : writeSet) {
+        entry.createStorage(registry);
+    }
+}
+
+bool SystemAccess::intersects(const std::vector<ComponentEntry>& lhs, const std::vector<ComponentEntry>& rhs) {
+    // A handful of components per system; a linear scan beats building sets
+    return std::ranges::any_of(lhs, [&rhs](const ComponentEntry& left) {
+        return std::ranges::any_of(rhs, [&left](const ComponentEntry& right) { return left.id == right.id; });
+    });
+}
+
+void SystemScheduler::add(std::string name, SystemAccess access, SystemFunction function) {
+    size_t stage = 0;
+    for (const auto& earlier : systems) {
+        if (earlier.stage >= stage && earlier.access.conflictsWith(access)) {
+            stage = earlier.stage + 1;
+        }
+    }
+
+    if (stage == stages.size()) {
+        stages.emplace_back();
+    }
+    stages[stage].push_back(systems.size());
+    systems.push_back(System{std::move(name), std::move(access), std::move(function), stage});
+}
+
+void SystemScheduler::clear() {
+    systems.clear();
+    stages.clear();
+}
+
+void SystemScheduler::run(entt::registry& registry, TaskPool& taskPool) {
+    PROJECT_PROFILE_SCOPE("SystemScheduler::run");
+
+    // Storage creation edits the registry, so it happens before anything runs concurrently
+    for (const auto& system : systems) {
+        system.access.prepare(registry);
+    }
+
+    for (const auto& stage : stages) {
+        if (stage.size() == 1) {
+            systems[stage.front()].function(registry);
+            continue;
+        }
+
+        // The calling thread runs the first system and then helps with the rest
+        TaskGroup group;
+        for (size_t i = 1; i < stage.size(); ++i) {
+            const System& system = systems[stage[i]];
+            taskPool.run(group, [&system, &registry] { system.function(registry); });
+        }
+        systems[stage.front()].function(registry);
+        taskPool.wait(group);
+    }
+}
+
+} // namespace project
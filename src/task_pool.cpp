@@ -0,0 +1,146 @@
+#include <project/task_pool.hpp>
+#include <algorithm>
+
+namespace project {
+
+namespace {
+    // Chunks per thread in parallelFor; a few more than one lets fast threads steal from slow ones
+    constexpr size_t kChunksPerThread = 4;
+
+    // Pool and queue of the calling thread, set once in every worker
+    thread_local const TaskPool* currentPool = nullptr;
+    thread_local size_t currentQueue = 0;
+} // namespace
+
+TaskPool::TaskPool(size_t workerCount) {
+    queues.reserve(workerCount + 1);
+    for (size_t i = 0; i <= workerCount; ++i) {
+        queues.push_back(std::make_unique<Queue>());
+    }
+
+    workers.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; ++i) {
+        workers.emplace_back([this, i](std::stop_token stopToken) { workerLoop(stopToken, i + 1); });
+    }
+}
+
+TaskPool::~TaskPool() {
+    for (auto& worker : workers) {
+        worker.request_stop();
+    }
+    wakeCondition.notify_all();
+    workers.clear();
+}
+
+void TaskPool::run(TaskGroup& group, Task task) {
+    if (workers.empty()) {
+        task();
+        return;
+    }
+
+    group.pending.fetch_add(1, std::memory_order_relaxed);
+    Queue& queue = *queues[getHomeQueue()];
+    {
+        const std::scoped_lock lock(queue.mutex);
+        queue.tasks.push_back(QueuedTask{std::move(task), &group});
+    }
+    queuedCount.fetch_add(1, std::memory_order_release);
+
+    // Taking the lock orders the notify after a sleeping worker's last check of queuedCount
+    { const std::scoped_lock lock(sleepMutex); }
+    wakeCondition.notify_one();
+}
+
+void TaskPool::wait(TaskGroup& group) {
+    const size_t homeQueue = getHomeQueue();
+    while (!group.isDone()) {
+        if (runOne(homeQueue)) {
+            continue;
+        }
+
+        // The remaining tasks are running on other threads: sleep until a group finishes
+        std::unique_lock lock(doneMutex);
+        doneCondition.wait(lock, [&group] { return group.isDone(); });
+    }
+}
+
+void TaskPool::parallelFor(size_t begin, size_t end, size_t grainSize, const std::function<void(size_t, size_t)>& body) {
+    if (begin >= end) {
+        return;
+    }
+
+    const size_t count = end - begin;
+    const size_t threadCount = workers.size() + 1;
+    const size_t chunkSize = std::max({grainSize, size_t{1}, (count + (threadCount * kChunksPerThread) - 1) / (threadCount * kChunksPerThread)});
+    if (workers.empty() || count <= chunkSize) {
+        body(begin, end);
+        return;
+    }
+
+    TaskGroup group;
+    for (size_t chunkBegin = begin + chunkSize; chunkBegin < end; chunkBegin += chunkSize) {
+        const size_t chunkEnd = std::min(chunkBegin + chunkSize, end);
+        run(group, [&body, chunkBegin, chunkEnd] { body(chunkBegin, chunkEnd); });
+    }
+    body(begin, begin + chunkSize);
+    wait(group);
+}
+
+size_t TaskPool::getDefaultWorkerCount() noexcept {
+    const unsigned int hardwareThreads = std::thread::hardware_concurrency();
+    return (hardwareThreads > 1) ? hardwareThreads - 1 : 0;
+}
+
+void TaskPool::workerLoop(std::stop_token stopToken, size_t queueIndex) {
+    currentPool = this;
+    currentQueue = queueIndex;
+
+    while (!stopToken.stop_requested()) {
+        if (runOne(queueIndex)) {
+            continue;
+        }
+        std::unique_lock lock(sleepMutex);
+        wakeCondition.wait(lock, stopToken, [this] { return queuedCount.load(std::memory_order_acquire) > 0; });
+    }
+}
+
+bool TaskPool::runOne(size_t homeQueue) {
+    QueuedTask next;
+    bool found = false;
+
+    // Own queue newest first (its data is still in cache), then the oldest task of the others
+    for (size_t offset = 0; offset < queues.size() && !found; ++offset) {
+        Queue& queue = *queues[(homeQueue + offset) % queues.size()];
+        const std::scoped_lock lock(queue.mutex);
+        if (queue.tasks.empty()) {
+            continue;
+        }
+        if (offset == 0 && homeQueue != 0) {
+            next = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+        } else {
+            next = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+        }
+        found = true;
+    }
+    if (!found) {
+        return false;
+    }
+
+    queuedCount.fetch_sub(1, std::memory_order_relaxed);
+    next.task();
+
+    // The waiter may free the group as soon as it reads zero, so only the pool is touched after
+    if (next.group->pending.fetch_sub(1, std::memory_order_release) == 1) {
+        const std::scoped_lock lock(doneMutex);
+        doneCondition.notify_all();
+    }
+    return true;
+}
+
+size_t TaskPool::getHomeQueue() const noexcept {
+    return (currentPool == this) ? currentQueue : 0;
+}
+
+} // namespace project
@@ -0,0 +1,171 @@
+#include <project/transform_pool.hpp>
+#include <project/simd_lanes.hpp>
+#include <raymath.h>
+#include <algorithm>
+#include <cmath>
+
+namespace project {
+
+namespace {
+    using namespace simd;
+
+    constexpr const char* kKernelName = kInstructionSetName;
+    constexpr size_t kFloatsPerMatrix = 16;
+    constexpr float kLastRow[4] = {0.0F, 0.0F, 0.0F, 1.0F};
+
+    static_assert(sizeof(Matrix) == kFloatsPerMatrix * sizeof(float), "Matrix must be 16 packed floats");
+} // namespace
+
+void TransformPool::clear() noexcept {
+    for (auto& stream : streams) {
+        stream.clear();
+    }
+    entities.clear();
+    matrices.clear();
+}
+
+void TransformPool::reserve(size_t count) {
+    for (auto& stream : streams) {
+        stream.reserve(count);
+    }
+    entities.reserve(count);
+    matrices.reserve(count);
+}
+
+void TransformPool::push(entt::entity entity, const Transform& transform) {
+    push(entity, transform, PreviousTransform{transform.position, transform.rotation});
+}
+
+void TransformPool::push(entt::entity entity, const Transform& transform, const PreviousTransform& previous) {
+    streams[PositionX].push_back(transform.position.x);
+    streams[PositionY].push_back(transform.position.y);
+    streams[PositionZ].push_back(transform.position.z);
+    streams[RotationX].push_back(transform.rotation.x);
+    streams[RotationY].push_back(transform.rotation.y);
+    streams[RotationZ].push_back(transform.rotation.z);
+    streams[RotationW].push_back(transform.rotation.w);
+    streams[ScaleX].push_back(transform.scale.x);
+    streams[ScaleY].push_back(transform.scale.y);
+    streams[ScaleZ].push_back(transform.scale.z);
+    streams[PreviousPositionX].push_back(previous.position.x);
+    streams[PreviousPositionY].push_back(previous.position.y);
+    streams[PreviousPositionZ].push_back(previous.position.z);
+    streams[PreviousRotationX].push_back(previous.rotation.x);
+    streams[PreviousRotationY].push_back(previous.rotation.y);
+    streams[PreviousRotationZ].push_back(previous.rotation.z);
+    streams[PreviousRotationW].push_back(previous.rotation.w);
+    entities.push_back(entity);
+}
+
+void TransformPool::buildMatrices(float interpolationAlpha) {
+    const size_t count = entities.size();
+    const bool blend = interpolationAlpha < 1.0F;
+    const float alpha = std::max(interpolationAlpha, 0.0F);
+    matrices.resize(count);
+
+    size_t index = 0;
+#if defined(PROJECT_SIMD_SSE2) || defined(PROJECT_SIMD_NEON)
+    const Lanes one = splat(1.0F);
+    const Lanes two = splat(2.0F);
+    const Lanes blendFactor = splat(alpha);
+    const auto lerp = [blendFactor](Lanes from, Lanes to) { return add(from, mul(sub(to, from), blendFactor)); };
+
+    for (; index + kLaneCount <= count; index += kLaneCount) {
+        const auto stream = [this, index](Stream component) { return load(streams[component].data() + index); };
+
+        Lanes px = stream(PositionX);
+        Lanes py = stream(PositionY);
+        Lanes pz = stream(PositionZ);
+        Lanes qx = stream(RotationX);
+        Lanes qy = stream(RotationY);
+        Lanes qz = stream(RotationZ);
+        Lanes qw = stream(RotationW);
+
+        if (blend) {
+            px = lerp(stream(PreviousPositionX), px);
+            py = lerp(stream(PreviousPositionY), py);
+            pz = lerp(stream(PreviousPositionZ), pz);
+
+            // Take the short way round: flip the target where the quaternions point apart
+            const Lanes rx = stream(PreviousRotationX);
+            const Lanes ry = stream(PreviousRotationY);
+            const Lanes rz = stream(PreviousRotationZ);
+            const Lanes rw = stream(PreviousRotationW);
+            const Lanes sign = signBits(add(add(mul(rx, qx), mul(ry, qy)), add(mul(rz, qz), mul(rw, qw))));
+            qx = lerp(rx, flipSign(qx, sign));
+            qy = lerp(ry, flipSign(qy, sign));
+            qz = lerp(rz, flipSign(qz, sign));
+            qw = lerp(rw, flipSign(qw, sign));
+
+            const Lanes inverseLength = reciprocalSqrt(add(add(mul(qx, qx), mul(qy, qy)), add(mul(qz, qz), mul(qw, qw))));
+            qx = mul(qx, inverseLength);
+            qy = mul(qy, inverseLength);
+            qz = mul(qz, inverseLength);
+            qw = mul(qw, inverseLength);
+        }
+
+        // Same terms as Transform::getMatrix, four entities per instruction
+        const Lanes xx = mul(qx, qx);
+        const Lanes yy = mul(qy, qy);
+        const Lanes zz = mul(qz, qz);
+        const Lanes xy = mul(qx, qy);
+        const Lanes xz = mul(qx, qz);
+        const Lanes yz = mul(qy, qz);
+        const Lanes wx = mul(qw, qx);
+        const Lanes wy = mul(qw, qy);
+        const Lanes wz = mul(qw, qz);
+        const Lanes sx = stream(ScaleX);
+        const Lanes sy = stream(ScaleY);
+        const Lanes sz = stream(ScaleZ);
+
+        float* rows = &matrices[index].m0;
+        storeRows(mul(sub(one, mul(two, add(yy, zz))), sx),
+                  mul(mul(two, sub(xy, wz)), sy),
+                  mul(mul(two, add(xz, wy)), sz),
+                  px,
+                  rows);
+        storeRows(mul(mul(two, add(xy, wz)), sx),
+                  mul(sub(one, mul(two, add(xx, zz))), sy),
+                  mul(mul(two, sub(yz, wx)), sz),
+                  py,
+                  rows + 4);
+        storeRows(mul(mul(two, sub(xz, wy)), sx),
+                  mul(mul(two, add(yz, wx)), sy),
+                  mul(sub(one, mul(two, add(xx, yy))), sz),
+                  pz,
+                  rows + 8);
+        for (size_t lane = 0; lane < kLaneCount; ++lane) {
+            storeRow(kLastRow, rows + (lane * kFloatsPerMatrix) + 12);
+        }
+    }
+#endif
+
+    // Remainder (everything on targets without a vector kernel)
+    for (; index < count; ++index) {
+        Transform transform;
+        transform.position = Vector3{streams[PositionX][index], streams[PositionY][index], streams[PositionZ][index]};
+        transform.rotation = Quaternion{streams[RotationX][index], streams[RotationY][index], streams[RotationZ][index], streams[RotationW][index]};
+        transform.scale = Vector3{streams[ScaleX][index], streams[ScaleY][index], streams[ScaleZ][index]};
+
+        if (blend) {
+            const Vector3 previousPosition{streams[PreviousPositionX][index], streams[PreviousPositionY][index], streams[PreviousPositionZ][index]};
+            const Quaternion previousRotation{streams[PreviousRotationX][index], streams[PreviousRotationY][index], streams[PreviousRotationZ][index], streams[PreviousRotationW][index]};
+            Quaternion target = transform.rotation;
+            const float dot = (previousRotation.x * target.x) + (previousRotation.y * target.y) +
+                              (previousRotation.z * target.z) + (previousRotation.w * target.w);
+            if (dot < 0.0F) {
+                target = Quaternion{-target.x, -target.y, -target.z, -target.w};
+            }
+            transform.position = Vector3Lerp(previousPosition, transform.position, alpha);
+            transform.rotation = QuaternionNormalize(QuaternionLerp(previousRotation, target, alpha));
+        }
+
+        matrices[index] = transform.getMatrix();
+    }
+}
+
+const char* TransformPool::getKernelName() noexcept {
+    return kKernelName;
+}
+
+} // namespace project
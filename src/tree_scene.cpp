@@ -1,10 +1,14 @@
 #include <project/tree_scene.hpp>
+#include <algorithm>
 #include <iostream>
+#include <utility>
+#include <vector>
 
 namespace project {
 
-TreeScene::TreeScene(const std::string& modelPath) 
-    : modelPath(modelPath) {
+TreeScene::TreeScene(AssetCache& assetCache, const std::string& modelPath) 
+    : assetCache(&assetCache)
+    , modelPath(modelPath) {
 }
 
 TreeScene::~TreeScene() {
@@ -16,36 +20,59 @@ void TreeScene::initialize() {
         return;
     }
     
-    // Check if model file exists
-    if (!FileExists(modelPath.c_str())) {
-        std::cerr << "Model file not found: " << modelPath << '\n';
-        return;
-    }
-    
-    // Load the 3D model
+    // Load the 3D model in the background (completes at once if it is cached or was preloaded)
     std::cout << "Loading model: " << modelPath << '\n';
-    Model model = LoadModel(modelPath.c_str());
+    if (modelRequest == nullptr) {
+        modelRequest = assetCache->requestModel(modelPath);
+    }
     
-    if (!IsModelValid(model)) {
-        std::cerr << "Failed to load model: " << modelPath << '\n';
+    isInitialized = true;
+    update();
+}
+
+void TreeScene::update() {
+    if (!isInitialized || modelRequest == nullptr || !modelRequest->isDone()) {
         return;
     }
     
-    std::cout << "Model loaded successfully!\n";
-    
-    // Add the model to the scene at the origin
-    scene.addObject(model, Vector3{0.0F, 0.0F, 0.0F}, kModelScale, "tree-main");
-    
-    isInitialized = true;
+    if (modelRequest->getStatus() == ModelRequest::Status::Ready) {
+        std::cout << "Model loaded successfully!\n";
+        
+        // Add the model to the scene at the origin
+        (void)scene.addObject(modelRequest->getModel(), Vector3{0.0F, 0.0F, 0.0F}, kModelScale, "tree-main");
+    } else {
+        std::cerr << "Failed to load model: " << modelPath << '\n';
+    }
+    modelRequest.reset();
 }
 
 void TreeScene::cleanup() {
+    modelRequest.reset();
     if (isInitialized) {
         scene.clear();
         isInitialized = false;
     }
 }
 
+void TreeScene::preload() {
+    if (!isInitialized && modelRequest == nullptr) {
+        modelRequest = assetCache->requestModel(modelPath);
+    }
+}
+
+size_t TreeScene::getMemoryEstimate() const {
+    std::vector<const Model*> models;
+    size_t bytes = 0;
+    for (const SceneObject& object : scene.getObjects()) {
+        const Model* model = object.model.get();
+        if (model != nullptr && std::ranges::find(models, model) == models.end()) {
+            models.push_back(model);
+            bytes += AssetCache::estimateModelBytes(*model);
+        }
+    }
+    return bytes;
+}
+
 void TreeScene::draw() const {
     if (isInitialized) {
         scene.draw();
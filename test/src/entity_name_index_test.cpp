@@ -0,0 +1,101 @@
+#include "project/entity_name_index.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+TEST(EntityNameIndexTest, IndexesExistingNames)
+{
+  entt::registry registry;
+  const entt::entity entity = registry.create();
+  registry.emplace<project::Name>(entity, "crate");
+
+  const project::EntityNameIndex names(registry);
+  EXPECT_EQ(names.size(), 1U);
+  EXPECT_EQ(names.find("crate"), entity);
+}
+
+TEST(EntityNameIndexTest, FollowsRegistrySignals)
+{
+  entt::registry registry;
+  project::EntityNameIndex names(registry);
+
+  // Emplaced straight on the registry, not through assign()
+  const entt::entity entity = registry.create();
+  registry.emplace<project::Name>(entity, "crate");
+  EXPECT_EQ(names.find("crate"), entity);
+
+  registry.remove<project::Name>(entity);
+  EXPECT_EQ(names.find("crate"), entt::entity{entt::null});
+  EXPECT_EQ(names.size(), 0U);
+
+  names.assign(entity, "barrel");
+  registry.destroy(entity);
+  EXPECT_EQ(names.find("barrel"), entt::entity{entt::null});
+  EXPECT_EQ(names.size(), 0U);
+}
+
+TEST(EntityNameIndexTest, AssignReplacesOldName)
+{
+  entt::registry registry;
+  project::EntityNameIndex names(registry);
+  const entt::entity entity = registry.create();
+
+  names.assign(entity, "before");
+  names.assign(entity, "after");
+  EXPECT_EQ(names.find("before"), entt::entity{entt::null});
+  EXPECT_EQ(names.find("after"), entity);
+  EXPECT_EQ(names.size(), 1U);
+
+  names.remove(entity);
+  EXPECT_FALSE(registry.all_of<project::Name>(entity));
+  EXPECT_EQ(names.size(), 0U);
+}
+
+TEST(EntityNameIndexTest, ReplacedNameIsNotFound)
+{
+  entt::registry registry;
+  project::EntityNameIndex names(registry);
+  const entt::entity entity = registry.create();
+  registry.emplace<project::Name>(entity, "before");
+
+  // The old entry stays behind, but find() sees the entity no longer carries the name
+  registry.replace<project::Name>(entity, "after");
+  EXPECT_EQ(names.find("before"), entt::entity{entt::null});
+  EXPECT_EQ(names.find("after"), entity);
+}
+
+TEST(EntityNameIndexTest, ClearEmptiesIndex)
+{
+  entt::registry registry;
+  project::EntityNameIndex names(registry);
+  for (int i = 0; i < 4; ++i)
+  {
+    names.assign(registry.create(), "entity-" + std::to_string(i));
+  }
+  EXPECT_EQ(names.size(), 4U);
+
+  registry.clear();
+  EXPECT_EQ(names.size(), 0U);
+  EXPECT_EQ(names.find("entity-0"), entt::entity{entt::null});
+}
+
+TEST(EntityNameIndexTest, DisconnectsOnDestruction)
+{
+  entt::registry registry;
+  {
+    const project::EntityNameIndex names(registry);
+  }
+
+  // Would call into the destroyed index if it were still connected
+  const entt::entity entity = registry.create();
+  registry.emplace<project::Name>(entity, "crate");
+  registry.destroy(entity);
+  EXPECT_FALSE(registry.valid(entity));
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
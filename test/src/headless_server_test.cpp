@@ -0,0 +1,194 @@
+#include "project/headless_server.hpp"
+#include "project/task_pool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+  constexpr std::uint32_t kWorldCount = 3;
+  constexpr std::uint32_t kBoxCount = 24;
+  constexpr std::uint32_t kStepCount = 90;
+
+  /// Boxes in every world, then one kick per world partway through
+  project::InputStream makeScript()
+  {
+    project::InputStream inputs;
+    for (std::uint32_t world = 0; world < kWorldCount; ++world)
+    {
+      project::InputCommand spawn;
+      spawn.world = world;
+      spawn.type = project::InputCommandType::SpawnBoxes;
+      spawn.value = kBoxCount;
+      inputs.commands.push_back(spawn);
+
+      project::InputCommand kick;
+      kick.step = 30 + world;
+      kick.world = world;
+      kick.type = project::InputCommandType::ApplyImpulse;
+      kick.value = world % kBoxCount;
+      kick.vector[0] = 2.0F;
+      kick.vector[1] = 4.0F;
+      kick.vector[2] = -1.0F;
+      inputs.commands.push_back(kick);
+    }
+    return inputs;
+  }
+
+  /// Run the script and return the final state hash (and the full state stream)
+  std::uint64_t runScript(size_t workerCount, std::vector<unsigned char>& stream)
+  {
+    project::TaskPool taskPool(workerCount);
+    project::HeadlessServerConfig config;
+    config.worldCount = kWorldCount;
+    config.frameInterval = 10;
+    config.fullState = true;
+    project::HeadlessServer server(config, taskPool);
+
+    EXPECT_EQ(server.addInputs(makeScript()), 0U);
+    stream.clear();
+    server.writeStreamHeader(stream);
+    for (std::uint32_t step = 0; step < kStepCount; ++step)
+    {
+      server.step(stream);
+    }
+    EXPECT_EQ(server.getStepIndex(), kStepCount);
+    return server.getStateHash();
+  }
+}  // namespace
+
+TEST(InputStreamTest, RoundTrip)
+{
+  const project::InputStream inputs = makeScript();
+  std::vector<unsigned char> bytes;
+  inputs.writeTo(bytes);
+  ASSERT_EQ(bytes.size(), inputs.getSerializedSize());
+
+  project::InputStream loaded;
+  ASSERT_TRUE(loaded.readFrom(bytes));
+  ASSERT_EQ(loaded.commands.size(), inputs.commands.size());
+  for (size_t i = 0; i < inputs.commands.size(); ++i)
+  {
+    EXPECT_EQ(std::memcmp(&loaded.commands[i], &inputs.commands[i], sizeof(project::InputCommand)), 0);
+  }
+}
+
+TEST(InputStreamTest, EmptyRoundTrip)
+{
+  std::vector<unsigned char> bytes;
+  project::InputStream{}.writeTo(bytes);
+
+  project::InputStream loaded;
+  loaded.commands.resize(4);
+  ASSERT_TRUE(loaded.readFrom(bytes));
+  EXPECT_TRUE(loaded.commands.empty());
+}
+
+TEST(InputStreamTest, RejectsTruncatedInput)
+{
+  std::vector<unsigned char> bytes;
+  makeScript().writeTo(bytes);
+
+  project::InputStream loaded;
+  bytes.pop_back();
+  EXPECT_FALSE(loaded.readFrom(bytes));
+  EXPECT_TRUE(loaded.commands.empty());
+
+  // Shorter than the header
+  bytes.resize(3);
+  EXPECT_FALSE(loaded.readFrom(bytes));
+  EXPECT_TRUE(loaded.commands.empty());
+}
+
+TEST(InputStreamTest, RejectsOtherVersion)
+{
+  std::vector<unsigned char> bytes;
+  makeScript().writeTo(bytes);
+
+  // The version follows the magic
+  std::uint32_t version = 0;
+  std::memcpy(&version, bytes.data() + sizeof(std::uint32_t), sizeof(version));
+  ++version;
+  std::memcpy(bytes.data() + sizeof(std::uint32_t), &version, sizeof(version));
+
+  project::InputStream loaded;
+  loaded.commands.resize(4);
+  EXPECT_FALSE(loaded.readFrom(bytes));
+  EXPECT_TRUE(loaded.commands.empty());
+}
+
+TEST(HeadlessWorldTest, RepeatedSpawnsDoNotOverlap)
+{
+  project::HeadlessWorld world;
+  world.initialize();
+
+  // Different batch sizes lay out their rows differently
+  for (const std::uint32_t count : {4U, 100U, 300U})
+  {
+    project::InputCommand spawn;
+    spawn.type = project::InputCommandType::SpawnBoxes;
+    spawn.value = count;
+    world.apply(spawn);
+  }
+  ASSERT_EQ(world.getBoxCount(), 404U);
+
+  // Unit boxes overlap when closer than their size on every axis
+  std::vector<project::BodyState> states;
+  world.captureState(states);
+  constexpr float kBoxSize = 1.0F;
+  for (size_t i = 0; i < states.size(); ++i)
+  {
+    for (size_t j = i + 1; j < states.size(); ++j)
+    {
+      bool separated = false;
+      for (int axis = 0; axis < 3; ++axis)
+      {
+        separated = separated || std::abs(states[i].position[axis] - states[j].position[axis]) >= kBoxSize;
+      }
+      ASSERT_TRUE(separated) << "boxes " << i << " and " << j;
+    }
+  }
+}
+
+TEST(HeadlessServerTest, DropsInputsForUnknownWorlds)
+{
+  project::TaskPool taskPool(0);
+  project::HeadlessServerConfig config;
+  config.worldCount = 1;
+  project::HeadlessServer server(config, taskPool);
+
+  project::InputStream inputs;
+  project::InputCommand command;
+  command.world = 1;
+  inputs.commands.push_back(command);
+  EXPECT_EQ(server.addInputs(inputs), 1U);
+}
+
+TEST(HeadlessServerTest, SameStateForAnyWorkerCount)
+{
+  std::vector<unsigned char> inlineStream;
+  std::vector<unsigned char> pooledStream;
+  const std::uint64_t inlineHash = runScript(0, inlineStream);
+  const std::uint64_t pooledHash = runScript(3, pooledStream);
+
+  EXPECT_EQ(inlineHash, pooledHash);
+  EXPECT_EQ(inlineStream, pooledStream);
+}
+
+TEST(HeadlessServerTest, ReplayMatches)
+{
+  std::vector<unsigned char> firstStream;
+  std::vector<unsigned char> secondStream;
+  EXPECT_EQ(runScript(2, firstStream), runScript(2, secondStream));
+  EXPECT_EQ(firstStream, secondStream);
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,132 @@
+#include "project/ecs_systems.hpp"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+  constexpr float kTolerance = 1e-5F;
+
+  void expectNear(const Vector3& actual, const Vector3& expected)
+  {
+    EXPECT_NEAR(actual.x, expected.x, kTolerance);
+    EXPECT_NEAR(actual.y, expected.y, kTolerance);
+    EXPECT_NEAR(actual.z, expected.z, kTolerance);
+  }
+
+  void expectNear(const Matrix& actual, const Matrix& expected)
+  {
+    const float16 lhs = MatrixToFloatV(actual);
+    const float16 rhs = MatrixToFloatV(expected);
+    for (int i = 0; i < 16; ++i)
+    {
+      EXPECT_NEAR(lhs.v[i], rhs.v[i], kTolerance) << "element " << i;
+    }
+  }
+
+  project::Transform makePose(Vector3 position, float yawDegrees)
+  {
+    project::Transform pose;
+    pose.position = position;
+    pose.rotation = QuaternionFromAxisAngle(Vector3{0.0F, 1.0F, 0.0F}, yawDegrees * DEG2RAD);
+    return pose;
+  }
+
+  entt::entity createNode(entt::registry& registry, const project::Transform& pose)
+  {
+    const entt::entity entity = registry.create();
+    registry.emplace<project::Transform>(entity, pose);
+    return entity;
+  }
+}  // namespace
+
+TEST(HierarchySystemTest, ChildFollowsParent)
+{
+  entt::registry registry;
+  const entt::entity parent = createNode(registry, makePose(Vector3{1.0F, 0.0F, 0.0F}, 90.0F));
+  const entt::entity child = registry.create();
+  ASSERT_TRUE(project::HierarchySystem::attach(registry, child, parent, makePose(Vector3{0.0F, 0.0F, 2.0F}, 0.0F)));
+
+  project::HierarchySystem::update(registry);
+  const project::Transform& transform = registry.get<project::Transform>(child);
+  expectNear(transform.position, Vector3{3.0F, 0.0F, 0.0F});  // +z turned 90 degrees about y is +x
+
+  // Uniform scale: the cached matrix product and the composed pose agree
+  expectNear(registry.get<project::WorldMatrix>(child).matrix, transform.getMatrix());
+  EXPECT_TRUE(registry.storage<project::HierarchyDirty>().empty());
+}
+
+TEST(HierarchySystemTest, RootMovesReachGrandchildren)
+{
+  entt::registry registry;
+  const entt::entity root = createNode(registry, makePose(Vector3Zero(), 0.0F));
+  const entt::entity child = registry.create();
+  const entt::entity grandchild = registry.create();
+  ASSERT_TRUE(project::HierarchySystem::attach(registry, child, root, makePose(Vector3{0.0F, 1.0F, 0.0F}, 0.0F)));
+  ASSERT_TRUE(project::HierarchySystem::attach(registry, grandchild, child, makePose(Vector3{0.0F, 1.0F, 0.0F}, 0.0F)));
+  project::HierarchySystem::update(registry);
+  expectNear(registry.get<project::Transform>(grandchild).position, Vector3{0.0F, 2.0F, 0.0F});
+
+  // Moved behind the hierarchy's back, like physics does
+  registry.get<project::Transform>(root).position = Vector3{5.0F, 0.0F, 0.0F};
+  project::HierarchySystem::update(registry);
+  expectNear(registry.get<project::Transform>(child).position, Vector3{5.0F, 1.0F, 0.0F});
+  expectNear(registry.get<project::Transform>(grandchild).position, Vector3{5.0F, 2.0F, 0.0F});
+}
+
+TEST(HierarchySystemTest, LocalMatrixRebuiltOnlyWhenSet)
+{
+  entt::registry registry;
+  const entt::entity parent = createNode(registry, makePose(Vector3Zero(), 0.0F));
+  const entt::entity child = registry.create();
+  const project::Transform local = makePose(Vector3{1.0F, 0.0F, 0.0F}, 45.0F);
+  ASSERT_TRUE(project::HierarchySystem::attach(registry, child, parent, local));
+  project::HierarchySystem::update(registry);
+  expectNear(registry.get<project::LocalTransform>(child).matrix, local.getMatrix());
+
+  // Edited without setLocalTransform: the parent moving does not rebuild the cached matrix
+  registry.get<project::LocalTransform>(child).transform.position = Vector3{9.0F, 0.0F, 0.0F};
+  registry.get<project::Transform>(parent).position = Vector3{0.0F, 1.0F, 0.0F};
+  project::HierarchySystem::update(registry);
+  expectNear(registry.get<project::LocalTransform>(child).matrix, local.getMatrix());
+
+  const project::Transform moved = makePose(Vector3{2.0F, 0.0F, 0.0F}, 45.0F);
+  project::HierarchySystem::setLocalTransform(registry, child, moved);
+  project::HierarchySystem::update(registry);
+  expectNear(registry.get<project::LocalTransform>(child).matrix, moved.getMatrix());
+  expectNear(registry.get<project::Transform>(child).position, Vector3{2.0F, 1.0F, 0.0F});
+}
+
+TEST(HierarchySystemTest, DetachKeepsWorldPose)
+{
+  entt::registry registry;
+  const entt::entity parent = createNode(registry, makePose(Vector3{0.0F, 3.0F, 0.0F}, 0.0F));
+  const entt::entity child = registry.create();
+  ASSERT_TRUE(project::HierarchySystem::attach(registry, child, parent, makePose(Vector3{1.0F, 0.0F, 0.0F}, 0.0F)));
+  project::HierarchySystem::update(registry);
+
+  project::HierarchySystem::detach(registry, child);
+  EXPECT_FALSE(registry.all_of<project::Parent>(child));
+  EXPECT_FALSE(registry.all_of<project::Children>(parent));
+
+  registry.get<project::Transform>(parent).position = Vector3Zero();
+  project::HierarchySystem::update(registry);
+  expectNear(registry.get<project::Transform>(child).position, Vector3{1.0F, 3.0F, 0.0F});
+}
+
+TEST(HierarchySystemTest, RejectsCycles)
+{
+  entt::registry registry;
+  const entt::entity root = createNode(registry, makePose(Vector3Zero(), 0.0F));
+  const entt::entity child = registry.create();
+  ASSERT_TRUE(project::HierarchySystem::attach(registry, child, root, project::Transform{}));
+
+  EXPECT_FALSE(project::HierarchySystem::attach(registry, root, child, project::Transform{}));
+  EXPECT_FALSE(project::HierarchySystem::attach(registry, child, child, project::Transform{}));
+  EXPECT_EQ(registry.get<project::Parent>(child).entity, root);
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,85 @@
+#include "project/object_pool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace
+{
+  using Pool = project::ObjectPool<std::uint64_t, 4>;
+}  // namespace
+
+TEST(ObjectPoolTest, ReusesDestroyedSlots)
+{
+  Pool pool;
+  std::uint64_t* first = pool.create(1U);
+  std::uint64_t* second = pool.create(2U);
+  EXPECT_EQ(pool.getLiveCount(), 2U);
+  EXPECT_EQ(pool.getCapacity(), 4U);
+
+  pool.destroy(first);
+  EXPECT_EQ(pool.create(3U), first);
+  EXPECT_EQ(*second, 2U);
+
+  EXPECT_FALSE(pool.releaseMemory());
+  pool.destroy(first);
+  pool.destroy(second);
+  EXPECT_TRUE(pool.releaseMemory());
+  EXPECT_EQ(pool.getCapacity(), 0U);
+}
+
+TEST(ObjectPoolTest, ReserveAvoidsNewChunks)
+{
+  Pool pool;
+  pool.reserve(10);
+  const size_t capacity = pool.getCapacity();
+  EXPECT_GE(capacity, 10U);
+
+  std::vector<std::uint64_t*> objects;
+  for (std::uint64_t i = 0; i < 10; ++i)
+  {
+    objects.push_back(pool.create(i));
+  }
+  EXPECT_EQ(pool.getCapacity(), capacity);
+  for (std::uint64_t* object : objects)
+  {
+    pool.destroy(object);
+  }
+}
+
+TEST(ObjectPoolTest, MoveLeavesSourceEmpty)
+{
+  Pool source;
+  std::uint64_t* kept = source.create(7U);
+  static_cast<void>(source.create(8U));  // Leaves free slots in the chunk
+
+  Pool target(std::move(source));
+  EXPECT_EQ(target.getLiveCount(), 2U);
+  EXPECT_EQ(source.getLiveCount(), 0U);
+  EXPECT_EQ(source.getCapacity(), 0U);
+  EXPECT_EQ(*kept, 7U);
+
+  // The source allocates fresh memory instead of handing out the target's free slots
+  std::uint64_t* fromSource = source.create(9U);
+  std::uint64_t* fromTarget = target.create(10U);
+  EXPECT_NE(fromSource, fromTarget);
+  EXPECT_EQ(source.getCapacity(), 4U);
+
+  Pool assigned;
+  assigned = std::move(target);
+  EXPECT_EQ(assigned.getLiveCount(), 3U);
+  EXPECT_EQ(target.getLiveCount(), 0U);
+  EXPECT_EQ(target.getCapacity(), 0U);
+
+  const std::set<std::uint64_t*> distinct{kept, fromTarget, assigned.create(11U), target.create(12U)};
+  EXPECT_EQ(distinct.size(), 4U);
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,131 @@
+#include "project/physics_snapshot.hpp"
+#include "project/physics_world.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+  project::PhysicsSnapshot makeSnapshot()
+  {
+    project::PhysicsSnapshot snapshot;
+    snapshot.accumulator = 0.004F;
+    for (std::uint32_t i = 0; i < 3; ++i)
+    {
+      project::BodySnapshot body;
+      body.entity = static_cast<entt::entity>(i);
+      body.activationState = 1;
+      body.deactivationTime = 0.5F * static_cast<float>(i);
+      body.position[1] = static_cast<float>(i) + 1.0F;
+      body.linearVelocity[0] = -2.0F;
+      body.angularVelocity[2] = 0.25F;
+      snapshot.bodies.push_back(body);
+
+      project::TransformSnapshot transform;
+      transform.entity = body.entity;
+      transform.hasPrevious = i % 2;
+      transform.transform.position = Vector3{0.0F, body.position[1], 0.0F};
+      transform.previous.position = Vector3{0.0F, static_cast<float>(i), 0.0F};
+      snapshot.transforms.push_back(transform);
+    }
+    return snapshot;
+  }
+}  // namespace
+
+TEST(PhysicsSnapshotTest, RoundTrip)
+{
+  const project::PhysicsSnapshot snapshot = makeSnapshot();
+  std::vector<unsigned char> bytes;
+  snapshot.writeTo(bytes);
+  ASSERT_EQ(bytes.size(), snapshot.getSerializedSize());
+
+  project::PhysicsSnapshot loaded;
+  ASSERT_TRUE(loaded.readFrom(bytes));
+  EXPECT_FLOAT_EQ(loaded.accumulator, snapshot.accumulator);
+  ASSERT_EQ(loaded.bodies.size(), snapshot.bodies.size());
+  ASSERT_EQ(loaded.transforms.size(), snapshot.transforms.size());
+  for (size_t i = 0; i < snapshot.bodies.size(); ++i)
+  {
+    EXPECT_EQ(std::memcmp(&loaded.bodies[i], &snapshot.bodies[i], sizeof(project::BodySnapshot)), 0);
+    EXPECT_EQ(std::memcmp(&loaded.transforms[i], &snapshot.transforms[i], sizeof(project::TransformSnapshot)), 0);
+  }
+
+  // Writing what was read gives the same bytes
+  std::vector<unsigned char> rewritten;
+  loaded.writeTo(rewritten);
+  EXPECT_EQ(rewritten, bytes);
+}
+
+TEST(PhysicsSnapshotTest, RejectsTruncatedInput)
+{
+  std::vector<unsigned char> bytes;
+  makeSnapshot().writeTo(bytes);
+  bytes.pop_back();
+
+  project::PhysicsSnapshot loaded = makeSnapshot();
+  EXPECT_FALSE(loaded.readFrom(bytes));
+  EXPECT_TRUE(loaded.isEmpty());
+
+  bytes.resize(2);
+  EXPECT_FALSE(loaded.readFrom(bytes));
+  EXPECT_TRUE(loaded.isEmpty());
+}
+
+TEST(PhysicsSnapshotTest, RejectsOtherVersion)
+{
+  std::vector<unsigned char> bytes;
+  makeSnapshot().writeTo(bytes);
+
+  // The version follows the magic
+  std::uint32_t version = 0;
+  std::memcpy(&version, bytes.data() + sizeof(std::uint32_t), sizeof(version));
+  ++version;
+  std::memcpy(bytes.data() + sizeof(std::uint32_t), &version, sizeof(version));
+
+  project::PhysicsSnapshot loaded = makeSnapshot();
+  EXPECT_FALSE(loaded.readFrom(bytes));
+  EXPECT_TRUE(loaded.isEmpty());
+}
+
+TEST(PhysicsSnapshotTest, RestoreRewindsWorld)
+{
+  entt::registry registry;
+  project::PhysicsWorld world(registry);
+  world.initialize();
+
+  project::ShapeCache& shapes = world.getShapeCache();
+  static_cast<void>(world.createBody(Vector3{0.0F, -0.5F, 0.0F}, shapes.acquireBox(Vector3{10.0F, 0.5F, 10.0F}), 0.0F));
+  const entt::entity box = world.createBody(Vector3{0.0F, 4.0F, 0.0F}, shapes.acquireBox(Vector3{0.5F, 0.5F, 0.5F}), 1.0F);
+
+  project::PhysicsSnapshot start;
+  world.captureSnapshot(start);
+  const Vector3 startPosition = registry.get<project::Transform>(box).position;
+
+  // The box falls, and after a restore it falls the same way again
+  for (int i = 0; i < 30; ++i)
+  {
+    world.step();
+  }
+  const Vector3 fallenPosition = registry.get<project::Transform>(box).position;
+  EXPECT_LT(fallenPosition.y, startPosition.y);
+
+  world.restoreSnapshot(start);
+  EXPECT_FLOAT_EQ(registry.get<project::Transform>(box).position.y, startPosition.y);
+
+  for (int i = 0; i < 30; ++i)
+  {
+    world.step();
+  }
+  EXPECT_FLOAT_EQ(registry.get<project::Transform>(box).position.y, fallenPosition.y);
+
+  world.shutdown();
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,95 @@
+#include "project/scene.hpp"
+
+#include <gtest/gtest.h>
+
+// Objects without a model: the handle and name bookkeeping never touches it
+
+TEST(SceneHandleTest, HandlesSurviveOtherRemovals)
+{
+  project::Scene scene;
+  const project::SceneObjectHandle first = scene.addObject(nullptr, Vector3{1.0F, 0.0F, 0.0F});
+  const project::SceneObjectHandle second = scene.addObject(nullptr, Vector3{2.0F, 0.0F, 0.0F});
+  const project::SceneObjectHandle third = scene.addObject(nullptr, Vector3{3.0F, 0.0F, 0.0F});
+
+  // Removing the first object moves the last one into its place
+  ASSERT_TRUE(scene.removeObject(first));
+  EXPECT_EQ(scene.getObjectCount(), 2U);
+  ASSERT_NE(scene.getObject(second), nullptr);
+  ASSERT_NE(scene.getObject(third), nullptr);
+  EXPECT_FLOAT_EQ(scene.getObject(second)->position.x, 2.0F);
+  EXPECT_FLOAT_EQ(scene.getObject(third)->position.x, 3.0F);
+}
+
+TEST(SceneHandleTest, ReusedSlotGetsNewGeneration)
+{
+  project::Scene scene;
+  const project::SceneObjectHandle removed = scene.addObject(nullptr);
+  ASSERT_TRUE(scene.removeObject(removed));
+  EXPECT_FALSE(scene.contains(removed));
+  EXPECT_EQ(scene.getObject(removed), nullptr);
+  EXPECT_FALSE(scene.removeObject(removed));
+
+  const project::SceneObjectHandle reused = scene.addObject(nullptr, Vector3{5.0F, 0.0F, 0.0F});
+  EXPECT_EQ(reused.index, removed.index);
+  EXPECT_NE(reused.generation, removed.generation);
+  EXPECT_FALSE(scene.contains(removed));
+  EXPECT_EQ(scene.getObject(removed), nullptr);
+  ASSERT_NE(scene.getObject(reused), nullptr);
+  EXPECT_FLOAT_EQ(scene.getObject(reused)->position.x, 5.0F);
+}
+
+TEST(SceneHandleTest, ClearInvalidatesHandles)
+{
+  project::Scene scene;
+  const project::SceneObjectHandle handle = scene.addObject(nullptr);
+  scene.clear();
+  EXPECT_TRUE(scene.isEmpty());
+  EXPECT_FALSE(scene.contains(handle));
+
+  const project::SceneObjectHandle reused = scene.addObject(nullptr);
+  EXPECT_FALSE(scene.contains(handle));
+  EXPECT_TRUE(scene.contains(reused));
+}
+
+TEST(SceneHandleTest, DefaultHandleIsInvalid)
+{
+  project::Scene scene;
+  static_cast<void>(scene.addObject(nullptr));
+  const project::SceneObjectHandle handle;
+  EXPECT_FALSE(handle.isValid());
+  EXPECT_FALSE(scene.contains(handle));
+}
+
+TEST(SceneNameTest, SharedNameFallsBackToRemainingObject)
+{
+  project::Scene scene;
+  const project::SceneObjectHandle first = scene.addObject(nullptr, Vector3Zero(), 1.0F, "crate");
+  const project::SceneObjectHandle second = scene.addObject(nullptr, Vector3Zero(), 1.0F, "crate");
+  EXPECT_EQ(scene.findHandleByName("crate"), first);
+
+  ASSERT_TRUE(scene.removeObject(first));
+  EXPECT_EQ(scene.findHandleByName("crate"), second);
+
+  ASSERT_TRUE(scene.removeObjectByName("crate"));
+  EXPECT_FALSE(scene.findHandleByName("crate").isValid());
+  EXPECT_EQ(scene.findObjectByName("crate"), nullptr);
+}
+
+TEST(SceneNameTest, RenameMovesIndexEntry)
+{
+  project::Scene scene;
+  const project::SceneObjectHandle handle = scene.addObject(nullptr, Vector3Zero(), 1.0F, "before");
+  ASSERT_TRUE(scene.renameObject(handle, "after"));
+  EXPECT_FALSE(scene.findHandleByName("before").isValid());
+  EXPECT_EQ(scene.findHandleByName("after"), handle);
+  EXPECT_EQ(scene.getObject(handle)->name, "after");
+
+  ASSERT_TRUE(scene.removeObject(handle));
+  EXPECT_FALSE(scene.renameObject(handle, "again"));
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,151 @@
+#include "project/system_scheduler.hpp"
+#include "project/task_pool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+  struct Position
+  {
+    float x{0.0F};
+  };
+
+  struct Velocity
+  {
+    float x{0.0F};
+  };
+
+  struct Health
+  {
+    int value{0};
+  };
+
+  /// Order in which systems start, and how many finished, across threads
+  struct RunLog
+  {
+    std::mutex mutex;
+    std::vector<size_t> startedStages;
+    std::atomic<size_t> finished{0};
+    std::atomic<bool> startedEarly{false};
+  };
+
+  /// System that logs its stage and checks every earlier stage already finished
+  project::SystemScheduler::SystemFunction logSystem(RunLog& log, size_t stage, size_t systemsBefore)
+  {
+    return [&log, stage, systemsBefore](entt::registry&)
+    {
+      if (log.finished.load() < systemsBefore)
+      {
+        log.startedEarly = true;
+      }
+      {
+        const std::lock_guard lock(log.mutex);
+        log.startedStages.push_back(stage);
+      }
+      log.finished.fetch_add(1);
+    };
+  }
+}  // namespace
+
+TEST(SystemAccessTest, Conflicts)
+{
+  project::SystemAccess readPosition;
+  readPosition.reads<Position>();
+  project::SystemAccess alsoReadPosition;
+  alsoReadPosition.reads<Position>();
+  project::SystemAccess writePosition;
+  writePosition.writes<Position>();
+  project::SystemAccess writeVelocity;
+  writeVelocity.writes<Velocity>();
+  project::SystemAccess exclusive;
+  exclusive.exclusive();
+
+  EXPECT_FALSE(readPosition.conflictsWith(alsoReadPosition));
+  EXPECT_TRUE(readPosition.conflictsWith(writePosition));
+  EXPECT_TRUE(writePosition.conflictsWith(readPosition));
+  EXPECT_TRUE(writePosition.conflictsWith(writePosition));
+  EXPECT_FALSE(writePosition.conflictsWith(writeVelocity));
+  EXPECT_TRUE(exclusive.conflictsWith(readPosition));
+  EXPECT_TRUE(readPosition.conflictsWith(exclusive));
+}
+
+TEST(SystemSchedulerTest, StagesFollowDeclaredAccess)
+{
+  RunLog log;
+  project::SystemScheduler scheduler;
+  scheduler.add("WritePosition", project::SystemAccess().writes<Position>(), logSystem(log, 0, 0));
+  scheduler.add("ReadVelocity", project::SystemAccess().reads<Velocity>(), logSystem(log, 0, 0));
+  scheduler.add("ReadPosition", project::SystemAccess().reads<Position>(), logSystem(log, 1, 2));
+  scheduler.add("WriteVelocity", project::SystemAccess().writes<Velocity>(), logSystem(log, 1, 2));
+  scheduler.add("Exclusive", project::SystemAccess().exclusive(), logSystem(log, 2, 4));
+  scheduler.add("WriteHealth", project::SystemAccess().writes<Health>(), logSystem(log, 3, 5));
+
+  ASSERT_EQ(scheduler.getSystemCount(), 6U);
+  EXPECT_EQ(scheduler.getStageCount(), 4U);
+  const size_t expectedStages[] = {0, 0, 1, 1, 2, 3};
+  for (size_t i = 0; i < scheduler.getSystemCount(); ++i)
+  {
+    EXPECT_EQ(scheduler.getSystemStage(i), expectedStages[i]) << scheduler.getSystemName(i);
+  }
+
+  project::TaskPool pool(3);
+  entt::registry registry;
+  for (int run = 0; run < 50; ++run)
+  {
+    log.startedStages.clear();
+    log.finished = 0;
+    scheduler.run(registry, pool);
+    EXPECT_EQ(log.finished.load(), 6U);
+    EXPECT_TRUE(std::ranges::is_sorted(log.startedStages));
+  }
+  EXPECT_FALSE(log.startedEarly.load());
+}
+
+TEST(SystemSchedulerTest, LaterSystemsSeeEarlierWrites)
+{
+  project::SystemScheduler scheduler;
+  scheduler.add("Integrate", project::SystemAccess().reads<Velocity>().writes<Position>(), [](entt::registry& registry)
+  {
+    auto view = registry.view<Position, const Velocity>();
+    for (const auto entity : view)
+    {
+      view.get<Position>(entity).x += view.get<const Velocity>(entity).x;
+    }
+  });
+  scheduler.add("Damage", project::SystemAccess().reads<Position>().writes<Health>(), [](entt::registry& registry)
+  {
+    auto view = registry.view<const Position, Health>();
+    for (const auto entity : view)
+    {
+      view.get<Health>(entity).value = view.get<const Position>(entity).x > 1.5F ? 0 : 100;
+    }
+  });
+  EXPECT_EQ(scheduler.getStageCount(), 2U);
+
+  entt::registry registry;
+  const entt::entity entity = registry.create();
+  registry.emplace<Position>(entity, 1.0F);
+  registry.emplace<Velocity>(entity, 1.0F);
+  registry.emplace<Health>(entity, 100);
+
+  project::TaskPool pool(2);
+  scheduler.run(registry, pool);
+  EXPECT_FLOAT_EQ(registry.get<Position>(entity).x, 2.0F);
+  EXPECT_EQ(registry.get<Health>(entity).value, 0);
+
+  scheduler.clear();
+  EXPECT_EQ(scheduler.getSystemCount(), 0U);
+  EXPECT_EQ(scheduler.getStageCount(), 0U);
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
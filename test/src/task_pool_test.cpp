@@ -0,0 +1,101 @@
+#include "project/task_pool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace
+{
+  /// Run parallelFor over [begin, end) and count how often every index was visited
+  std::vector<int> countVisits(project::TaskPool& pool, size_t begin, size_t end, size_t grainSize)
+  {
+    std::vector<std::atomic<int>> visits(end);
+    pool.parallelFor(begin, end, grainSize, [&visits](size_t chunkBegin, size_t chunkEnd)
+    {
+      for (size_t i = chunkBegin; i < chunkEnd; ++i)
+      {
+        visits[i].fetch_add(1, std::memory_order_relaxed);
+      }
+    });
+
+    std::vector<int> counts;
+    counts.reserve(end);
+    for (const auto& visit : visits)
+    {
+      counts.push_back(visit.load());
+    }
+    return counts;
+  }
+}  // namespace
+
+TEST(TaskPoolTest, ParallelForVisitsEveryIndexOnce)
+{
+  for (const size_t workerCount : {size_t{0}, size_t{1}, size_t{3}})
+  {
+    project::TaskPool pool(workerCount);
+    EXPECT_EQ(pool.getWorkerCount(), workerCount);
+    for (const size_t grainSize : {size_t{0}, size_t{1}, size_t{7}, size_t{1000}})
+    {
+      const std::vector<int> counts = countVisits(pool, 5, 1003, grainSize);
+      for (size_t i = 0; i < counts.size(); ++i)
+      {
+        EXPECT_EQ(counts[i], i < 5 ? 0 : 1) << "index " << i << ", " << workerCount << " workers, grain " << grainSize;
+      }
+    }
+  }
+}
+
+TEST(TaskPoolTest, ParallelForEmptyRange)
+{
+  project::TaskPool pool(2);
+  bool called = false;
+  pool.parallelFor(4, 4, 1, [&called](size_t, size_t) { called = true; });
+  pool.parallelFor(5, 4, 1, [&called](size_t, size_t) { called = true; });
+  EXPECT_FALSE(called);
+}
+
+TEST(TaskPoolTest, WaitFinishesGroup)
+{
+  for (const size_t workerCount : {size_t{0}, size_t{3}})
+  {
+    project::TaskPool pool(workerCount);
+    project::TaskGroup group;
+    std::atomic<int> finished{0};
+    for (int i = 0; i < 200; ++i)
+    {
+      pool.run(group, [&finished] { finished.fetch_add(1, std::memory_order_relaxed); });
+    }
+    pool.wait(group);
+    EXPECT_TRUE(group.isDone());
+    EXPECT_EQ(finished.load(), 200);
+  }
+}
+
+TEST(TaskPoolTest, TasksWaitOnNestedGroups)
+{
+  project::TaskPool pool(2);
+  project::TaskGroup outer;
+  std::atomic<int> finished{0};
+  for (int i = 0; i < 8; ++i)
+  {
+    pool.run(outer, [&pool, &finished]
+    {
+      project::TaskGroup inner;
+      for (int j = 0; j < 16; ++j)
+      {
+        pool.run(inner, [&finished] { finished.fetch_add(1, std::memory_order_relaxed); });
+      }
+      pool.wait(inner);
+    });
+  }
+  pool.wait(outer);
+  EXPECT_EQ(finished.load(), 8 * 16);
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,119 @@
+// Offline asset baker: converts glTF models into the memory-mappable BakedModel format
+//
+// Usage: Project_baker [--force] model.glb [model.glb ...]
+//
+// Writes model.glb.bake next to each source. Bakes whose source hash still matches are
+// skipped unless --force is given. A hidden window provides the GL context LoadModel needs.
+
+#include <project/async_asset_loader.hpp>
+#include <project/baked_model.hpp>
+#include <project/shape_cache.hpp>
+#include <btBulletDynamicsCommon.h>
+#include <raylib.h>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+/// Convex hull points the runtime would otherwise compute on first spawn
+std::vector<Vector3> buildHullPoints(const Model& model) {
+    project::ShapeCache shapeCache;
+    const project::ShapeHandle shape = shapeCache.acquireConvexHull(model);
+    std::vector<Vector3> points;
+    if (shape == nullptr) {
+        return points;
+    }
+
+    const auto* hull = static_cast<const btConvexHullShape*>(shape.get());
+    for (int i = 0; i < hull->getNumPoints(); ++i) {
+        const btVector3& point = hull->getUnscaledPoints()[i];
+        points.push_back(Vector3{point.x(), point.y(), point.z()});
+    }
+    return points;
+}
+
+/// Bake one model
+/// @return False if the model could not be baked
+bool bakeModel(const std::string& sourcePath, bool force) {
+    const std::string bakedPath = project::BakedModel::getBakedPath(sourcePath);
+    const project::PreparedModel prepared = project::AsyncAssetLoader::prepareModel(sourcePath);
+    if (!prepared.found) {
+        std::cerr << sourcePath << ": not found" << std::endl;
+        return false;
+    }
+    if (prepared.baked != nullptr && !force) {
+        std::cout << sourcePath << ": up to date" << std::endl;
+        return true;
+    }
+
+    Model model = LoadModel(sourcePath.c_str());
+    if (!IsModelValid(model)) {
+        std::cerr << sourcePath << ": failed to load" << std::endl;
+        return false;
+    }
+
+    // Material 0 is raylib's default; the others are textured if they left the default texture
+    const std::filesystem::path bakedDirectory = std::filesystem::path(bakedPath).parent_path();
+    const unsigned int defaultTextureId = model.materials[0].maps[MATERIAL_MAP_ALBEDO].texture.id;
+    std::vector<std::string> albedoPaths(static_cast<size_t>(model.materialCount));
+    bool supported = true;
+    for (int i = 1; i < model.materialCount; ++i) {
+        if (model.materials[i].maps[MATERIAL_MAP_ALBEDO].texture.id == defaultTextureId) {
+            continue;
+        }
+        if (prepared.atlasPath.empty()) {
+            std::cerr << sourcePath << ": only a single external base-color image is supported" << std::endl;
+            supported = false;
+            break;
+        }
+        albedoPaths[static_cast<size_t>(i)] =
+            std::filesystem::path(prepared.atlasPath).lexically_relative(bakedDirectory).generic_string();
+    }
+
+    const std::vector<Vector3> hullPoints = buildHullPoints(model);
+    const bool baked = supported && project::BakedModel::write(bakedPath, model, prepared.contentHash, albedoPaths, hullPoints);
+    UnloadModel(model);
+
+    if (baked) {
+        std::cout << sourcePath << ": wrote " << bakedPath << " (" << std::filesystem::file_size(bakedPath)
+                  << " bytes, " << hullPoints.size() << " hull points)" << std::endl;
+    }
+    return baked;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    bool force = false;
+    std::vector<std::string> sources;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view argument = argv[i];
+        if (argument == "--force") {
+            force = true;
+        } else {
+            sources.emplace_back(argument);
+        }
+    }
+
+    if (sources.empty()) {
+        std::cerr << "Usage: " << argv[0] << " [--force] model.glb [model.glb ...]" << std::endl;
+        return 1;
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+    SetConfigFlags(FLAG_WINDOW_HIDDEN);
+    InitWindow(1, 1, "asset baker");
+
+    int failures = 0;
+    for (const std::string& source : sources) {
+        if (!bakeModel(source, force)) {
+            ++failures;
+        }
+    }
+
+    CloseWindow();
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,247 @@
+// Headless simulation server: many physics scene worlds stepped in lockstep, no window or GL
+//
+// Usage: Project_server [--worlds N] [--threads N] [--steps N] [--boxes N] [--input file.inputs]
+//                       [--record file.inputs] [--output file.states] [--interval N]
+//                       [--full-state] [--verify]
+//
+// Inputs come from a recording (--input) or a seeded script that spawns --boxes boxes per
+// world and kicks one of them every second; --record saves the inputs used so a run can be
+// replayed exactly. --output streams a frame per world every --interval steps (hash only,
+// or every box with --full-state). --verify runs everything again on one thread and fails
+// if the final state differs.
+
+#include <project/headless_server.hpp>
+#include <project/task_pool.hpp>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr std::uint32_t kSeed = 1234;
+constexpr std::uint32_t kKickInterval = 60;  // Steps between scripted impulses
+constexpr float kKickStrength = 4.0F;         // N*s, enough to topple a box off a stack
+
+/// Server settings from the command line
+struct ServerOptions {
+    size_t worlds{8};
+    std::optional<size_t> threads;  // Unset: TaskPool::getDefaultWorkerCount()
+    std::uint32_t steps{600};
+    std::uint32_t boxes{256};
+    std::uint32_t interval{1};
+    bool fullState{false};
+    bool verify{false};
+    std::string inputPath;
+    std::string recordPath;
+    std::string outputPath;
+};
+
+/// Build the default input script: a box batch per world, then a seeded kick every kKickInterval steps
+project::InputStream buildScript(const ServerOptions& options) {
+    project::InputStream inputs;
+    std::mt19937 random(kSeed);
+    std::uniform_real_distribution<float> direction(-1.0F, 1.0F);
+
+    for (size_t world = 0; world < options.worlds; ++world) {
+        project::InputCommand spawn;
+        spawn.world = static_cast<std::uint32_t>(world);
+        spawn.type = project::InputCommandType::SpawnBoxes;
+        spawn.value = options.boxes;
+        inputs.commands.push_back(spawn);
+    }
+
+    if (options.boxes == 0) {
+        return inputs;
+    }
+    std::uniform_int_distribution<std::uint32_t> box(0, options.boxes - 1);
+    for (std::uint32_t step = kKickInterval; step < options.steps; step += kKickInterval) {
+        for (size_t world = 0; world < options.worlds; ++world) {
+            project::InputCommand kick;
+            kick.step = step;
+            kick.world = static_cast<std::uint32_t>(world);
+            kick.type = project::InputCommandType::ApplyImpulse;
+            kick.value = box(random);
+            kick.vector[0] = direction(random) * kKickStrength;
+            kick.vector[1] = kKickStrength;
+            kick.vector[2] = direction(random) * kKickStrength;
+            inputs.commands.push_back(kick);
+        }
+    }
+    return inputs;
+}
+
+bool readFile(const std::string& path, std::vector<unsigned char>& bytes) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return true;
+}
+
+bool writeFile(const std::string& path, const std::vector<unsigned char>& bytes) {
+    std::ofstream file(path, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    return static_cast<bool>(file);
+}
+
+/// Run every world for the requested steps
+/// @param output Receives the state stream (nullptr: none)
+/// @return The final state hash over every world
+std::uint64_t runServer(const ServerOptions& options, const project::InputStream& inputs, size_t workerCount,
+                        std::ostream* output) {
+    project::TaskPool taskPool(workerCount);
+    project::HeadlessServerConfig config;
+    config.worldCount = options.worlds;
+    config.frameInterval = output != nullptr ? options.interval : 0;
+    config.fullState = options.fullState;
+    project::HeadlessServer server(config, taskPool);
+
+    const size_t dropped = server.addInputs(inputs);
+    if (dropped != 0) {
+        std::cerr << "Dropped " << dropped << " inputs for worlds beyond " << options.worlds << std::endl;
+    }
+
+    std::vector<unsigned char> frames;
+    if (output != nullptr) {
+        server.writeStreamHeader(frames);
+    }
+
+    const auto start = Clock::now();
+    for (std::uint32_t step = 0; step < options.steps; ++step) {
+        server.step(frames);
+        if (output != nullptr && !frames.empty()) {
+            output->write(reinterpret_cast<const char*>(frames.data()), static_cast<std::streamsize>(frames.size()));
+            frames.clear();
+        }
+    }
+    const double elapsedMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+    size_t boxCount = 0;
+    for (size_t i = 0; i < server.getWorldCount(); ++i) {
+        boxCount += server.getWorld(i).getBoxCount();
+    }
+    std::cout << options.worlds << " worlds, " << boxCount << " boxes, " << options.steps << " steps on "
+              << (workerCount + 1) << " threads: " << (elapsedMs / options.steps) << " ms per step" << std::endl;
+    return server.getStateHash();
+}
+
+void printUsage() {
+    std::cerr << "Usage: Project_server [--worlds N] [--threads N] [--steps N] [--boxes N] [--input file.inputs]\n"
+                 "                      [--record file.inputs] [--output file.states] [--interval N]\n"
+                 "                      [--full-state] [--verify]\n";
+}
+
+/// Parse the command line
+/// @return False on invalid arguments
+bool parseOptions(int argc, char** argv, ServerOptions& options) {
+    const std::vector<std::string_view> args(argv + 1, argv + argc);
+    for (size_t i = 0; i < args.size(); ++i) {
+        const std::string_view arg = args[i];
+        if (arg == "--help" || arg == "-h") {
+            return false;
+        }
+        if (arg == "--full-state") {
+            options.fullState = true;
+            continue;
+        }
+        if (arg == "--verify") {
+            options.verify = true;
+            continue;
+        }
+        if (i + 1 >= args.size()) {
+            std::cerr << "Missing value for " << arg << std::endl;
+            return false;
+        }
+
+        const std::string_view value = args[++i];
+        try {
+            if (arg == "--worlds") {
+                options.worlds = static_cast<size_t>(std::stoul(std::string(value)));
+            } else if (arg == "--threads") {
+                options.threads = static_cast<size_t>(std::stoul(std::string(value)));
+            } else if (arg == "--steps") {
+                options.steps = static_cast<std::uint32_t>(std::stoul(std::string(value)));
+            } else if (arg == "--boxes") {
+                options.boxes = static_cast<std::uint32_t>(std::stoul(std::string(value)));
+            } else if (arg == "--interval") {
+                options.interval = static_cast<std::uint32_t>(std::stoul(std::string(value)));
+            } else if (arg == "--input") {
+                options.inputPath = value;
+            } else if (arg == "--record") {
+                options.recordPath = value;
+            } else if (arg == "--output") {
+                options.outputPath = value;
+            } else {
+                std::cerr << "Unknown argument: " << arg << std::endl;
+                return false;
+            }
+        } catch (const std::exception&) {
+            std::cerr << "Invalid value for " << arg << ": " << value << std::endl;
+            return false;
+        }
+    }
+    return options.worlds > 0 && options.steps > 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    ServerOptions options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage();
+        return 1;
+    }
+
+    project::InputStream inputs;
+    std::vector<unsigned char> bytes;
+    if (options.inputPath.empty()) {
+        inputs = buildScript(options);
+    } else if (!readFile(options.inputPath, bytes) || !inputs.readFrom(bytes)) {
+        std::cerr << "Failed to read inputs from " << options.inputPath << std::endl;
+        return 1;
+    }
+
+    if (!options.recordPath.empty()) {
+        inputs.writeTo(bytes);
+        if (!writeFile(options.recordPath, bytes)) {
+            std::cerr << "Failed to write " << options.recordPath << std::endl;
+            return 1;
+        }
+        std::cout << "Recorded " << inputs.commands.size() << " inputs to " << options.recordPath << std::endl;
+    }
+
+    std::ofstream stateFile;
+    if (!options.outputPath.empty()) {
+        stateFile.open(options.outputPath, std::ios::binary);
+        if (!stateFile) {
+            std::cerr << "Failed to open " << options.outputPath << std::endl;
+            return 1;
+        }
+    }
+
+    const size_t workerCount = options.threads.value_or(project::TaskPool::getDefaultWorkerCount());
+    const std::uint64_t hash = runServer(options, inputs, workerCount, stateFile.is_open() ? &stateFile : nullptr);
+    std::cout << "State hash: " << std::hex << hash << std::dec << std::endl;
+
+    if (options.verify) {
+        // Same inputs on the calling thread alone: any difference is nondeterminism, not sharding
+        const std::uint64_t replayHash = runServer(options, inputs, 0, nullptr);
+        if (replayHash != hash) {
+            std::cerr << "Determinism check failed: replay hash " << std::hex << replayHash << std::dec << std::endl;
+            return 1;
+        }
+        std::cout << "Determinism check passed" << std::endl;
+    }
+    return 0;
+}